@@ -0,0 +1,238 @@
+/*
+ * Support for runtime selection of the implementation of the low-level
+ * functions (field arithmetic and point operations).
+ *
+ * When building with runtime dispatch (BACKEND=dispatch in the Makefile),
+ * gls254-c.c is compiled several times, each time with a different set
+ * of enabled CPU features and with the GLS254_BACKEND_SUFFIX macro set to
+ * a distinct suffix (e.g. "_pclmul"); all external names defined in that
+ * file are then renamed with that suffix, and each compiled variant
+ * exports a table (gls254_backend_pclmul, ...) of pointers to its
+ * functions. gls254-dispatch.c then defines the normal (unsuffixed)
+ * functions, which forward calls through the table that was selected
+ * (once) based on the CPU abilities.
+ *
+ * This header is used only by gls254-c.c and gls254-dispatch.c.
+ */
+
+#ifndef BACKEND_H__
+#define BACKEND_H__
+
+#define GLS254_CONCAT_(x, y)   x ## y
+#define GLS254_CONCAT(x, y)    GLS254_CONCAT_(x, y)
+
+#ifdef GLS254_BACKEND_SUFFIX
+
+/*
+ * Renaming of all dispatched functions. This is done before including
+ * gls254.h, so that declarations are renamed as well.
+ */
+#define GLS254_RENAME(name)   GLS254_CONCAT(name, GLS254_BACKEND_SUFFIX)
+
+#define gfb127_normalize             GLS254_RENAME(gfb127_normalize)
+#define gfb127_get_bit               GLS254_RENAME(gfb127_get_bit)
+#define gfb127_set_bit               GLS254_RENAME(gfb127_set_bit)
+#define gfb127_xor_bit               GLS254_RENAME(gfb127_xor_bit)
+#define gfb127_set_cond              GLS254_RENAME(gfb127_set_cond)
+#define gfb127_add                   GLS254_RENAME(gfb127_add)
+#define gfb127_mul_sb                GLS254_RENAME(gfb127_mul_sb)
+#define gfb127_mul_b                 GLS254_RENAME(gfb127_mul_b)
+#define gfb127_div_z                 GLS254_RENAME(gfb127_div_z)
+#define gfb127_div_z2                GLS254_RENAME(gfb127_div_z2)
+#define gfb127_mul                   GLS254_RENAME(gfb127_mul)
+#define gfb127_square                GLS254_RENAME(gfb127_square)
+#define gfb127_xsquare               GLS254_RENAME(gfb127_xsquare)
+#define gfb127_invert                GLS254_RENAME(gfb127_invert)
+#define gfb127_div                   GLS254_RENAME(gfb127_div)
+#define gfb127_sqrt                  GLS254_RENAME(gfb127_sqrt)
+#define gfb127_trace                 GLS254_RENAME(gfb127_trace)
+#define gfb127_halftrace             GLS254_RENAME(gfb127_halftrace)
+#define gfb127_iszero                GLS254_RENAME(gfb127_iszero)
+#define gfb127_equals                GLS254_RENAME(gfb127_equals)
+#define gfb127_encode                GLS254_RENAME(gfb127_encode)
+#define gfb127_decode16_trunc        GLS254_RENAME(gfb127_decode16_trunc)
+#define gfb127_decode16_reduce       GLS254_RENAME(gfb127_decode16_reduce)
+#define gfb127_decode16              GLS254_RENAME(gfb127_decode16)
+#define gfb254_mul                   GLS254_RENAME(gfb254_mul)
+#define gfb254_square                GLS254_RENAME(gfb254_square)
+#define gfb254_mul_selfphi           GLS254_RENAME(gfb254_mul_selfphi)
+#define gfb254_invert                GLS254_RENAME(gfb254_invert)
+#define gfb254_div                   GLS254_RENAME(gfb254_div)
+#define gfb254_sqrt                  GLS254_RENAME(gfb254_sqrt)
+#define gfb254_qsolve                GLS254_RENAME(gfb254_qsolve)
+#define gfb254_encode                GLS254_RENAME(gfb254_encode)
+#define gfb254_decode32_trunc        GLS254_RENAME(gfb254_decode32_trunc)
+#define gfb254_decode32_reduce       GLS254_RENAME(gfb254_decode32_reduce)
+#define gfb254_decode32              GLS254_RENAME(gfb254_decode32)
+#define gls254_isneutral             GLS254_RENAME(gls254_isneutral)
+#define gls254_equals                GLS254_RENAME(gls254_equals)
+#define gls254_set_cond              GLS254_RENAME(gls254_set_cond)
+#define gls254_encode                GLS254_RENAME(gls254_encode)
+#define gls254_decode                GLS254_RENAME(gls254_decode)
+#define gls254_add                   GLS254_RENAME(gls254_add)
+#define gls254_add_affine            GLS254_RENAME(gls254_add_affine)
+#define gls254_add_affine_affine     GLS254_RENAME(gls254_add_affine_affine)
+#define gls254_neg                   GLS254_RENAME(gls254_neg)
+#define gls254_condneg               GLS254_RENAME(gls254_condneg)
+#define gls254_sub                   GLS254_RENAME(gls254_sub)
+#define gls254_xdouble               GLS254_RENAME(gls254_xdouble)
+#define gls254_add_x4                GLS254_RENAME(gls254_add_x4)
+#define gls254_xdouble_x4            GLS254_RENAME(gls254_xdouble_x4)
+#define gls254_zeta_affine           GLS254_RENAME(gls254_zeta_affine)
+#define gls254_make_window_affine_8  GLS254_RENAME(gls254_make_window_affine_8)
+#define gls254_lookup8_affine        GLS254_RENAME(gls254_lookup8_affine)
+#define gls254_normalize             GLS254_RENAME(gls254_normalize)
+#define gls254_from_affine           GLS254_RENAME(gls254_from_affine)
+#define gls254_uncompressed_decode   GLS254_RENAME(gls254_uncompressed_decode)
+#define gls254_uncompressed_encode   GLS254_RENAME(gls254_uncompressed_encode)
+#define gls254_map_to_point          GLS254_RENAME(gls254_map_to_point)
+
+#endif
+
+#include <stdint.h>
+#include "gls254.h"
+
+/*
+ * List of all dispatched functions. The XR() macro is used for functions
+ * that return a value, XV() for functions that return nothing. Each entry
+ * has: return type, function name, parameters, arguments.
+ */
+#define GLS254_BACKEND_FUNCTIONS(XR, XV) \
+	XV(void, gfb127_normalize, \
+		(gfb127 *d, const gfb127 *a), (d, a)) \
+	XR(uint32_t, gfb127_get_bit, \
+		(const gfb127 *a, int k), (a, k)) \
+	XV(void, gfb127_set_bit, \
+		(gfb127 *a, int k, uint32_t val), (a, k, val)) \
+	XV(void, gfb127_xor_bit, \
+		(gfb127 *a, int k, uint32_t val), (a, k, val)) \
+	XV(void, gfb127_set_cond, \
+		(gfb127 *d, const gfb127 *a, uint32_t ctl), (d, a, ctl)) \
+	XV(void, gfb127_add, \
+		(gfb127 *d, const gfb127 *a, const gfb127 *b), (d, a, b)) \
+	XV(void, gfb127_mul_sb, \
+		(gfb127 *d, const gfb127 *a), (d, a)) \
+	XV(void, gfb127_mul_b, \
+		(gfb127 *d, const gfb127 *a), (d, a)) \
+	XV(void, gfb127_div_z, \
+		(gfb127 *d, const gfb127 *a), (d, a)) \
+	XV(void, gfb127_div_z2, \
+		(gfb127 *d, const gfb127 *a), (d, a)) \
+	XV(void, gfb127_mul, \
+		(gfb127 *d, const gfb127 *a, const gfb127 *b), (d, a, b)) \
+	XV(void, gfb127_square, \
+		(gfb127 *d, const gfb127 *a), (d, a)) \
+	XV(void, gfb127_xsquare, \
+		(gfb127 *d, const gfb127 *a, unsigned n), (d, a, n)) \
+	XV(void, gfb127_invert, \
+		(gfb127 *d, const gfb127 *a), (d, a)) \
+	XV(void, gfb127_div, \
+		(gfb127 *d, const gfb127 *a, const gfb127 *b), (d, a, b)) \
+	XV(void, gfb127_sqrt, \
+		(gfb127 *d, const gfb127 *a), (d, a)) \
+	XR(uint32_t, gfb127_trace, \
+		(const gfb127 *a), (a)) \
+	XV(void, gfb127_halftrace, \
+		(gfb127 *d, const gfb127 *a), (d, a)) \
+	XR(uint32_t, gfb127_iszero, \
+		(const gfb127 *a), (a)) \
+	XR(uint32_t, gfb127_equals, \
+		(const gfb127 *a, const gfb127 *b), (a, b)) \
+	XV(void, gfb127_encode, \
+		(void *dst, const gfb127 *a), (dst, a)) \
+	XV(void, gfb127_decode16_trunc, \
+		(gfb127 *d, const void *src), (d, src)) \
+	XV(void, gfb127_decode16_reduce, \
+		(gfb127 *d, const void *src), (d, src)) \
+	XR(uint32_t, gfb127_decode16, \
+		(gfb127 *d, const void *src), (d, src)) \
+	XV(void, gfb254_mul, \
+		(gfb254 *d, const gfb254 *a, const gfb254 *b), (d, a, b)) \
+	XV(void, gfb254_square, \
+		(gfb254 *d, const gfb254 *a), (d, a)) \
+	XV(void, gfb254_mul_selfphi, \
+		(gfb127 *d, const gfb254 *a), (d, a)) \
+	XV(void, gfb254_invert, \
+		(gfb254 *d, const gfb254 *a), (d, a)) \
+	XV(void, gfb254_div, \
+		(gfb254 *d, const gfb254 *a, const gfb254 *b), (d, a, b)) \
+	XV(void, gfb254_sqrt, \
+		(gfb254 *d, const gfb254 *a), (d, a)) \
+	XV(void, gfb254_qsolve, \
+		(gfb254 *d, const gfb254 *a), (d, a)) \
+	XV(void, gfb254_encode, \
+		(void *dst, const gfb254 *a), (dst, a)) \
+	XV(void, gfb254_decode32_trunc, \
+		(gfb254 *d, const void *src), (d, src)) \
+	XV(void, gfb254_decode32_reduce, \
+		(gfb254 *d, const void *src), (d, src)) \
+	XR(uint32_t, gfb254_decode32, \
+		(gfb254 *d, const void *src), (d, src)) \
+	XR(uint32_t, gls254_isneutral, \
+		(const gls254_point *p), (p)) \
+	XR(uint32_t, gls254_equals, \
+		(const gls254_point *p1, const gls254_point *p2), (p1, p2)) \
+	XV(void, gls254_set_cond, \
+		(gls254_point *p2, const gls254_point *p1, uint32_t ctl), \
+		(p2, p1, ctl)) \
+	XV(void, gls254_encode, \
+		(void *dst, const gls254_point *p), (dst, p)) \
+	XR(uint32_t, gls254_decode, \
+		(gls254_point *p, const void *src), (p, src)) \
+	XV(void, gls254_add, \
+		(gls254_point *p3, const gls254_point *p1, \
+		const gls254_point *p2), (p3, p1, p2)) \
+	XV(void, gls254_add_affine, \
+		(gls254_point *p3, const gls254_point *p1, \
+		const gls254_point_affine *p2), (p3, p1, p2)) \
+	XV(void, gls254_add_affine_affine, \
+		(gls254_point *p3, const gls254_point_affine *p1, \
+		const gls254_point_affine *p2), (p3, p1, p2)) \
+	XV(void, gls254_neg, \
+		(gls254_point *p3, const gls254_point *p1), (p3, p1)) \
+	XV(void, gls254_condneg, \
+		(gls254_point *p3, const gls254_point *p1, uint32_t ctl), \
+		(p3, p1, ctl)) \
+	XV(void, gls254_sub, \
+		(gls254_point *p3, const gls254_point *p1, \
+		const gls254_point *p2), (p3, p1, p2)) \
+	XV(void, gls254_xdouble, \
+		(gls254_point *p3, const gls254_point *p1, unsigned n), \
+		(p3, p1, n)) \
+	XV(void, gls254_add_x4, \
+		(gls254_point *p3, const gls254_point *p1, \
+		const gls254_point *p2), (p3, p1, p2)) \
+	XV(void, gls254_xdouble_x4, \
+		(gls254_point *p3, const gls254_point *p1, unsigned n), \
+		(p3, p1, n)) \
+	XV(void, gls254_zeta_affine, \
+		(gls254_point_affine *p2, const gls254_point_affine *p1, \
+		uint32_t zn), (p2, p1, zn)) \
+	XV(void, gls254_make_window_affine_8, \
+		(gls254_point_affine *win, const gls254_point *p), (win, p)) \
+	XV(void, gls254_lookup8_affine, \
+		(gls254_point_affine *p, const gls254_point_affine *win, \
+		int8_t k), (p, win, k)) \
+	XV(void, gls254_normalize, \
+		(gls254_point_affine *q, const gls254_point *p), (q, p)) \
+	XV(void, gls254_from_affine, \
+		(gls254_point *q, const gls254_point_affine *p), (q, p)) \
+	XR(uint32_t, gls254_uncompressed_decode, \
+		(gls254_point_affine *p, const void *src), (p, src)) \
+	XV(void, gls254_uncompressed_encode, \
+		(void *dst, const gls254_point_affine *p), (dst, p)) \
+	XV(void, gls254_map_to_point, \
+		(gls254_point *p, const void *src), (p, src))
+
+/*
+ * Table of function pointers. Field names are the function names with
+ * an "f_" prefix (so that they are not affected by the renaming macros).
+ */
+#define GLS254_BACKEND_FIELD(ret, name, params, args)   ret (*f_ ## name) params;
+typedef struct {
+	const char *name;
+	GLS254_BACKEND_FUNCTIONS(GLS254_BACKEND_FIELD, GLS254_BACKEND_FIELD)
+} gls254_backend;
+#undef GLS254_BACKEND_FIELD
+
+#endif
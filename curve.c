@@ -20,17 +20,18 @@ enc32le(void *dst, uint32_t x)
 
 /*
  * Booth recoding.
- * Input: n[], unsigned little-endian, length = 8 bytes (64 bits)
- * Output: sd[], 16 signed digits ([-8..+8]), low to high order
+ * Input: n[], unsigned little-endian, length = 16 bytes (128 bits)
+ * Output: sd[], 32 signed digits ([-8..+8]), low to high order
  * Returned: carry (0 or 1)
- * If carry is one, then the signed digits encode n - 2^64 instead of n.
+ * If carry is one, then the signed digits encode n - 2^128 instead of n.
+ * The carry is always zero if the input value is lower than 2^127.
  */
 static uint32_t
-recode4_u64(int8_t *sd, const uint8_t *n)
+recode4_u128(int8_t *sd, const uint8_t *n)
 {
 	uint8_t *dd = (uint8_t *)sd;
 	uint32_t cc = 0;
-	for (int i = 0; i < 8; i ++) {
+	for (int i = 0; i < 16; i ++) {
 		uint32_t x, d, m;
 
 		x = (uint32_t)n[i];
@@ -47,54 +48,86 @@ recode4_u64(int8_t *sd, const uint8_t *n)
 	return cc;
 }
 
-/*
- * Booth recoding.
- * Input: n[], unsigned little-endian, length = 16 bytes (127 bits)
- * !!!IMPORTANT: input value must be lower than 2^127
- * Output: sd[], 32 signed digits ([-8..+8]), low to high order
- */
-static void
-recode4_u128(int8_t *sd, const uint8_t *n)
-{
-	uint8_t *dd = (uint8_t *)sd;
-	uint32_t cc = 0;
-	for (int i = 0; i < 16; i ++) {
-		uint32_t x, d, m;
-
-		x = (uint32_t)n[i];
-		d = (x & 0x0F) + cc;
-		m = (8 - d) >> 8;
-		dd[(i << 1) + 0] = (uint8_t)(d - (m & 16));
-		cc = m & 1;
+static const gfb254 GFB254_ZERO = { { { { 0, 0, 0, 0 } }, { { 0, 0, 0, 0 } } } };
+static const gfb254 GFB254_ONE = { { { { 1, 0, 0, 0 } }, { { 0, 0, 0, 0 } } } };
+static const gfb254 GFB254_SQRT_B = { { { { 0x08000001, 0, 0, 0 } }, { { 0, 0, 0, 0 } } } };
 
-		d = (x >> 4) + cc;
-		m = (8 - d) >> 8;
-		dd[(i << 1) + 1] = (uint8_t)(d - (m & 16));
-		cc = m & 1;
+/* see inner.h */
+void
+gfb254_batch_invert(gfb254 *d, const gfb254 *a, size_t n)
+{
+	gfb254 r, t;
+	uint32_t z;
+
+	/*
+	 * Montgomery's trick: with a'[i] = a[i] (or 1 if a[i] = 0), we
+	 * set d[i] = a'[0]*a'[1]*...*a'[i-1] for i >= 1, invert the
+	 * product of all a'[i], then walk back down, each step yielding
+	 * one inverse and removing one factor from the running inverse.
+	 * Cost: one inversion and 3*(n-1) multiplications.
+	 */
+	if (n == 0) {
+		return;
+	}
+	r = a[0];
+	gfb254_set_cond(&r, &GFB254_ONE, gfb254_iszero(&a[0]));
+	for (size_t i = 1; i < n; i ++) {
+		d[i] = r;
+		t = a[i];
+		gfb254_set_cond(&t, &GFB254_ONE, gfb254_iszero(&a[i]));
+		gfb254_mul(&r, &r, &t);
+	}
+	gfb254_invert(&r, &r);
+	for (size_t i = n - 1; i > 0; i --) {
+		z = gfb254_iszero(&a[i]);
+		t = a[i];
+		gfb254_set_cond(&t, &GFB254_ONE, z);
+		gfb254_mul(&d[i], &d[i], &r);
+		gfb254_mul(&r, &r, &t);
+		gfb254_set_cond(&d[i], &GFB254_ZERO, z);
 	}
+	d[0] = r;
+	gfb254_set_cond(&d[0], &GFB254_ZERO, gfb254_iszero(&a[0]));
 }
 
 /* see gls254.h */
 void
-gls254_mul(gls254_point *q, const gls254_point *p, const void *k)
+gls254_scalar_recode(gls254_scalar_recoded *sr, const void *k)
 {
-	gls254_point_affine win[8], pa, qa;
 	uint8_t n0[16], n1[16];
-	int8_t sd0[32], sd1[32];
-	uint32_t s0, s1, zn;
+	uint32_t s1;
 
-	scalar_split(n0, &s0, n1, &s1, k);
-
-	/* We make the window over P or -P, to match the sign of n0. */
-	gls254_condneg(q, p, s0);
-	gls254_make_window_affine_8(win, q);
+	scalar_split(n0, &sr->s0, n1, &s1, k);
 
 	/* If zn != 0 then n1 has not the same sign as n0, and we must
 	   apply the -zeta() endomorphism. */
-	zn = s0 ^ s1;
+	sr->zn = sr->s0 ^ s1;
+	recode4_u128(sr->sd0, n0);
+	recode4_u128(sr->sd1, n1);
+}
+
+/* see gls254.h */
+void
+gls254_mul(gls254_point *q, const gls254_point *p, const void *k)
+{
+	gls254_scalar_recoded sr;
+
+	gls254_scalar_recode(&sr, k);
+	gls254_mul_recoded(q, p, &sr);
+}
+
+/* see gls254.h */
+void
+gls254_mul_recoded(gls254_point *q, const gls254_point *p,
+	const gls254_scalar_recoded *sr)
+{
+	gls254_point_affine win[8], pa, qa;
+	const int8_t *sd0 = sr->sd0, *sd1 = sr->sd1;
+	uint32_t zn = sr->zn;
 
-	recode4_u128(sd0, n0);
-	recode4_u128(sd1, n1);
+	/* We make the window over P or -P, to match the sign of n0. */
+	gls254_condneg(q, p, sr->s0);
+	gls254_make_window_affine_8(win, q);
 
 	gls254_lookup8_affine(&pa, win, sd0[31]);
 	gls254_lookup8_affine(&qa, win, sd1[31]);
@@ -112,12 +145,391 @@ gls254_mul(gls254_point *q, const gls254_point *p, const void *k)
 	}
 }
 
+/* see gls254.h */
+void
+gls254_mul_batch(gls254_point *q, const gls254_point *p,
+	const void *k, size_t num)
+{
+	const uint8_t *kb;
+
+	/*
+	 * Same algorithm as gls254_mul(), with four independent
+	 * multiplications advancing in lockstep; doublings and generic
+	 * additions use the lane-parallel functions. Remaining points
+	 * (if num is not a multiple of 4) use gls254_mul().
+	 */
+	kb = k;
+	while (num >= 4) {
+		gls254_point_affine win[4][8], pa, qa;
+		gls254_point acc[4], t[4];
+		gls254_scalar_recoded sr[4];
+
+		for (int j = 0; j < 4; j ++) {
+			gls254_scalar_recode(&sr[j], kb + (j << 5));
+			gls254_condneg(&acc[j], &p[j], sr[j].s0);
+			gls254_make_window_affine_8(win[j], &acc[j]);
+			gls254_lookup8_affine(&pa, win[j], sr[j].sd0[31]);
+			gls254_lookup8_affine(&qa, win[j], sr[j].sd1[31]);
+			gls254_zeta_affine(&qa, &qa, sr[j].zn);
+			gls254_add_affine_affine(&acc[j], &pa, &qa);
+		}
+		for (int i = 30; i >= 0; i --) {
+			gls254_xdouble_x4(acc, acc, 4);
+			for (int j = 0; j < 4; j ++) {
+				gls254_lookup8_affine(&pa,
+					win[j], sr[j].sd0[i]);
+				gls254_lookup8_affine(&qa,
+					win[j], sr[j].sd1[i]);
+				gls254_zeta_affine(&qa, &qa, sr[j].zn);
+				gls254_add_affine_affine(&t[j], &pa, &qa);
+			}
+			gls254_add_x4(acc, acc, t);
+		}
+		memcpy(q, acc, sizeof acc);
+		p += 4;
+		q += 4;
+		kb += 4 << 5;
+		num -= 4;
+	}
+	while (num -- > 0) {
+		gls254_mul(q ++, p ++, kb);
+		kb += 32;
+	}
+}
+
+/*
+ * Batch functions process their inputs in chunks of that many elements,
+ * so that the stack buffers remain small (no dynamic allocation). One
+ * field inversion is shared by all elements in a chunk.
+ */
+#define BATCH_CHUNK   16
+
+/* see gls254.h */
+void
+gls254_normalize_batch(gls254_point_affine *q, const gls254_point *p,
+	size_t num)
+{
+	while (num > 0) {
+		gfb254 zz[BATCH_CHUNK], iz[BATCH_CHUNK];
+		size_t n;
+
+		n = num < BATCH_CHUNK ? num : BATCH_CHUNK;
+
+		/* scaled_x = T/Z^2, scaled_s = S/Z^2 */
+		for (size_t i = 0; i < n; i ++) {
+			gfb254_square(&zz[i], &p[i].Z);
+		}
+		gfb254_batch_invert(iz, zz, n);
+		for (size_t i = 0; i < n; i ++) {
+			gfb254_mul(&q[i].scaled_x, &p[i].T, &iz[i]);
+			gfb254_mul(&q[i].scaled_s, &p[i].S, &iz[i]);
+		}
+		q += n;
+		p += n;
+		num -= n;
+	}
+}
+
+/* see gls254.h */
+void
+gls254_encode_batch(void *dst, const gls254_point *p, size_t num)
+{
+	uint8_t *buf = dst;
+
+	while (num > 0) {
+		gfb254 w[BATCH_CHUNK], it[BATCH_CHUNK];
+		size_t n;
+
+		n = num < BATCH_CHUNK ? num : BATCH_CHUNK;
+
+		/* w <- sqrt(S/T); for the neutral, T = 0 and 1/T is
+		   then 0, which yields w = 0, as in gls254_encode(). */
+		for (size_t i = 0; i < n; i ++) {
+			w[i] = p[i].T;
+		}
+		gfb254_batch_invert(it, w, n);
+		for (size_t i = 0; i < n; i ++) {
+			gfb254_mul(&w[i], &p[i].S, &it[i]);
+			gfb254_sqrt(&w[i], &w[i]);
+			gfb254_encode(buf, &w[i]);
+			buf += 32;
+		}
+		p += n;
+		num -= n;
+	}
+}
+
+/*
+ * GLS254_SMALL_TARGET selects defaults suited to microcontrollers with
+ * little RAM and flash (smaller stack buffers and static tables). It is
+ * set when compiling for an ARM M-profile core such as the Cortex M4,
+ * whatever the backend (a BACKEND=c build for the M4 has the same
+ * memory constraints as the assembly one).
+ */
+#ifndef GLS254_SMALL_TARGET
+#if (defined __ARM_ARCH_PROFILE && __ARM_ARCH_PROFILE == 'M') \
+	|| defined __ARM_ARCH_7EM__ || defined __ARM_ARCH_7M__
+#define GLS254_SMALL_TARGET   1
+#else
+#define GLS254_SMALL_TARGET   0
+#endif
+#endif
+
+/*
+ * Multi-scalar multiplication processes its input by blocks of
+ * GLS254_MSM_BLOCK points (i.e. twice as many half-size terms after the
+ * scalar split). Larger blocks make the bucket method more efficient,
+ * but increase stack usage (about 192 bytes per point, plus 128 bytes
+ * per bucket). The default is 256 points (about 60 kB of stack), or
+ * 32 points (about 10 kB) with GLS254_SMALL_TARGET. MSM_MAX_WIN is the
+ * largest window width that the cost estimate may select for a full
+ * block; it sets the number of buckets.
+ */
+#ifndef GLS254_MSM_BLOCK
+#if GLS254_SMALL_TARGET
+#define GLS254_MSM_BLOCK   32
+#else
+#define GLS254_MSM_BLOCK   256
+#endif
+#endif
+#if GLS254_MSM_BLOCK < 1 || GLS254_MSM_BLOCK > 1024
+#error GLS254_MSM_BLOCK must be between 1 and 1024
+#endif
+#define MSM_BLOCK   GLS254_MSM_BLOCK
+#if MSM_BLOCK <= 64
+#define MSM_MAX_WIN   5
+#elif MSM_BLOCK <= 128
+#define MSM_MAX_WIN   6
+#else
+#define MSM_MAX_WIN   7
+#endif
+
+/*
+ * Signed recoding of a half-size scalar (lower than 2^127) into digits
+ * of c bits (2 <= c <= 7), in the -2^(c-1)..+2^(c-1) range, low to high
+ * order. Number of digits is ceil(128/c); there is no final carry.
+ */
+static void
+recode_signed_vartime(int8_t *sd, const uint8_t *n, unsigned c, unsigned nd)
+{
+	uint32_t cc = 0;
+	uint32_t mask = ((uint32_t)1 << c) - 1;
+	uint32_t half = (uint32_t)1 << (c - 1);
+
+	for (unsigned j = 0; j < nd; j ++) {
+		unsigned off = j * c;
+		uint32_t d;
+
+		/* Extract c bits at offset off (c <= 7, hence at most
+		   two bytes are involved). */
+		d = n[off >> 3];
+		if ((off >> 3) < 15) {
+			d |= (uint32_t)n[(off >> 3) + 1] << 8;
+		}
+		d = ((d >> (off & 7)) & mask) + cc;
+		if (d > half) {
+			sd[j] = (int8_t)((int32_t)d - (int32_t)(mask + 1));
+			cc = 1;
+		} else {
+			sd[j] = (int8_t)d;
+			cc = 0;
+		}
+	}
+}
+
+/*
+ * Bucket method on n affine terms T[i] with c-bit signed digits
+ * sd[i*nd..i*nd+nd-1] (low to high order); \sum_i d_i*T[i] is added
+ * to *q.
+ */
+static void
+msm_block_vartime(gls254_point *q, const gls254_point_affine *T,
+	const int8_t *sd, size_t n, unsigned c, unsigned nd)
+{
+	gls254_point bucket[1 << (MSM_MAX_WIN - 1)], acc, sum, run;
+	uint8_t used[1 << (MSM_MAX_WIN - 1)];
+	unsigned nb = 1u << (c - 1);
+
+	acc = GLS254_NEUTRAL;
+	for (int j = (int)nd - 1; j >= 0; j --) {
+		int top;
+
+		memset(used, 0, nb);
+		for (size_t i = 0; i < n; i ++) {
+			gls254_point_affine pa;
+			int d = sd[i * nd + (unsigned)j];
+			unsigned b;
+
+			if (d == 0) {
+				continue;
+			}
+			pa = T[i];
+			if (d < 0) {
+				gfb254_add(&pa.scaled_s, &pa.scaled_s,
+					&pa.scaled_x);
+				d = -d;
+			}
+			b = (unsigned)d - 1;
+			if (used[b]) {
+				gls254_add_affine(&bucket[b], &bucket[b], &pa);
+			} else {
+				gls254_from_affine(&bucket[b], &pa);
+				used[b] = 1;
+			}
+		}
+
+		/*
+		 * Window sum = \sum_b (b+1)*bucket[b], computed with running
+		 * sums from the highest bucket down; empty buckets are
+		 * skipped.
+		 */
+		top = (int)nb - 1;
+		while (top >= 0 && !used[top]) {
+			top --;
+		}
+		if (j != (int)nd - 1) {
+			gls254_xdouble(&acc, &acc, c);
+		}
+		if (top < 0) {
+			continue;
+		}
+		run = bucket[top];
+		sum = run;
+		for (int b = top - 1; b >= 0; b --) {
+			if (used[b]) {
+				gls254_add(&run, &run, &bucket[b]);
+			}
+			gls254_add(&sum, &sum, &run);
+		}
+		gls254_add(&acc, &acc, &sum);
+	}
+	gls254_add(q, q, &acc);
+}
+
+/* see gls254.h */
+void
+gls254_msm_vartime(gls254_point *q, const gls254_point *p,
+	const void *k, size_t num)
+{
+	const uint8_t *kb = k;
+	gls254_point r;
+
+	r = GLS254_NEUTRAL;
+	while (num > 0) {
+		gls254_point_affine T[2 * MSM_BLOCK];
+		int8_t sd[2 * MSM_BLOCK * 32];
+		size_t n, m, cost, best_cost;
+		unsigned c, nd;
+
+		n = num < MSM_BLOCK ? num : MSM_BLOCK;
+		m = n << 1;
+
+		/*
+		 * Window width: each window costs about one addition per
+		 * term, and two per bucket (2^(c-1) buckets). The digits
+		 * must fit in sd[], which allows 32 digits per term of a
+		 * full block (small blocks may use narrower windows).
+		 */
+		c = 4;
+		best_cost = (size_t)-1;
+		for (unsigned w = 2; w <= MSM_MAX_WIN; w ++) {
+			if (m * ((128 + w - 1) / w) > sizeof sd) {
+				continue;
+			}
+			cost = ((128 + w - 1) / w) * (m + ((size_t)2 << (w - 1)));
+			if (cost < best_cost) {
+				best_cost = cost;
+				c = w;
+			}
+		}
+		nd = (128 + c - 1) / c;
+
+		/*
+		 * Each scalar k is split into k0 + mu*k1, with |k0| and |k1|
+		 * lower than 2^127; the terms are (+/-P, |k0|) and
+		 * (+/-zeta(P), |k1|), with the input points normalized to
+		 * affine coordinates with a shared inversion.
+		 */
+		for (size_t i = 0; i < n; i += BATCH_CHUNK) {
+			gls254_point_affine pa[BATCH_CHUNK];
+			size_t u = (n - i) < BATCH_CHUNK ? (n - i) : BATCH_CHUNK;
+
+			gls254_normalize_batch(pa, p + i, u);
+			for (size_t j = 0; j < u; j ++) {
+				uint8_t k0[16], k1[16];
+				uint32_t s0, s1;
+				size_t t = (i + j) << 1;
+
+				scalar_split(k0, &s0, k1, &s1,
+					kb + ((i + j) << 5));
+				T[t] = pa[j];
+				if (s0) {
+					gfb254_add(&T[t].scaled_s,
+						&T[t].scaled_s, &T[t].scaled_x);
+				}
+				gls254_zeta_affine(&T[t + 1], &pa[j], s1);
+				recode_signed_vartime(&sd[t * nd], k0, c, nd);
+				recode_signed_vartime(&sd[(t + 1) * nd], k1, c, nd);
+			}
+		}
+		msm_block_vartime(&r, T, sd, m, c, nd);
+
+		p += n;
+		kb += n << 5;
+		num -= n;
+	}
+	*q = r;
+}
+
 /* Forward declaration of precomputed tables of multiples of the base
    point (located at the end of this file). */
-static const gls254_point_affine PRECOMP_B[];
-static const gls254_point_affine PRECOMP_B32[];
-static const gls254_point_affine PRECOMP_B64[];
-static const gls254_point_affine PRECOMP_B96[];
+static const gls254_point_affine PRECOMP_COMB[];
+static const gls254_point_affine PRECOMP_B_ODD[];
+static const gls254_point_affine PRECOMP_B64_ODD[];
+
+/* The first table in PRECOMP_COMB contains i*B for i = 1 to 8. */
+#define PRECOMP_B   PRECOMP_COMB
+
+/*
+ * Number of tables used by gls254_mulgen() (4, 8, 16 or 32). With T
+ * tables, table j contains i*(2^(128*j/T))*B for i = 1 to 8, and the
+ * multiplication uses 4*(32/T - 1) doublings; each table uses 512 bytes.
+ */
+#ifndef GLS254_MULGEN_TABLES
+#define GLS254_MULGEN_TABLES   4
+#endif
+#if GLS254_MULGEN_TABLES != 4 && GLS254_MULGEN_TABLES != 8 \
+	&& GLS254_MULGEN_TABLES != 16 && GLS254_MULGEN_TABLES != 32
+#error GLS254_MULGEN_TABLES must be 4, 8, 16 or 32
+#endif
+
+/*
+ * Window widths for the wNAF recoding in signature verification.
+ * GLS254_VERIFY_WIN (4 to 6) applies to the public key: 2^(w-2) odd
+ * multiples are computed for each verification. GLS254_VERIFY_GEN_WIN
+ * (4 to 8) applies to the base point, with static tables of 2^(w-2)
+ * odd multiples of B and 2^64*B (128 bytes of table per multiple, i.e.
+ * 1 kB for width 5 and 4 kB for width 7). Its default is 5 with
+ * GLS254_SMALL_TARGET, to keep flash usage low, and 7 otherwise.
+ * Since the challenge halves are only 64 bits each, a larger window
+ * on the public key costs more to build than it saves.
+ */
+#ifndef GLS254_VERIFY_WIN
+#define GLS254_VERIFY_WIN       4
+#endif
+#ifndef GLS254_VERIFY_GEN_WIN
+#if GLS254_SMALL_TARGET
+#define GLS254_VERIFY_GEN_WIN   5
+#else
+#define GLS254_VERIFY_GEN_WIN   7
+#endif
+#endif
+#if GLS254_VERIFY_WIN < 4 || GLS254_VERIFY_WIN > 6
+#error GLS254_VERIFY_WIN must be in the 4..6 range
+#endif
+#if GLS254_VERIFY_GEN_WIN < 4 || GLS254_VERIFY_GEN_WIN > 8
+#error GLS254_VERIFY_GEN_WIN must be in the 4..8 range
+#endif
 
 /*
  * Convenience wrapper for lookup + zeta.
@@ -130,61 +542,66 @@ gls254_lookup8_affine_zeta(gls254_point_affine *p,
 	gls254_zeta_affine(p, p, zn);
 }
 
-/* see gls254.h */
-void
-gls254_mulgen(gls254_point *q, const void *k)
+/*
+ * Multiply by scalar k (32 bytes) the point P for which the ntab tables
+ * in tabs[] were computed (ntab = 4, 8, 16 or 32): table j (tabs[8*j]
+ * to tabs[8*j + 7]) contains i*(2^(128*j/ntab))*P for i = 1 to 8.
+ */
+static void
+mul_comb(gls254_point *q, const gls254_point_affine *tabs, int ntab,
+	const gls254_scalar_recoded *sr)
 {
 	gls254_point t;
 	gls254_point_affine pa, qa;
-	uint8_t n0[16], n1[16];
-	int8_t sd0[32], sd1[32];
-	uint32_t s0, s1, zn;
-
-	scalar_split(n0, &s0, n1, &s1, k);
-	zn = s0 ^ s1;
-	recode4_u128(sd0, n0);
-	recode4_u128(sd1, n1);
-
-	gls254_lookup8_affine(&pa, PRECOMP_B, sd0[7]);
-	gls254_lookup8_affine(&qa, PRECOMP_B32, sd0[15]);
-	gls254_add_affine_affine(q, &pa, &qa);
-	gls254_lookup8_affine(&pa, PRECOMP_B64, sd0[23]);
-	gls254_lookup8_affine(&qa, PRECOMP_B96, sd0[31]);
-	gls254_add_affine_affine(&t, &pa, &qa);
-	gls254_add(q, q, &t);
-
-	gls254_lookup8_affine_zeta(&pa, PRECOMP_B, sd1[7], zn);
-	gls254_lookup8_affine_zeta(&qa, PRECOMP_B32, sd1[15], zn);
-	gls254_add_affine_affine(&t, &pa, &qa);
-	gls254_add(q, q, &t);
-	gls254_lookup8_affine_zeta(&pa, PRECOMP_B64, sd1[23], zn);
-	gls254_lookup8_affine_zeta(&qa, PRECOMP_B96, sd1[31], zn);
-	gls254_add_affine_affine(&t, &pa, &qa);
-	gls254_add(q, q, &t);
-
-	for (int i = 6; i >= 0; i --) {
-		gls254_xdouble(q, q, 4);
+	const int8_t *sd0 = sr->sd0, *sd1 = sr->sd1;
+	uint32_t zn = sr->zn;
+	int rounds;
+
+	/*
+	 * Digit i + j*rounds of each half uses table j; tables are
+	 * processed in pairs.
+	 */
+	rounds = 32 / ntab;
+	for (int i = rounds - 1; i >= 0; i --) {
+		if (i != rounds - 1) {
+			gls254_xdouble(q, q, 4);
+		}
+		for (int j = 0; j < ntab; j += 2) {
+			const gls254_point_affine *w0, *w1;
+			int d0, d1;
+
+			w0 = &tabs[j << 3];
+			w1 = w0 + 8;
+			d0 = i + j * rounds;
+			d1 = d0 + rounds;
+
+			gls254_lookup8_affine(&pa, w0, sd0[d0]);
+			gls254_lookup8_affine(&qa, w1, sd0[d1]);
+			if (i == rounds - 1 && j == 0) {
+				gls254_add_affine_affine(q, &pa, &qa);
+			} else {
+				gls254_add_affine_affine(&t, &pa, &qa);
+				gls254_add(q, q, &t);
+			}
+
+			gls254_lookup8_affine_zeta(&pa, w0, sd1[d0], zn);
+			gls254_lookup8_affine_zeta(&qa, w1, sd1[d1], zn);
+			gls254_add_affine_affine(&t, &pa, &qa);
+			gls254_add(q, q, &t);
+		}
+	}
 
-		gls254_lookup8_affine(&pa, PRECOMP_B, sd0[i]);
-		gls254_lookup8_affine(&qa, PRECOMP_B32, sd0[i + 8]);
-		gls254_add_affine_affine(&t, &pa, &qa);
-		gls254_add(q, q, &t);
-		gls254_lookup8_affine(&pa, PRECOMP_B64, sd0[i + 16]);
-		gls254_lookup8_affine(&qa, PRECOMP_B96, sd0[i + 24]);
-		gls254_add_affine_affine(&t, &pa, &qa);
-		gls254_add(q, q, &t);
+	gls254_condneg(q, q, sr->s0);
+}
 
-		gls254_lookup8_affine_zeta(&pa, PRECOMP_B, sd1[i], zn);
-		gls254_lookup8_affine_zeta(&qa, PRECOMP_B32, sd1[i + 8], zn);
-		gls254_add_affine_affine(&t, &pa, &qa);
-		gls254_add(q, q, &t);
-		gls254_lookup8_affine_zeta(&pa, PRECOMP_B64, sd1[i + 16], zn);
-		gls254_lookup8_affine_zeta(&qa, PRECOMP_B96, sd1[i + 24], zn);
-		gls254_add_affine_affine(&t, &pa, &qa);
-		gls254_add(q, q, &t);
-	}
+/* see gls254.h */
+void
+gls254_mulgen(gls254_point *q, const void *k)
+{
+	gls254_scalar_recoded sr;
 
-	gls254_condneg(q, q, s0);
+	gls254_scalar_recode(&sr, k);
+	mul_comb(q, PRECOMP_COMB, GLS254_MULGEN_TABLES, &sr);
 }
 
 /* see gls254.h */
@@ -243,6 +660,97 @@ gls254_decode_public(gls254_public_key *pk, const void *src)
 	return 1;
 }
 
+/*
+ * Decode n points (n <= BATCH_CHUNK) from src[] (32 bytes each) into
+ * p[], with the same results as gls254_decode() (returned in r[]), but
+ * with a single inversion for all points.
+ */
+static void
+decode_chunk(gls254_point *p, uint32_t *r, const uint8_t *src, size_t n)
+{
+	gfb254 w[BATCH_CHUNK], dd[BATCH_CHUNK], e[BATCH_CHUNK];
+
+	/*
+	 * The X and S slots of each output point hold d = w^2 + w + a
+	 * and w^2 until the final values are computed. d is never zero,
+	 * since a has trace 1.
+	 */
+	for (size_t i = 0; i < n; i ++) {
+		r[i] = gfb254_decode32(&w[i], src + (i << 5));
+		gfb254_square(&p[i].S, &w[i]);
+		gfb254_add(&p[i].X, &w[i], &p[i].S);
+		gfb254_add_u(&p[i].X, &p[i].X);
+		gfb254_square(&dd[i], &p[i].X);
+	}
+	gfb254_batch_invert(e, dd, n);
+	for (size_t i = 0; i < n; i ++) {
+		uint32_t wz;
+
+		/* e <- b/d^2; if Tr(e) = 1 then the input is not valid
+		   (or is zero). */
+		wz = r[i] & gfb254_iszero(&w[i]);
+		gfb254_mul_b(&e[i], &e[i]);
+		r[i] &= gfb254_trace(&e[i]) - 1;
+
+		/* x <- d*qsolve(e); if Tr(x) = 1, then x <- x + d */
+		gfb254_qsolve(&e[i], &e[i]);
+		gfb254_mul(&e[i], &e[i], &p[i].X);
+		gfb254_add(&p[i].X, &p[i].X, &e[i]);
+		gfb254_set_cond(&p[i].X, &e[i], ~-gfb254_trace(&e[i]));
+
+		/* s <- x*w^2 (scaled); Z = sqrt(b), T = sqrt(b)*X */
+		gfb254_mul(&p[i].S, &p[i].X, &p[i].S);
+		gfb254_mul_sb(&p[i].S, &p[i].S);
+		p[i].Z = GFB254_SQRT_B;
+		gfb254_mul_sb(&p[i].T, &p[i].X);
+
+		/* On failure, use the neutral; w = 0 is the neutral. */
+		gls254_set_cond(&p[i], &GLS254_NEUTRAL, ~r[i]);
+		r[i] |= wz;
+	}
+}
+
+/* see gls254.h */
+int
+gls254_decode_public_batch(gls254_public_key *pk, uint8_t *valid,
+	const void *src, size_t num)
+{
+	const uint8_t *buf = src;
+	uint32_t all = 0xFFFFFFFF;
+	size_t k = 0;
+
+	if (valid != NULL) {
+		memset(valid, 0, (num + 7) >> 3);
+	}
+	while (num > 0) {
+		gls254_point pp[BATCH_CHUNK];
+		uint32_t r[BATCH_CHUNK];
+		size_t n;
+
+		n = num < BATCH_CHUNK ? num : BATCH_CHUNK;
+		decode_chunk(pp, r, buf, n);
+		for (size_t i = 0; i < n; i ++) {
+			uint32_t ok;
+
+			/* As in gls254_decode_public(), the neutral is not
+			   a valid key. */
+			ok = r[i] & ~gls254_isneutral(&pp[i]);
+			memcpy(pk[i].enc, buf + (i << 5), 32);
+			pk[i].pp = pp[i];
+			gls254_set_cond(&pk[i].pp, &GLS254_NEUTRAL, ~ok);
+			if (valid != NULL) {
+				valid[k >> 3] |= (uint8_t)((ok & 1) << (k & 7));
+			}
+			all &= ok;
+			k ++;
+		}
+		buf += n << 5;
+		pk += n;
+		num -= n;
+	}
+	return (int)(all & 1);
+}
+
 /* see gls254.h */
 void
 gls254_encode_public(void *dst, const gls254_public_key *pk)
@@ -295,18 +803,18 @@ gls254_hash_to_point(gls254_point *p, const char *hash_name,
 }
 
 /*
- * Compute the "challenge" (16 bytes) in Schnorr signatures.
+ * Compute the "challenge" (16 bytes) in Schnorr signatures, from the
+ * encoded R point (32 bytes).
  */
 static void
-make_challenge(void *dst, const gls254_point *R, const void *pub,
+make_challenge(void *dst, const void *R_enc, const void *pub,
 	const char *hash_name, const void *data, size_t data_len)
 {
 	blake2s_context bc;
 	uint8_t tmp[32];
 
 	blake2s_init(&bc, 32);
-	gls254_encode(tmp, R);
-	blake2s_update(&bc, tmp, 32);
+	blake2s_update(&bc, R_enc, 32);
 	blake2s_update(&bc, pub, 32);
 	if (hash_name == NULL || *hash_name == 0) {
 		tmp[0] = 0x52;
@@ -328,9 +836,29 @@ static const uint8_t MU[] = {
 	0x93, 0xBC, 0x54, 0x0F, 0xD0, 0xD0, 0xE6, 0x17
 };
 
-/* see gls254.h */
-void
-gls254_sign(void *sig, const gls254_private_key *sk,
+/*
+ * Convert a challenge (16 bytes) into the scalar c0 + mu*c1, with c0
+ * and c1 being the two 8-byte halves of the challenge.
+ */
+static void
+challenge_to_scalar(uint8_t *c, const uint8_t *cb)
+{
+	uint8_t d[32];
+
+	scalar_reduce(c, cb, 8);
+	scalar_reduce(d, cb + 8, 8);
+	scalar_mul(d, d, MU);
+	scalar_add(c, c, d);
+}
+
+/*
+ * Schnorr signature generation: the encoded R point (32 bytes), the
+ * challenge (16 bytes) and the s scalar (32 bytes) are written into
+ * R_enc, cb and s, respectively.
+ */
+static void
+sign_inner(uint8_t *R_enc, uint8_t *cb, uint8_t *s,
+	const gls254_private_key *sk,
 	const void *seed, size_t seed_len, const char *hash_name,
 	const void *data, size_t data_len)
 {
@@ -357,148 +885,951 @@ gls254_sign(void *sig, const gls254_private_key *sk,
 
 	/* Use k to generate the signature. */
 	gls254_point R;
-	uint8_t cb[16], c[32], d[32];
+	uint8_t c[32];
 	gls254_mulgen(&R, k);
-	make_challenge(cb, &R, sk->pub.enc, hash_name, data, data_len);
-	scalar_reduce(c, cb, 8);
-	scalar_reduce(d, cb + 8, 8);
-	scalar_mul(d, d, MU);
-	scalar_add(c, c, d);
+	gls254_encode(R_enc, &R);
+	make_challenge(cb, R_enc, sk->pub.enc, hash_name, data, data_len);
+	challenge_to_scalar(c, cb);
 	scalar_mul(c, c, sk->sec);
-	memcpy(sig, cb, 16);
-	scalar_add((uint8_t *)sig + 16, c, k);
+	scalar_add(s, c, k);
 }
 
-/*
- * Convenience wrapper for lookup + condneg.
- */
-static inline void
-gls254_lookup8_affine_sign(gls254_point_affine *p,
-	const gls254_point_affine *win, int8_t k, uint32_t sk)
+/* see gls254.h */
+void
+gls254_sign(void *sig, const gls254_private_key *sk,
+	const void *seed, size_t seed_len, const char *hash_name,
+	const void *data, size_t data_len)
 {
-	uint32_t uk = (uint32_t)k;
-	uk -= sk & (uk << 1);
-	gls254_lookup8_affine(p, win, (int8_t)*(int32_t *)&uk);
+	uint8_t R_enc[32];
+
+	sign_inner(R_enc, sig, (uint8_t *)sig + 16,
+		sk, seed, seed_len, hash_name, data, data_len);
 }
 
 /* see gls254.h */
-int
-gls254_verify_vartime(const gls254_public_key *pk, const void *sig,
-	const char *hash_name, const void *data, size_t data_len)
+void
+gls254_sign_ext(void *sig, const gls254_private_key *sk,
+	const void *seed, size_t seed_len, const char *hash_name,
+	const void *data, size_t data_len)
 {
-	// Reject cases with invalid public keys (the decode function
-	// maps invalid keys to the neutral, which is not valid as a key).
-	if (gls254_isneutral(&pk->pp) != 0) {
-		return 0;
-	}
-	const uint8_t *sigbuf = sig;
-	if (!scalar_is_reduced(sigbuf + 16)) {
-		return 0;
-	}
+	uint8_t cb[16];
 
-	gls254_point R, P;
-	uint8_t v0[16], v1[16];
-	int8_t sd0[16], sd1[16], sd2[32], sd3[32];
-	uint32_t t0, t1;
-	gls254_point_affine win[8], pa, qa;
+	sign_inner(sig, cb, (uint8_t *)sig + 32,
+		sk, seed, seed_len, hash_name, data, data_len);
+}
 
-	scalar_split(v0, &t0, v1, &t1, sigbuf + 16);
-	gls254_neg(&P, &pk->pp);
-	gls254_make_window_affine_8(win, &P);
-
-	uint32_t cc0 = recode4_u64(sd0, sigbuf);
-	uint32_t cc1 = recode4_u64(sd1, sigbuf + 8);
-	recode4_u128(sd2, v0);
-	recode4_u128(sd3, v1);
-
-	if (cc0 && cc1) {
-		gls254_zeta_affine(&pa, &win[0], 0);
-		gls254_add_affine_affine(&R, &win[0], &pa);
-	} else if (cc0) {
-		R = P;
-	} else if (cc1) {
-		gls254_zeta_affine(&pa, &win[0], 0);
-		gls254_from_affine(&R, &pa);
-	} else {
-		R = GLS254_NEUTRAL;
-	}
-
-	for (int i = 15; i >= 0; i --) {
-		gls254_xdouble(&R, &R, 4);
-
-		int8_t k0 = sd0[i], k1 = sd1[i];
-		if (k0 != 0 && k1 != 0) {
-			gls254_lookup8_affine(&pa, win, k0);
-			gls254_lookup8_affine_zeta(&qa, win, k1, 0);
-			gls254_add_affine_affine(&P, &pa, &qa);
-			gls254_add(&R, &R, &P);
-		} else if (k0 != 0) {
-			gls254_lookup8_affine(&pa, win, k0);
-			gls254_add_affine(&R, &R, &pa);
-		} else if (k1 != 0) {
-			gls254_lookup8_affine_zeta(&qa, win, k1, 0);
-			gls254_add_affine(&R, &R, &qa);
-		}
-
-		k0 = sd2[i];
-		k1 = sd2[i + 16];
-		if (k0 != 0 && k1 != 0) {
-			gls254_lookup8_affine_sign(&pa, PRECOMP_B, k0, t0);
-			gls254_lookup8_affine_sign(&qa, PRECOMP_B64, k1, t0);
-			gls254_add_affine_affine(&P, &pa, &qa);
-			gls254_add(&R, &R, &P);
-		} else if (k0 != 0) {
-			gls254_lookup8_affine_sign(&pa, PRECOMP_B, k0, t0);
-			gls254_add_affine(&R, &R, &pa);
-		} else if (k1 != 0) {
-			gls254_lookup8_affine_sign(&qa, PRECOMP_B64, k1, t0);
-			gls254_add_affine(&R, &R, &qa);
-		}
-
-		k0 = sd3[i];
-		k1 = sd3[i + 16];
-		if (k0 != 0 && k1 != 0) {
-			gls254_lookup8_affine_zeta(&pa, PRECOMP_B, k0, t1);
-			gls254_lookup8_affine_zeta(&qa, PRECOMP_B64, k1, t1);
-			gls254_add_affine_affine(&P, &pa, &qa);
-			gls254_add(&R, &R, &P);
-		} else if (k0 != 0) {
-			gls254_lookup8_affine_zeta(&pa, PRECOMP_B, k0, t1);
-			gls254_add_affine(&R, &R, &pa);
-		} else if (k1 != 0) {
-			gls254_lookup8_affine_zeta(&qa, PRECOMP_B64, k1, t1);
-			gls254_add_affine(&R, &R, &qa);
+/*
+ * Width-w NAF recoding (2 <= w <= 8) of an unsigned integer n (len
+ * bytes, little-endian, with len = 8 or 16; for len = 16, n must be
+ * lower than 2^127): digits are zero or odd values in the
+ * -(2^(w-1)-1)..+(2^(w-1)-1) range, and any two non-zero digits are
+ * separated by at least w-1 zeros. Output: 8*len+1 digits, low to high
+ * order. Returned value is the number of digits up to the last non-zero
+ * one. This is not constant-time.
+ */
+static int
+recode_wnaf_vartime(int8_t *sd, const uint8_t *n, size_t len, unsigned w)
+{
+	uint64_t lo, hi;
+	int nd, dlen;
+	int mask, half;
+
+	lo = 0;
+	hi = 0;
+	for (size_t i = 0; i < 8; i ++) {
+		lo |= (uint64_t)n[i] << (i << 3);
+	}
+	for (size_t i = 8; i < len; i ++) {
+		hi |= (uint64_t)n[i] << ((i - 8) << 3);
+	}
+	nd = (int)(len << 3) + 1;
+	mask = (1 << w) - 1;
+	half = 1 << (w - 1);
+	dlen = 0;
+	for (int i = 0; i < nd; i ++) {
+		int d = 0;
+
+		if (lo & 1) {
+			/* d <- x mods 2^w; x <- x - d (the low bits of
+			   x are d, so subtracting a positive d cannot
+			   borrow) */
+			d = (int)lo & mask;
+			if (d >= half) {
+				d -= mask + 1;
+				lo += (uint64_t)-d;
+				hi += lo < (uint64_t)-d;
+			} else {
+				lo -= (uint64_t)d;
+			}
+			dlen = i + 1;
 		}
+		sd[i] = (int8_t)d;
+		lo = (lo >> 1) | (hi << 63);
+		hi >>= 1;
 	}
-
-	uint8_t cb[16];
-	make_challenge(cb, &R, &pk->enc, hash_name, data, data_len);
-	return memcmp(sigbuf, cb, 16) == 0;
+	return dlen;
 }
 
-/* see gls254.h */
-int
-gls254_ECDH(void *shared_key, const gls254_private_key *sk,
-	const gls254_public_key *pk_peer)
+/*
+ * Fill win[i] with (2*i+1)*P (affine), for i = 0 to n-1 (n <= 16).
+ */
+static void
+make_window_odd_affine(gls254_point_affine *win, const gls254_point *p,
+	size_t n)
 {
-	// Set the "bad" flag to True if the peer key was invalid.
-	uint32_t bad = gls254_isneutral(&pk_peer->pp);
-
-	// Compute shared point.
-	uint8_t shared[32];
-	gls254_point p;
-	gls254_mul(&p, &pk_peer->pp, sk->sec);
-	gls254_encode(shared, &p);
+	gls254_point pp[16], p2;
 
-	// If the peer public key was bad, then use our private key
-	// as the "shared" secret instead. This will lead to an output
-	// key unguessable by outsiders, but will not otherwise leak
-	// whether the process worked or not.
-	for (int i = 0; i < 32; i ++) {
-		shared[i] ^= bad & (shared[i] ^ sk->sec[i]);
+	pp[0] = *p;
+	gls254_xdouble(&p2, p, 1);
+	for (size_t i = 1; i < n; i ++) {
+		gls254_add(&pp[i], &pp[i - 1], &p2);
 	}
+	gls254_normalize_batch(win, pp, n);
+}
 
-	// Key derivation with BLAKE2s.
+/*
+ * Get d*W from a window of odd multiples of W (as filled by
+ * make_window_odd_affine()), for an odd d; the point is negated if
+ * sd = 0xFFFFFFFF. This is a direct table access, for vartime code.
+ */
+static inline void
+lookup_odd_affine_vartime(gls254_point_affine *p,
+	const gls254_point_affine *win, int d, uint32_t sd)
+{
+	if (d > 0) {
+		*p = win[(d - 1) >> 1];
+	} else {
+		*p = win[(-d - 1) >> 1];
+		sd = ~sd;
+	}
+	if (sd) {
+		gfb254_add(&p->scaled_s, &p->scaled_s, &p->scaled_x);
+	}
+}
+
+/*
+ * A digit stream for interleaved wNAF evaluation: digit sd[i] (low to
+ * high, odd or zero, for i < len; further digits are zero) selects a
+ * multiple from table tw[] of odd multiples (1*W, 3*W, 5*W,...). The
+ * point is negated if sg is
+ * 0xFFFFFFFF; if uz is non-zero, then zeta is also applied (-zeta if zn
+ * is 0xFFFFFFFF).
+ */
+typedef struct {
+	const int8_t *sd;
+	int len;
+	const gls254_point_affine *tw;
+	uint32_t sg, zn;
+	int uz;
+} wnaf_stream;
+
+/*
+ * Set *R to the sum of the n digit streams st[]; top is the largest
+ * stream length. This is not constant-time.
+ */
+static void
+wnaf_streams_vartime(gls254_point *R, const wnaf_stream *st, int n,
+	int top)
+{
+	gls254_point acc;
+	gls254_point_affine pa;
+	unsigned pending;
+	int started;
+
+	/* Doublings are delayed until the next addition; doublings of
+	   the neutral are skipped. */
+	acc = GLS254_NEUTRAL;
+	pending = 0;
+	started = 0;
+	for (int i = top - 1; i >= 0; i --) {
+		if (started) {
+			pending ++;
+		}
+		for (int j = 0; j < n; j ++) {
+			int d;
+
+			if (i >= st[j].len || (d = st[j].sd[i]) == 0) {
+				continue;
+			}
+			if (pending != 0) {
+				gls254_xdouble(&acc, &acc, pending);
+				pending = 0;
+			}
+			lookup_odd_affine_vartime(&pa, st[j].tw, d, st[j].sg);
+			if (st[j].uz) {
+				gls254_zeta_affine(&pa, &pa, st[j].zn);
+			}
+			gls254_add_affine(&acc, &acc, &pa);
+			started = 1;
+		}
+	}
+	if (pending != 0) {
+		gls254_xdouble(&acc, &acc, pending);
+	}
+	*R = acc;
+}
+
+/*
+ * Set st[0] to st[3] to the digit streams for s*B, for a scalar s (32
+ * bytes, not necessarily reduced); the digits are written in sd[]. The
+ * scalar is split into s0 + mu*s1, and the low and high 64-bit halves
+ * of both parts use the static tables of odd multiples of B and 2^64*B
+ * (with zeta for s1), with width GLS254_VERIFY_GEN_WIN. Returned value
+ * is the number of digits up to the last non-zero one.
+ */
+static int
+gen_streams_vartime(wnaf_stream *st, int8_t (*sd)[65], const uint8_t *s)
+{
+	uint8_t v0[16], v1[16];
+	uint32_t t0, t1;
+	int top;
+
+	scalar_split(v0, &t0, v1, &t1, s);
+	top = 0;
+	for (int j = 0; j < 4; j ++) {
+		int len;
+
+		len = recode_wnaf_vartime(sd[j],
+			(j < 2 ? v0 : v1) + ((j & 1) << 3),
+			8, GLS254_VERIFY_GEN_WIN);
+		st[j].sd = sd[j];
+		st[j].len = len;
+		st[j].tw = (j & 1) ? PRECOMP_B64_ODD : PRECOMP_B_ODD;
+		st[j].sg = j < 2 ? t0 : 0;
+		st[j].zn = j < 2 ? 0 : t1;
+		st[j].uz = j >= 2;
+		if (len > top) {
+			top = len;
+		}
+	}
+	return top;
+}
+
+/*
+ * Compute R = s*B - c*P, for a challenge c (16 bytes, interpreted as
+ * c0 + mu*c1) and a scalar s (32 bytes, reduced). Window win[] contains
+ * the 2^(w-2) odd multiples of -P (as filled by make_window_odd_affine())
+ * for wNAF width w; if winz is not NULL, then it contains the images of
+ * these points by zeta (otherwise, zeta is applied on the fly). This is
+ * not constant-time.
+ */
+static void
+verify_core_vartime(gls254_point *R, const gls254_point_affine *win,
+	const gls254_point_affine *winz, unsigned w,
+	const uint8_t *cb, const uint8_t *s)
+{
+	wnaf_stream st[6];
+	int8_t sd[6][65];
+	int top;
+
+	/*
+	 * Six digit streams, each over a 64-bit chunk: c0 and c1 use
+	 * the window on -P (with zeta for c1); s uses the static tables
+	 * for B and 2^64*B (see gen_streams_vartime()).
+	 */
+	top = gen_streams_vartime(st + 2, sd + 2, s);
+	for (int j = 0; j < 2; j ++) {
+		int len;
+
+		len = recode_wnaf_vartime(sd[j], cb + (j << 3), 8, w);
+		st[j].sd = sd[j];
+		st[j].len = len;
+		st[j].tw = (j == 1 && winz != NULL) ? winz : win;
+		st[j].sg = 0;
+		st[j].zn = 0;
+		st[j].uz = j == 1 && winz == NULL;
+		if (len > top) {
+			top = len;
+		}
+	}
+	wnaf_streams_vartime(R, st, 6, top);
+}
+
+/*
+ * Compute R = s*B - c*P (see verify_core_vartime()), with a window on
+ * -P computed for this call. The public key must not be the neutral.
+ * This is not constant-time.
+ */
+static void
+verify_inner_vartime(gls254_point *R, const gls254_public_key *pk,
+	const uint8_t *cb, const uint8_t *s)
+{
+	gls254_point P;
+	gls254_point_affine win[1 << (GLS254_VERIFY_WIN - 2)];
+
+	gls254_neg(&P, &pk->pp);
+	make_window_odd_affine(win, &P, 1 << (GLS254_VERIFY_WIN - 2));
+	verify_core_vartime(R, win, NULL, GLS254_VERIFY_WIN, cb, s);
+}
+
+/* see gls254.h */
+int
+gls254_verify_vartime(const gls254_public_key *pk, const void *sig,
+	const char *hash_name, const void *data, size_t data_len)
+{
+	// Reject cases with invalid public keys (the decode function
+	// maps invalid keys to the neutral, which is not valid as a key).
+	if (gls254_isneutral(&pk->pp) != 0) {
+		return 0;
+	}
+	const uint8_t *sigbuf = sig;
+	if (!scalar_is_reduced(sigbuf + 16)) {
+		return 0;
+	}
+
+	gls254_point R;
+	uint8_t R_enc[32], cb[16];
+	verify_inner_vartime(&R, pk, sigbuf, sigbuf + 16);
+	gls254_encode(R_enc, &R);
+	make_challenge(cb, R_enc, &pk->enc, hash_name, data, data_len);
+	return memcmp(sigbuf, cb, 16) == 0;
+}
+
+/* see gls254.h */
+int
+gls254_verify_ext_vartime(const gls254_public_key *pk, const void *sig,
+	const char *hash_name, const void *data, size_t data_len)
+{
+	if (gls254_isneutral(&pk->pp) != 0) {
+		return 0;
+	}
+	const uint8_t *sigbuf = sig;
+	if (!scalar_is_reduced(sigbuf + 32)) {
+		return 0;
+	}
+
+	// With the extended format, R is known: we recompute the
+	// challenge from it, and R must then match s*B - c*P exactly.
+	gls254_point R;
+	uint8_t R_enc[32], cb[16];
+	make_challenge(cb, sigbuf, &pk->enc, hash_name, data, data_len);
+	verify_inner_vartime(&R, pk, cb, sigbuf + 32);
+	gls254_encode(R_enc, &R);
+	return memcmp(sigbuf, R_enc, 32) == 0;
+}
+
+/*
+ * wNAF width for the window in a verification context: 16 odd
+ * multiples of -P, followed by their images by zeta.
+ */
+#define VERIFY_CTX_WIN   6
+
+/* see gls254.h */
+void
+gls254_verify_context_init(gls254_verify_context *vc,
+	const gls254_public_key *pk)
+{
+	gls254_point P;
+
+	vc->pk = *pk;
+	if (gls254_isneutral(&pk->pp) != 0) {
+		return;
+	}
+	gls254_neg(&P, &pk->pp);
+	make_window_odd_affine(vc->win, &P, 1 << (VERIFY_CTX_WIN - 2));
+	for (int i = 0; i < (1 << (VERIFY_CTX_WIN - 2)); i ++) {
+		gls254_zeta_affine(&vc->win[i + (1 << (VERIFY_CTX_WIN - 2))],
+			&vc->win[i], 0);
+	}
+}
+
+/* see gls254.h */
+int
+gls254_verify_ctx_vartime(const gls254_verify_context *vc,
+	const void *sig, const char *hash_name,
+	const void *data, size_t data_len)
+{
+	if (gls254_isneutral(&vc->pk.pp) != 0) {
+		return 0;
+	}
+	const uint8_t *sigbuf = sig;
+	if (!scalar_is_reduced(sigbuf + 16)) {
+		return 0;
+	}
+
+	gls254_point R;
+	uint8_t R_enc[32], cb[16];
+	verify_core_vartime(&R, vc->win, vc->win + (1 << (VERIFY_CTX_WIN - 2)),
+		VERIFY_CTX_WIN, sigbuf, sigbuf + 16);
+	gls254_encode(R_enc, &R);
+	make_challenge(cb, R_enc, &vc->pk.enc, hash_name, data, data_len);
+	return memcmp(sigbuf, cb, 16) == 0;
+}
+
+/* see gls254.h */
+int
+gls254_verify_ext_ctx_vartime(const gls254_verify_context *vc,
+	const void *sig, const char *hash_name,
+	const void *data, size_t data_len)
+{
+	if (gls254_isneutral(&vc->pk.pp) != 0) {
+		return 0;
+	}
+	const uint8_t *sigbuf = sig;
+	if (!scalar_is_reduced(sigbuf + 32)) {
+		return 0;
+	}
+
+	gls254_point R;
+	uint8_t R_enc[32], cb[16];
+	make_challenge(cb, sigbuf, &vc->pk.enc, hash_name, data, data_len);
+	verify_core_vartime(&R, vc->win, vc->win + (1 << (VERIFY_CTX_WIN - 2)),
+		VERIFY_CTX_WIN, cb, sigbuf + 32);
+	gls254_encode(R_enc, &R);
+	return memcmp(sigbuf, R_enc, 32) == 0;
+}
+
+/*
+ * Fill win[8*i] to win[8*i + 7] with points 1*p[i] to 8*p[i] (affine),
+ * for i = 0 to n-1. Windows are computed two at a time, so that one
+ * inversion is shared by 16 points.
+ */
+static void
+make_windows_affine_8(gls254_point_affine *win, const gls254_point *p,
+	size_t n)
+{
+	while (n > 0) {
+		gls254_point pp[16];
+		size_t m;
+
+		m = n < 2 ? n : 2;
+		for (size_t j = 0; j < m; j ++) {
+			gls254_point *w = &pp[j << 3];
+
+			w[0] = p[j];
+			gls254_xdouble(&w[1], &p[j], 1);
+			gls254_add(&w[2], &w[1], &p[j]);
+			gls254_xdouble(&w[3], &w[1], 1);
+			gls254_add(&w[4], &w[2], &w[1]);
+			gls254_xdouble(&w[5], &w[2], 1);
+			gls254_add(&w[6], &w[4], &w[1]);
+			gls254_xdouble(&w[7], &w[3], 1);
+		}
+		gls254_normalize_batch(win, pp, m << 3);
+		win += m << 3;
+		p += m;
+		n -= m;
+	}
+}
+
+/* see gls254.h */
+void
+gls254_precompute_point(gls254_precomputed_point *pp, const gls254_point *p)
+{
+	gls254_point b[4];
+
+	b[0] = *p;
+	for (int j = 1; j < 4; j ++) {
+		gls254_xdouble(&b[j], &b[j - 1], 32);
+	}
+	make_windows_affine_8(pp->tab, b, 4);
+}
+
+/* see gls254.h */
+void
+gls254_mul_precomputed(gls254_point *q, const gls254_precomputed_point *pp,
+	const void *k)
+{
+	gls254_scalar_recoded sr;
+
+	gls254_scalar_recode(&sr, k);
+	mul_comb(q, pp->tab, 4, &sr);
+}
+
+/*
+ * Get k*W from the window win[] built over point W, for a non-zero k
+ * in the -8..+8 range; the point is negated if sk = 0xFFFFFFFF. This
+ * is a direct table access, for vartime code.
+ */
+static inline void
+lookup8_affine_vartime(gls254_point_affine *p,
+	const gls254_point_affine *win, int8_t k, uint32_t sk)
+{
+	if (k > 0) {
+		*p = win[k - 1];
+	} else {
+		*p = win[-k - 1];
+		sk = ~sk;
+	}
+	if (sk) {
+		gfb254_add(&p->scaled_s, &p->scaled_s, &p->scaled_x);
+	}
+}
+
+/*
+ * Add k0*W + k1*zeta(W) to *R, with W being the point used to build
+ * window win[]; k0 is negated if s0 = 0xFFFFFFFF, and k1 is negated if
+ * s1 = 0xFFFFFFFF. This is not constant-time.
+ */
+static void
+add_pair_vartime(gls254_point *R, const gls254_point_affine *win,
+	int8_t k0, uint32_t s0, int8_t k1, uint32_t s1)
+{
+	gls254_point_affine pa, qa;
+	gls254_point t;
+
+	if (k0 != 0 && k1 != 0) {
+		lookup8_affine_vartime(&pa, win, k0, s0);
+		lookup8_affine_vartime(&qa, win, k1, 0);
+		gls254_zeta_affine(&qa, &qa, s1);
+		gls254_add_affine_affine(&t, &pa, &qa);
+		gls254_add(R, R, &t);
+	} else if (k0 != 0) {
+		lookup8_affine_vartime(&pa, win, k0, s0);
+		gls254_add_affine(R, R, &pa);
+	} else if (k1 != 0) {
+		lookup8_affine_vartime(&qa, win, k1, 0);
+		gls254_zeta_affine(&qa, &qa, s1);
+		gls254_add_affine(R, R, &qa);
+	}
+}
+
+/*
+ * Combined check of n extended signatures (n <= BATCH_CHUNK). On input,
+ * ok[i] is 1 for the signatures that passed the format checks (decoded
+ * R in *R_neg, negated; public key distinct from the neutral; s is
+ * reduced) with challenge cb[i], and 0 for the others, which are
+ * ignored. Returned value is 1 if the check succeeds, 0 otherwise.
+ *
+ * With 128-bit weights z[i], this verifies that:
+ *    (\sum z[i]*s[i])*B - \sum (z[i]*c[i])*P[i] - \sum z[i]*R[i] = 0
+ * Weighted challenges for the same public key are merged into a
+ * single term.
+ */
+static int
+verify_batch_chunk(const gls254_verify_item *items, const uint32_t *ok,
+	const gls254_point *R_neg, const uint8_t (*cb)[16],
+	const uint8_t *seed, size_t n)
+{
+	gls254_point Q[2 * BATCH_CHUNK], acc;
+	gls254_point_affine win[2 * BATCH_CHUNK * 8];
+	const gls254_public_key *kp[BATCH_CHUNK];
+	uint8_t z[BATCH_CHUNK][16], a[BATCH_CHUNK][32], g[32];
+	int8_t sdz[BATCH_CHUNK][32], sdk[BATCH_CHUNK][2][32], sdg[2][32];
+	uint32_t sgk[BATCH_CHUNK][2], sgg[2];
+	size_t m, nk;
+
+	memset(g, 0, sizeof g);
+	m = 0;
+	nk = 0;
+	for (size_t i = 0; i < n; i ++) {
+		const uint8_t *sigbuf;
+		uint8_t zs[32], c[32];
+		blake2s_context bc;
+		size_t j;
+
+		if (!ok[i]) {
+			continue;
+		}
+		sigbuf = items[i].sig;
+
+		/* z <- 128-bit weight, derived from the seed */
+		blake2s_init_key(&bc, 16, seed, 32);
+		zs[0] = (uint8_t)i;
+		blake2s_update(&bc, zs, 1);
+		blake2s_final(&bc, z[m]);
+		memcpy(zs, z[m], 16);
+		memset(zs + 16, 0, 16);
+
+		/* g <- g + z*s */
+		scalar_mul(c, zs, sigbuf + 32);
+		scalar_add(g, g, c);
+
+		/* a <- a + z*c, for the term of that public key */
+		challenge_to_scalar(c, cb[i]);
+		scalar_mul(c, c, zs);
+		for (j = 0; j < nk; j ++) {
+			if (memcmp(kp[j]->enc, items[i].pk->enc, 32) == 0) {
+				break;
+			}
+		}
+		if (j == nk) {
+			kp[nk ++] = items[i].pk;
+			memcpy(a[j], c, 32);
+		} else {
+			scalar_add(a[j], a[j], c);
+		}
+
+		Q[m ++] = R_neg[i];
+	}
+	if (m == 0) {
+		return 1;
+	}
+
+	/* Q[0..m-1] are the -R[i], Q[m..m+nk-1] are the -P[j]. */
+	for (size_t j = 0; j < nk; j ++) {
+		gls254_neg(&Q[m + j], &kp[j]->pp);
+	}
+	make_windows_affine_8(win, Q, m + nk);
+
+	/* Weights may use 128 bits; the recoding carry (2^128) is
+	   applied by starting with the corresponding point. */
+	acc = GLS254_NEUTRAL;
+	for (size_t j = 0; j < m; j ++) {
+		if (recode4_u128(sdz[j], z[j])) {
+			gls254_add(&acc, &acc, &Q[j]);
+		}
+	}
+	for (size_t j = 0; j < nk; j ++) {
+		uint8_t k0[16], k1[16];
+
+		scalar_split(k0, &sgk[j][0], k1, &sgk[j][1], a[j]);
+		recode4_u128(sdk[j][0], k0);
+		recode4_u128(sdk[j][1], k1);
+	}
+	{
+		uint8_t k0[16], k1[16];
+
+		scalar_split(k0, &sgg[0], k1, &sgg[1], g);
+		recode4_u128(sdg[0], k0);
+		recode4_u128(sdg[1], k1);
+	}
+
+	for (int i = 31; i >= 0; i --) {
+		gls254_xdouble(&acc, &acc, 4);
+		add_pair_vartime(&acc, PRECOMP_B,
+			sdg[0][i], sgg[0], sdg[1][i], sgg[1]);
+		for (size_t j = 0; j < nk; j ++) {
+			add_pair_vartime(&acc, &win[(m + j) << 3],
+				sdk[j][0][i], sgk[j][0],
+				sdk[j][1][i], sgk[j][1]);
+		}
+		for (size_t j = 0; j < m; j ++) {
+			if (sdz[j][i] != 0) {
+				gls254_point_affine pa;
+
+				lookup8_affine_vartime(&pa,
+					&win[j << 3], sdz[j][i], 0);
+				gls254_add_affine(&acc, &acc, &pa);
+			}
+		}
+	}
+	return gls254_isneutral(&acc) != 0;
+}
+
+/* see gls254.h */
+int
+gls254_verify_batch_vartime(uint8_t *valid,
+	const gls254_verify_item *items, size_t num,
+	const void *rnd, size_t rnd_len)
+{
+	uint32_t all = 1;
+	size_t k = 0;
+
+	if (valid != NULL) {
+		memset(valid, 0, (num + 7) >> 3);
+	}
+	while (num > 0) {
+		gls254_point R_neg[BATCH_CHUNK];
+		uint8_t R_enc[BATCH_CHUNK * 32], cb[BATCH_CHUNK][16];
+		uint8_t seed[32], tmp[8];
+		uint32_t ok[BATCH_CHUNK];
+		blake2s_context bc;
+		size_t n;
+
+		n = num < BATCH_CHUNK ? num : BATCH_CHUNK;
+
+		/* Decode all R points, and verify formats. */
+		for (size_t i = 0; i < n; i ++) {
+			memcpy(R_enc + (i << 5), items[i].sig, 32);
+		}
+		decode_chunk(R_neg, ok, R_enc, n);
+
+		/* The weights are derived from a hash of the caller's
+		   randomness and all inputs (keys, signatures, and
+		   challenges, which cover the messages). */
+		blake2s_init(&bc, 32);
+		blake2s_update(&bc, "GLS254 batch verify:", 20);
+		enc32le(tmp, (uint32_t)rnd_len);
+		enc32le(tmp + 4, (uint32_t)((uint64_t)rnd_len >> 32));
+		blake2s_update(&bc, tmp, 8);
+		blake2s_update(&bc, rnd, rnd_len);
+		for (size_t i = 0; i < n; i ++) {
+			const gls254_verify_item *it = &items[i];
+			const uint8_t *sigbuf = it->sig;
+
+			ok[i] &= (gls254_isneutral(&it->pk->pp) == 0)
+				& scalar_is_reduced(sigbuf + 32);
+			if (!ok[i]) {
+				continue;
+			}
+			gls254_neg(&R_neg[i], &R_neg[i]);
+			make_challenge(cb[i], sigbuf, it->pk->enc,
+				it->hash_name, it->data, it->data_len);
+			blake2s_update(&bc, it->pk->enc, 32);
+			blake2s_update(&bc, sigbuf, 64);
+			blake2s_update(&bc, cb[i], 16);
+		}
+		blake2s_final(&bc, seed);
+
+		/* If the combined check fails, then at least one signature
+		   is invalid; verify them one by one to find which. */
+		if (!verify_batch_chunk(items, ok, R_neg,
+			(const uint8_t (*)[16])cb, seed, n))
+		{
+			for (size_t i = 0; i < n; i ++) {
+				const gls254_verify_item *it = &items[i];
+
+				if (ok[i]) {
+					ok[i] = gls254_verify_ext_vartime(
+						it->pk, it->sig, it->hash_name,
+						it->data, it->data_len);
+				}
+			}
+		}
+		for (size_t i = 0; i < n; i ++) {
+			if (valid != NULL) {
+				valid[k >> 3] |= (uint8_t)(ok[i] << (k & 7));
+			}
+			all &= ok[i];
+			k ++;
+		}
+		items += n;
+		num -= n;
+	}
+	return (int)all;
+}
+
+/*
+ * Interleaved-window (Straus) multi-scalar multiplication handles at
+ * most that many points at a time; larger inputs are processed by
+ * groups of that size.
+ */
+#define STRAUS_MAX   16
+
+/* see gls254.h */
+void
+gls254_mul_multi(gls254_point *q, const gls254_point *p,
+	const void *k, size_t num)
+{
+	const uint8_t *kb = k;
+	gls254_point r;
+
+	/*
+	 * Same algorithm as gls254_mul(), with a single chain of
+	 * doublings shared by all points.
+	 */
+	r = GLS254_NEUTRAL;
+	while (num > 0) {
+		gls254_point_affine win[STRAUS_MAX * 8], pa, qa;
+		gls254_point pn[STRAUS_MAX], acc, t;
+		gls254_scalar_recoded sr[STRAUS_MAX];
+		size_t n;
+
+		n = num < STRAUS_MAX ? num : STRAUS_MAX;
+		for (size_t j = 0; j < n; j ++) {
+			gls254_scalar_recode(&sr[j], kb + (j << 5));
+			gls254_condneg(&pn[j], &p[j], sr[j].s0);
+		}
+		make_windows_affine_8(win, pn, n);
+
+		acc = GLS254_NEUTRAL;
+		for (int i = 31; i >= 0; i --) {
+			if (i != 31) {
+				gls254_xdouble(&acc, &acc, 4);
+			}
+			for (size_t j = 0; j < n; j ++) {
+				gls254_lookup8_affine(&pa,
+					&win[j << 3], sr[j].sd0[i]);
+				gls254_lookup8_affine_zeta(&qa,
+					&win[j << 3], sr[j].sd1[i], sr[j].zn);
+				gls254_add_affine_affine(&t, &pa, &qa);
+				gls254_add(&acc, &acc, &t);
+			}
+		}
+		gls254_add(&r, &r, &acc);
+
+		p += n;
+		kb += n << 5;
+		num -= n;
+	}
+	*q = r;
+}
+
+/*
+ * Split scalar k (32 bytes) into half-size scalars and recode them in
+ * width-4 NAF: sd[0][] and sd[1][] receive the digits of k0 and k1,
+ * and sg[0] and sg[1] their signs (as in scalar_split()). Returned value
+ * is the number of digits up to the last non-zero one.
+ */
+static int
+split_wnaf4_vartime(int8_t (*sd)[129], uint32_t *sg, const uint8_t *k)
+{
+	uint8_t n0[16], n1[16];
+	int len0, len1;
+
+	scalar_split(n0, &sg[0], n1, &sg[1], k);
+	len0 = recode_wnaf_vartime(sd[0], n0, 16, 4);
+	len1 = recode_wnaf_vartime(sd[1], n1, 16, 4);
+	return len0 > len1 ? len0 : len1;
+}
+
+/*
+ * Interleaved evaluation of n terms with width-4 NAF digits: *q is set
+ * to the sum, for j = 0 to n-1, of k0_j*W_j + k1_j*zeta(W_j), where
+ * W_j is the point used to build window win[j] (1*W_j to 8*W_j), and
+ * k0_j and k1_j are given by sd[j][] and sg[j][] as obtained from
+ * split_wnaf4_vartime(). Digits at indices top and above must be zero.
+ * This is not constant-time.
+ */
+static void
+straus_wnaf4_vartime(gls254_point *q, const gls254_point_affine *const *win,
+	int8_t (*sd)[2][129], uint32_t (*sg)[2], size_t n, int top)
+{
+	gls254_point acc;
+	unsigned pending;
+	int started;
+
+	/* Doublings are delayed until the next addition, so that runs
+	   of zero digits use a single gls254_xdouble() call; doublings
+	   of the neutral are skipped. */
+	acc = GLS254_NEUTRAL;
+	pending = 0;
+	started = 0;
+	for (int i = top - 1; i >= 0; i --) {
+		if (started) {
+			pending ++;
+		}
+		for (size_t j = 0; j < n; j ++) {
+			int8_t d0 = sd[j][0][i], d1 = sd[j][1][i];
+
+			if (d0 == 0 && d1 == 0) {
+				continue;
+			}
+			if (pending != 0) {
+				gls254_xdouble(&acc, &acc, pending);
+				pending = 0;
+			}
+			add_pair_vartime(&acc, win[j],
+				d0, sg[j][0], d1, sg[j][1]);
+			started = 1;
+		}
+	}
+	if (pending != 0) {
+		gls254_xdouble(&acc, &acc, pending);
+	}
+	*q = acc;
+}
+
+/* see gls254.h */
+void
+gls254_mul_multi_vartime(gls254_point *q, const gls254_point *p,
+	const void *k, size_t num)
+{
+	const uint8_t *kb = k;
+	gls254_point r;
+
+	r = GLS254_NEUTRAL;
+	while (num > 0) {
+		gls254_point_affine win[STRAUS_MAX * 8];
+		const gls254_point_affine *wp[STRAUS_MAX];
+		gls254_point acc;
+		int8_t sd[STRAUS_MAX][2][129];
+		uint32_t sg[STRAUS_MAX][2];
+		int top;
+		size_t n;
+
+		n = num < STRAUS_MAX ? num : STRAUS_MAX;
+		top = 0;
+		for (size_t j = 0; j < n; j ++) {
+			int len;
+
+			len = split_wnaf4_vartime(sd[j], sg[j], kb + (j << 5));
+			top = len > top ? len : top;
+			wp[j] = &win[j << 3];
+		}
+		make_windows_affine_8(win, p, n);
+		straus_wnaf4_vartime(&acc, wp, sd, sg, n, top);
+		gls254_add(&r, &r, &acc);
+
+		p += n;
+		kb += n << 5;
+		num -= n;
+	}
+	*q = r;
+}
+
+/* see gls254.h */
+void
+gls254_mul2_vartime(gls254_point *q,
+	const gls254_point *p1, const void *u,
+	const gls254_point *p2, const void *v)
+{
+	gls254_point pp[2];
+	uint8_t kk[64];
+
+	pp[0] = *p1;
+	pp[1] = *p2;
+	memcpy(kk, u, 32);
+	memcpy(kk + 32, v, 32);
+	gls254_mul_multi_vartime(q, pp, kk, 2);
+}
+
+/*
+ * wNAF width for the point in gls254_mul_add_gen_vartime(). Its split
+ * scalar halves are 128 bits each (unlike the 64-bit challenge halves in
+ * signature verification), so a larger window than for verification
+ * pays off.
+ */
+#define MUL_ADD_GEN_WIN   5
+
+/* see gls254.h */
+void
+gls254_mul_add_gen_vartime(gls254_point *q,
+	const gls254_point *p, const void *u, const void *v)
+{
+	gls254_point_affine win[1 << (MUL_ADD_GEN_WIN - 2)];
+	wnaf_stream st[6];
+	int8_t sdg[4][65], sdp[2][129];
+	uint8_t n0[16], n1[16];
+	uint32_t s0, s1;
+	int top;
+
+	/*
+	 * The generator uses the same streams and static tables as
+	 * signature verification; the two halves of u use a window of
+	 * odd multiples of P (with zeta for u1).
+	 */
+	top = gen_streams_vartime(st + 2, sdg, v);
+	scalar_split(n0, &s0, n1, &s1, u);
+	make_window_odd_affine(win, p, 1 << (MUL_ADD_GEN_WIN - 2));
+	for (int j = 0; j < 2; j ++) {
+		int len;
+
+		len = recode_wnaf_vartime(sdp[j], j == 0 ? n0 : n1,
+			16, MUL_ADD_GEN_WIN);
+		st[j].sd = sdp[j];
+		st[j].len = len;
+		st[j].tw = win;
+		st[j].sg = j == 0 ? s0 : 0;
+		st[j].zn = j == 0 ? 0 : s1;
+		st[j].uz = j == 1;
+		if (len > top) {
+			top = len;
+		}
+	}
+	wnaf_streams_vartime(q, st, 6, top);
+}
+
+/*
+ * Finish an ECDH: derive the shared key from the encoded shared point
+ * (shared[], 32 bytes, modified). If bad is 0xFFFFFFFF (invalid peer
+ * key), then the private key is used instead of the shared point.
+ * Returned value is 1 on success, 0 if the peer key was invalid.
+ */
+static int
+ecdh_finish(void *shared_key, const gls254_private_key *sk,
+	const gls254_public_key *pk_peer, uint8_t *shared, uint32_t bad)
+{
+	// If the peer public key was bad, then use our private key
+	// as the "shared" secret instead. This will lead to an output
+	// key unguessable by outsiders, but will not otherwise leak
+	// whether the process worked or not.
+	for (int i = 0; i < 32; i ++) {
+		shared[i] ^= bad & (shared[i] ^ sk->sec[i]);
+	}
+
+	// Key derivation with BLAKE2s.
 	// We order the two public keys lexicographically.
 	uint8_t tmp[64];
 	uint32_t cc = 0;
@@ -524,6 +1855,138 @@ gls254_ECDH(void *shared_key, const gls254_private_key *sk,
 	return (int)(bad + 1);
 }
 
+/* see gls254.h */
+int
+gls254_ECDH(void *shared_key, const gls254_private_key *sk,
+	const gls254_public_key *pk_peer)
+{
+	// Set the "bad" flag to True if the peer key was invalid.
+	uint32_t bad = gls254_isneutral(&pk_peer->pp);
+
+	// Compute shared point.
+	uint8_t shared[32];
+	gls254_point p;
+	gls254_mul(&p, &pk_peer->pp, sk->sec);
+	gls254_encode(shared, &p);
+	return ecdh_finish(shared_key, sk, pk_peer, shared, bad);
+}
+
+/* see gls254.h */
+int
+gls254_ECDH_recoded(void *shared_key, const gls254_private_key *sk,
+	const gls254_scalar_recoded *sr, const gls254_public_key *pk_peer)
+{
+	uint32_t bad = gls254_isneutral(&pk_peer->pp);
+	uint8_t shared[32];
+	gls254_point p;
+	gls254_mul_recoded(&p, &pk_peer->pp, sr);
+	gls254_encode(shared, &p);
+	return ecdh_finish(shared_key, sk, pk_peer, shared, bad);
+}
+
+/* see gls254.h */
+int
+gls254_ECDH_precomputed(void *shared_key, const gls254_private_key *sk,
+	const gls254_public_key *pk_peer, const gls254_precomputed_point *pp)
+{
+	uint32_t bad = gls254_isneutral(&pk_peer->pp);
+	uint8_t shared[32];
+	gls254_point p;
+	gls254_mul_precomputed(&p, pp, sk->sec);
+	gls254_encode(shared, &p);
+	return ecdh_finish(shared_key, sk, pk_peer, shared, bad);
+}
+
+/* see gls254.h */
+int
+gls254_ECDH_batch(void *shared_keys, uint8_t *valid,
+	const gls254_private_key *sk, const gls254_public_key *pk_peers,
+	size_t num)
+{
+	uint8_t *out = shared_keys;
+	gls254_scalar_recoded sr;
+	const int8_t *sd0 = sr.sd0, *sd1 = sr.sd1;
+	uint32_t zn, all;
+	size_t k;
+
+	/* The private scalar is split and recoded only once. */
+	gls254_scalar_recode(&sr, sk->sec);
+	zn = sr.zn;
+
+	if (valid != NULL) {
+		memset(valid, 0, (num + 7) >> 3);
+	}
+	all = 0xFFFFFFFF;
+	k = 0;
+	while (num > 0) {
+		gls254_point_affine win[BATCH_CHUNK * 8], pa, qa;
+		gls254_point pn[BATCH_CHUNK], t[4];
+		uint8_t shared[BATCH_CHUNK * 32];
+		size_t n;
+
+		n = num < BATCH_CHUNK ? num : BATCH_CHUNK;
+
+		/* Windows over P or -P (sign of n0), as in gls254_mul(),
+		   with inversions shared between peers. */
+		for (size_t j = 0; j < n; j ++) {
+			gls254_condneg(&pn[j], &pk_peers[j].pp, sr.s0);
+		}
+		make_windows_affine_8(win, pn, n);
+
+		/*
+		 * Same algorithm as gls254_mul_batch(), with four peers
+		 * advancing in lockstep; the last group is padded with
+		 * copies of the first window (results are ignored).
+		 */
+		for (size_t j0 = 0; j0 < n; j0 += 4) {
+			const gls254_point_affine *w[4];
+			gls254_point acc[4];
+
+			for (size_t j = 0; j < 4; j ++) {
+				w[j] = &win[(j0 + j < n ? j0 + j : j0) << 3];
+				gls254_lookup8_affine(&pa, w[j], sd0[31]);
+				gls254_lookup8_affine(&qa, w[j], sd1[31]);
+				gls254_zeta_affine(&qa, &qa, zn);
+				gls254_add_affine_affine(&acc[j], &pa, &qa);
+			}
+			for (int i = 30; i >= 0; i --) {
+				gls254_xdouble_x4(acc, acc, 4);
+				for (int j = 0; j < 4; j ++) {
+					gls254_lookup8_affine(&pa, w[j], sd0[i]);
+					gls254_lookup8_affine(&qa, w[j], sd1[i]);
+					gls254_zeta_affine(&qa, &qa, zn);
+					gls254_add_affine_affine(&t[j],
+						&pa, &qa);
+				}
+				gls254_add_x4(acc, acc, t);
+			}
+			for (size_t j = 0; j < 4 && j0 + j < n; j ++) {
+				pn[j0 + j] = acc[j];
+			}
+		}
+
+		/* One inversion for all shared points of the chunk. */
+		gls254_encode_batch(shared, pn, n);
+		for (size_t j = 0; j < n; j ++) {
+			uint32_t bad;
+
+			bad = gls254_isneutral(&pk_peers[j].pp);
+			ecdh_finish(out + (j << 5), sk, &pk_peers[j],
+				shared + (j << 5), bad);
+			if (valid != NULL) {
+				valid[k >> 3] |=
+					(uint8_t)((~bad & 1) << (k & 7));
+			}
+			all &= ~bad;
+			k ++;
+		}
+		out += n << 5;
+		pk_peers += n;
+		num -= n;
+	}
+	return (int)(all & 1);
+}
+
 /* see gls254.h */
 int
 gls254_raw_ECDH(void *dst, const void *src, const void *scalar)
@@ -552,182 +2015,5 @@ gls254_raw_ECDH(void *dst, const void *src, const void *scalar)
 	return 1;
 }
 
-/* TODO: move the precomputed points to the assembly file?
-   Contrary to the rest of this file, they depend on the actual in-memory
-   format of points. */
-
-/* Point i*B for i = 1 to 8, affine format (scaled_x, scaled_s) */
-static const gls254_point_affine PRECOMP_B[] = {
-	// B * 1
-	{ { { { { 0x326B8675, 0xB6412F20, 0x9AE29894, 0x657CB9F7 } },
-	      { { 0xF66DD010, 0x3932450F, 0xB2E3915E, 0x14C6F62C } } } },
-	  { { { { 0x023DC896, 0x5FADCA04, 0xA04300F1, 0x763522AD } },
-	      { { 0x9E07345A, 0x206E4C1E, 0x2381CA6D, 0x4F69A66A } } } } },
-	// B * 2
-	{ { { { { 0xD693FA8F, 0x415A7930, 0xDF2F1CA6, 0x1D78874E } },
-	      { { 0xDAE036F7, 0xF61DEA7C, 0xE5F279EA, 0x4B30C0F5 } } } },
-	  { { { { 0xFBD6BE01, 0xC19ED043, 0x6ABE9465, 0x693D8F2F } },
-	      { { 0xD452AB50, 0x0F2F0D9C, 0x0A6EE21C, 0x19720E49 } } } } },
-	// B * 3
-	{ { { { { 0x1889FE19, 0x0BC57355, 0x1393238B, 0x665C451B } },
-	      { { 0x27CA6F4D, 0xE053B1D0, 0x34043EA7, 0x5C27A07D } } } },
-	  { { { { 0xA1F56BB6, 0xFE1E7723, 0x7D15931D, 0x7B780510 } },
-	      { { 0xE184E5DF, 0xAE7D87EF, 0xF11925D5, 0x0F6F5F4E } } } } },
-	// B * 4
-	{ { { { { 0x06C9A0C8, 0xA11DB5F2, 0xC72A3AB3, 0x061309D0 } },
-	      { { 0xEED4F57B, 0x91999BBE, 0xC3C0D1DA, 0x77F10DBD } } } },
-	  { { { { 0x812A13C2, 0x38EE9EC6, 0x9DCA6BB5, 0x77FBC24A } },
-	      { { 0xC034074B, 0x181DB8C3, 0xA8E44BBD, 0x6D296D30 } } } } },
-	// B * 5
-	{ { { { { 0xCF1FAB5F, 0xC715B038, 0x610AD947, 0x0DA235C1 } },
-	      { { 0x7E52B936, 0xD3AC0FF5, 0x42EA1434, 0x7094DAC3 } } } },
-	  { { { { 0x32462848, 0x06A589BB, 0x1566BBAF, 0x0F876725 } },
-	      { { 0x17C2DAAB, 0x9F808AC9, 0x55FE4D2C, 0x32B14A68 } } } } },
-	// B * 6
-	{ { { { { 0x2FEA71F8, 0xB210B545, 0x921194F5, 0x14D11ED1 } },
-	      { { 0x4E3E4518, 0x476FF44B, 0x007A5A24, 0x6F68AAC2 } } } },
-	  { { { { 0x43C891FA, 0x57BE3BF0, 0x548C5D6C, 0x4F28EEAF } },
-	      { { 0xE898732D, 0x72895485, 0xB3EB369B, 0x5683B98C } } } } },
-	// B * 7
-	{ { { { { 0xA16EAC69, 0x1F6121CE, 0xBC02778C, 0x19EB28FD } },
-	      { { 0xB2803207, 0x0E86728B, 0xD9893789, 0x03E9B9FC } } } },
-	  { { { { 0x7604ABE1, 0x13DE2DAE, 0xA6611933, 0x5121D6B7 } },
-	      { { 0x9644C754, 0xAFC835F3, 0xE19E6CB3, 0x0A1F6E2D } } } } },
-	// B * 8
-	{ { { { { 0xF80BD001, 0xCDCB2821, 0xC02477B7, 0x4D1FCC11 } },
-	      { { 0x237C442C, 0x2A6A17AF, 0xD4D6114C, 0x1301DB82 } } } },
-	  { { { { 0x44C7077A, 0x83CF1AA2, 0xBC942DCB, 0x327AC316 } },
-	      { { 0x8D0BBFA4, 0xAA4C2E84, 0x2A0788B2, 0x235DF1F9 } } } } }
-};
-
-/* Point i*(2^32)*B for i = 1 to 8, affine format (scaled_x, scaled_s) */
-static const gls254_point_affine PRECOMP_B32[] = {
-	// (2^32)*B * 1
-	{ { { { { 0x4DDB30B8, 0x63557581, 0x5030FA03, 0x5B61982B } },
-	      { { 0x22FC0A21, 0x11DFBA3C, 0x0F317C69, 0x59B8AAF2 } } } },
-	  { { { { 0x4BA656F7, 0x24CCD3E5, 0x8F12A690, 0x75E44943 } },
-	      { { 0x83593FAD, 0x35A7574A, 0xD281984B, 0x605B7617 } } } } },
-	// (2^32)*B * 2
-	{ { { { { 0x63E928F5, 0x90CF4E35, 0x5223D2E7, 0x50074E81 } },
-	      { { 0x354B113C, 0x5C404A45, 0xC8167241, 0x0FA6E6AE } } } },
-	  { { { { 0x6DA726AA, 0xA1301F5B, 0x36FADE6F, 0x417E796A } },
-	      { { 0xA030F951, 0x132B507C, 0x27837BD6, 0x1B059582 } } } } },
-	// (2^32)*B * 3
-	{ { { { { 0xBD1848ED, 0x3EB8194B, 0xA973E23F, 0x49233033 } },
-	      { { 0x9659B3C6, 0x162E3AC5, 0xCF1B0A47, 0x55D7E164 } } } },
-	  { { { { 0x50D0746F, 0x8408AE6F, 0xDA5B5D8C, 0x54B1EF88 } },
-	      { { 0xE0266218, 0xBEEF1BC0, 0x31BD68F4, 0x47AEBA16 } } } } },
-	// (2^32)*B * 4
-	{ { { { { 0xFEBCA318, 0xACDCDE13, 0x6F23CA1C, 0x2054A068 } },
-	      { { 0x9A944830, 0x4FC664CE, 0x5CC70929, 0x0EE62762 } } } },
-	  { { { { 0xF712C3D2, 0x10FFCF13, 0x378DADCF, 0x7AEF8651 } },
-	      { { 0x3A88BB41, 0x83BF078A, 0xED94CCB7, 0x6540AA59 } } } } },
-	// (2^32)*B * 5
-	{ { { { { 0x548A5B5C, 0xC3A9CDF7, 0x09251988, 0x7CC55823 } },
-	      { { 0x1D8FB1B6, 0x359CFD6F, 0xAEBB6DFE, 0x16617EA6 } } } },
-	  { { { { 0x3B570A8D, 0x5402D084, 0xDDCA45AF, 0x72E1B8FC } },
-	      { { 0x6A5F05AF, 0x8E894715, 0x4943A009, 0x47E972B5 } } } } },
-	// (2^32)*B * 6
-	{ { { { { 0x9D224CE8, 0x21ED4996, 0xF0314FFD, 0x502BF009 } },
-	      { { 0x29EDEB9F, 0x378AD19D, 0x0F08EA14, 0x217F953E } } } },
-	  { { { { 0x58AA005F, 0xFBEACAA8, 0xB084D2E9, 0x5C3956EA } },
-	      { { 0x9C0AF3DD, 0x02FFF925, 0x4DA7B8F3, 0x2E6C4558 } } } } },
-	// (2^32)*B * 7
-	{ { { { { 0xA435418E, 0xEFE3D1C9, 0x78B4B863, 0x29220A41 } },
-	      { { 0xAB5842A9, 0xF43A2709, 0x40A92711, 0x0C7C4F15 } } } },
-	  { { { { 0x7D638424, 0x1C6B7791, 0x16ED213B, 0x611353A7 } },
-	      { { 0x4BC271D7, 0x64291F07, 0x1D26E566, 0x65DD7EC4 } } } } },
-	// (2^32)*B * 8
-	{ { { { { 0xC194ECC9, 0x9B4DA61D, 0xCA8836CF, 0x7CB707BD } },
-	      { { 0xD4BFFDF2, 0x77ACDF95, 0xD3A61F80, 0x36586184 } } } },
-	  { { { { 0xC2CE8B3D, 0xCDAA62F1, 0x824B839B, 0x10B26E50 } },
-	      { { 0x667C1F45, 0xFC7E3B92, 0x267FACD9, 0x27F128AB } } } } }
-};
-
-/* Point i*(2^64)*B for i = 1 to 8, affine format (scaled_x, scaled_s) */
-static const gls254_point_affine PRECOMP_B64[] = {
-	// (2^64)*B * 1
-	{ { { { { 0x4D3AE7AC, 0x26123159, 0x28CEB8AD, 0x082A5BBF } },
-	      { { 0x83030F30, 0xD959B911, 0x5AF1898E, 0x4447B9E0 } } } },
-	  { { { { 0x4D3DE629, 0x2C7A5450, 0xA6F9484C, 0x431796A3 } },
-	      { { 0xE5D3C8CD, 0x357D7D22, 0xE5323C2E, 0x147CCFFB } } } } },
-	// (2^64)*B * 2
-	{ { { { { 0xF207FAC6, 0x05704BF4, 0x161BD3A2, 0x0F16C7B1 } },
-	      { { 0x870DEC6E, 0x1AD76AF2, 0xD0BF2740, 0x4FB614A7 } } } },
-	  { { { { 0x28566D8A, 0x45D7C01C, 0x4077ABED, 0x005002FF } },
-	      { { 0x5672D4B3, 0x6542A776, 0xA98AB48D, 0x04137083 } } } } },
-	// (2^64)*B * 3
-	{ { { { { 0xF0350244, 0x27C990FF, 0x857F7525, 0x18A5BC91 } },
-	      { { 0x79997083, 0x6004C035, 0xE0E1B992, 0x1744491A } } } },
-	  { { { { 0x17682DD3, 0x9C8593D7, 0x84AE8661, 0x402364E0 } },
-	      { { 0xB2E2B9F3, 0x20F86314, 0x4D9B1FB5, 0x545AF79A } } } } },
-	// (2^64)*B * 4
-	{ { { { { 0xDDA5DC0B, 0x23CBD429, 0x6A5208C3, 0x27DF09B6 } },
-	      { { 0x8B8FF984, 0x10BCC45E, 0x205DF31F, 0x4D7FE346 } } } },
-	  { { { { 0xC97F02A7, 0x0CB81A89, 0x7D64DBF2, 0x3C1C9D27 } },
-	      { { 0x704354B3, 0xF84A977B, 0x368738E4, 0x2C8704A6 } } } } },
-	// (2^64)*B * 5
-	{ { { { { 0x448B153F, 0x5FBA8828, 0x9A0F0423, 0x01E91ADB } },
-	      { { 0x4BFABFFD, 0x1441B534, 0xA4E2D56F, 0x6D0A611A } } } },
-	  { { { { 0xC6ED13FE, 0x67C71E1C, 0xA6321549, 0x4DEFBBD5 } },
-	      { { 0x5515923F, 0xA187801F, 0xB7921BE3, 0x5FAD2693 } } } } },
-	// (2^64)*B * 6
-	{ { { { { 0x9A07D071, 0xCBD5E245, 0xCE94BD91, 0x578067F7 } },
-	      { { 0x22EBB7B9, 0x393D9B57, 0xF4C2C566, 0x07F1E938 } } } },
-	  { { { { 0x7ACE6FEC, 0xAF27AF4B, 0x2CE0A5CF, 0x6DE1B7A6 } },
-	      { { 0x633B4D64, 0xD0C6FCA2, 0x989F7B92, 0x2813A2EA } } } } },
-	// (2^64)*B * 7
-	{ { { { { 0x41DBB5A8, 0x0A58149A, 0x1073E8F8, 0x106DF92D } },
-	      { { 0x493E86B2, 0x197899FC, 0x2197B358, 0x2E0E05CE } } } },
-	  { { { { 0x709BC381, 0x2D603F9B, 0xA19EED77, 0x26507080 } },
-	      { { 0x1A0926FE, 0x5D86707B, 0x55F08B86, 0x2C55B877 } } } } },
-	// (2^64)*B * 8
-	{ { { { { 0xCD1523B9, 0x43086DD4, 0x4CF14DC9, 0x25B6941E } },
-	      { { 0x40028B29, 0x0C30580B, 0xA4F8EDDF, 0x6B6816FF } } } },
-	  { { { { 0x84749178, 0xB9FFB6EF, 0x8D83172B, 0x16BFA2F7 } },
-	      { { 0x577E2135, 0xCD9F9599, 0xC1FB34BF, 0x0B9E5031 } } } } }
-};
-
-/* Point i*(2^96)*B for i = 1 to 8, affine format (scaled_x, scaled_s) */
-static const gls254_point_affine PRECOMP_B96[] = {
-	// (2^96)*B * 1
-	{ { { { { 0xDA88E093, 0x653346E6, 0x9CD13872, 0x30002265 } },
-	      { { 0x5F29D20B, 0x65532D39, 0x7CB5DE42, 0x30FE4C5C } } } },
-	  { { { { 0x421D4A31, 0x0D181FE3, 0x94F4D3F7, 0x35F3E726 } },
-	      { { 0xDD3ED40C, 0x0AB661AD, 0x4F2CADE5, 0x542B83C0 } } } } },
-	// (2^96)*B * 2
-	{ { { { { 0xCF11A8C7, 0x5450A803, 0x1DB4620C, 0x1A3EFC52 } },
-	      { { 0xB4D6810F, 0x3FA30220, 0x1BC8AF08, 0x56C04218 } } } },
-	  { { { { 0xFCE09354, 0x97E3B24D, 0xE7E9C001, 0x7B0F3BAF } },
-	      { { 0xBD91FC40, 0x2DD1D729, 0xC21B1AD2, 0x05C74680 } } } } },
-	// (2^96)*B * 3
-	{ { { { { 0x431C5C00, 0x8F7A7F37, 0x22605514, 0x4487CC96 } },
-	      { { 0x955E5D1C, 0x754A0DB2, 0xB8D0072A, 0x6AA1BE4A } } } },
-	  { { { { 0x6B1BFC14, 0xA6D4611F, 0x6B2E8951, 0x00390364 } },
-	      { { 0x0D536882, 0x723A689D, 0x973B29AB, 0x3B33B3BD } } } } },
-	// (2^96)*B * 4
-	{ { { { { 0xF4444850, 0xE2D4EE8A, 0xD2D38B53, 0x7C4CCD23 } },
-	      { { 0xECC474E6, 0x66C8957A, 0x9CF325E5, 0x70291606 } } } },
-	  { { { { 0xE0752CC9, 0x6FEC1E66, 0x3FC42538, 0x3E40F3D7 } },
-	      { { 0x8A03A6D1, 0x5E66D9FE, 0x77C4AEDF, 0x73FDAD68 } } } } },
-	// (2^96)*B * 5
-	{ { { { { 0x4F97E0A6, 0x20505FA3, 0x16909F86, 0x79ACB745 } },
-	      { { 0x82094271, 0xA163A5DC, 0x2F63A6BC, 0x1B6E5456 } } } },
-	  { { { { 0x7E812C96, 0x9EFD3DD1, 0x136FD51D, 0x6901EB6C } },
-	      { { 0xC0488EEA, 0x13157F6F, 0x0270A4C0, 0x67729C40 } } } } },
-	// (2^96)*B * 6
-	{ { { { { 0xE30AA449, 0xDBEAF734, 0xB81EC506, 0x2E1D908E } },
-	      { { 0x61127B0E, 0xF2611727, 0xBA512D9F, 0x2DC2FA82 } } } },
-	  { { { { 0x68E311D9, 0x44172899, 0xD5748EBC, 0x57F6D770 } },
-	      { { 0x99E2D413, 0x97723CD4, 0xCC746EF0, 0x283638AE } } } } },
-	// (2^96)*B * 7
-	{ { { { { 0x8B0BCCC7, 0xE16BBA3D, 0x44C9E28F, 0x29BE1EE4 } },
-	      { { 0x751536A3, 0x6E4A728A, 0x00888F7C, 0x08FD01F0 } } } },
-	  { { { { 0x6105457B, 0x3346C207, 0x67B0008B, 0x290BC8D9 } },
-	      { { 0x8C9C3D6E, 0xCC0E64B7, 0x2E01B797, 0x14197A7C } } } } },
-	// (2^96)*B * 8
-	{ { { { { 0xF4B109E4, 0x891B5765, 0x03AA5B0A, 0x4C341F78 } },
-	      { { 0xB329C9A0, 0x7DF0A0F3, 0x55940920, 0x6E637EAE } } } },
-	  { { { { 0x7624B8A0, 0x81C1B2EF, 0x54F22B55, 0x528F805E } },
-	      { { 0x7A0FFB48, 0x43A540E6, 0x07BE133F, 0x7A79D0B6 } } } } }
-};
+/* Precomputed tables (generated by gen_precomp). */
+#include "precomp.h"
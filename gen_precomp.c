@@ -0,0 +1,201 @@
+/*
+ * Generator for the precomputed tables of multiples of the conventional
+ * generator used by curve.c (file precomp.h). The points are computed
+ * with the library itself (generic point operations only, not the
+ * tables), and emitted with the in-memory layout of gls254_point_affine.
+ *
+ * Usage: gen_precomp [-t tables] [-w window] > precomp.h
+ *
+ * Without options, tables for all supported values of
+ * GLS254_MULGEN_TABLES (4, 8, 16, 32) and GLS254_VERIFY_GEN_WIN (4 to 8)
+ * are emitted, selected at compile time. With -t and/or -w, only the
+ * specified configuration is emitted (smaller file), and compiling
+ * curve.c with other settings triggers an error.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "gls254.h"
+#include "inner.h"
+
+/*
+ * Print one affine point as a C initializer, preceded by a comment
+ * line "// (2^e)*B * m" (or "// B * m" if e = 0).
+ */
+static void
+print_point(unsigned e, unsigned m, const gls254_point *p)
+{
+	gls254_point_affine a;
+	gfb127 *w[4];
+
+	gls254_normalize(&a, p);
+	w[0] = &a.scaled_x.v[0];
+	w[1] = &a.scaled_x.v[1];
+	w[2] = &a.scaled_s.v[0];
+	w[3] = &a.scaled_s.v[1];
+	for (int i = 0; i < 4; i ++) {
+		/* Use the canonical representation, so that the output
+		   does not depend on the backend used to compute it. */
+		gfb127_normalize(w[i], w[i]);
+	}
+	if (e == 0) {
+		printf("\t// B * %u\n", m);
+	} else {
+		printf("\t// (2^%u)*B * %u\n", e, m);
+	}
+	for (int i = 0; i < 4; i ++) {
+		static const char *const pre[] = {
+			"\t{ { { { { ", "\t      { { ",
+			"\t  { { { { ", "\t      { { "
+		};
+		static const char *const post[] = {
+			" } },", " } } } },", " } },", " } } } } },"
+		};
+
+		printf("%s0x%08X, 0x%08X, 0x%08X, 0x%08X%s\n",
+			pre[i], (unsigned)w[i]->v[0], (unsigned)w[i]->v[1],
+			(unsigned)w[i]->v[2], (unsigned)w[i]->v[3], post[i]);
+	}
+}
+
+/*
+ * Emit the gls254_mulgen() tables for T tables (T = 4, 8, 16 or 32):
+ * i*(2^(128*j/T))*B for j = 0 to T-1 and i = 1 to 8.
+ */
+static void
+emit_comb(unsigned T)
+{
+	for (unsigned j = 0; j < T; j ++) {
+		gls254_point b, p;
+		unsigned e;
+
+		e = (128 * j) / T;
+		gls254_xdouble(&b, &GLS254_BASE, e);
+		p = b;
+		for (unsigned i = 1; i <= 8; i ++) {
+			print_point(e, i, &p);
+			gls254_add(&p, &p, &b);
+		}
+	}
+}
+
+/*
+ * Emit the odd multiples (2*i+1)*(2^e)*B for a window width up to w
+ * (i = 0 to 2^(w-2)-1). If guarded is non-zero, entries beyond the
+ * width-4 window are enclosed in conditionals on GLS254_VERIFY_GEN_WIN.
+ */
+static void
+emit_odd(unsigned e, unsigned w, int guarded)
+{
+	gls254_point b, b2, p;
+	unsigned n;
+
+	gls254_xdouble(&b, &GLS254_BASE, e);
+	gls254_xdouble(&b2, &b, 1);
+	p = b;
+	n = 1u << (w - 2);
+	for (unsigned i = 0; i < n; i ++) {
+		if (guarded && i >= 4 && (i & (i - 1)) == 0) {
+			unsigned k;
+
+			for (k = 2; (1u << k) <= i; k ++);
+			printf("#if GLS254_VERIFY_GEN_WIN >= %u\n", k + 2);
+		}
+		print_point(e, 2 * i + 1, &p);
+		if (guarded && i >= 7 && ((i + 1) & i) == 0) {
+			printf("#endif\n");
+		}
+		gls254_add(&p, &p, &b2);
+	}
+}
+
+static void
+usage(void)
+{
+	fprintf(stderr,
+"usage: gen_precomp [-t tables] [-w window]\n"
+"  -t tables   number of gls254_mulgen() tables (4, 8, 16 or 32)\n"
+"  -w window   verification window for the generator (4 to 8)\n");
+	exit(EXIT_FAILURE);
+}
+
+int
+main(int argc, char *argv[])
+{
+	unsigned tables = 0, win = 0;
+
+	for (int i = 1; i < argc; i ++) {
+		if (i + 1 < argc && strcmp(argv[i], "-t") == 0) {
+			tables = (unsigned)atoi(argv[++ i]);
+			if (tables != 4 && tables != 8
+				&& tables != 16 && tables != 32)
+			{
+				usage();
+			}
+		} else if (i + 1 < argc && strcmp(argv[i], "-w") == 0) {
+			win = (unsigned)atoi(argv[++ i]);
+			if (win < 4 || win > 8) {
+				usage();
+			}
+		} else {
+			usage();
+		}
+	}
+
+	printf("/*\n");
+	printf(" * Precomputed multiples of the conventional generator"
+		" B, affine format\n");
+	printf(" * (scaled_x, scaled_s), for curve.c. This file was"
+		" generated by\n");
+	printf(" * gen_precomp");
+	if (tables != 0) {
+		printf(" -t %u", tables);
+	}
+	if (win != 0) {
+		printf(" -w %u", win);
+	}
+	printf("; do not edit.\n */\n\n");
+
+	if (tables != 0) {
+		printf("#if GLS254_MULGEN_TABLES != %u\n", tables);
+		printf("#error precomp.h was generated for"
+			" GLS254_MULGEN_TABLES = %u\n", tables);
+		printf("#endif\n\n");
+	}
+	if (win != 0) {
+		printf("#if GLS254_VERIFY_GEN_WIN > %u\n", win);
+		printf("#error precomp.h was generated for"
+			" GLS254_VERIFY_GEN_WIN <= %u\n", win);
+		printf("#endif\n\n");
+	}
+
+	printf("/* Points i*(2^(128*j/T))*B for i = 1 to 8 and j = 0 to"
+		" T-1, with\n");
+	printf("   T = GLS254_MULGEN_TABLES (used by gls254_mulgen()) */\n");
+	printf("static const gls254_point_affine PRECOMP_COMB[] = {\n");
+	if (tables != 0) {
+		emit_comb(tables);
+	} else {
+		for (unsigned T = 4; T <= 32; T <<= 1) {
+			printf(T == 4 ? "#if GLS254_MULGEN_TABLES == %u\n"
+				: "#elif GLS254_MULGEN_TABLES == %u\n", T);
+			emit_comb(T);
+		}
+		printf("#endif\n");
+	}
+	printf("};\n");
+
+	for (unsigned e = 0; e <= 64; e += 64) {
+		printf("\n/* Odd multiples (2*i+1)*%sB for i = 0 to"
+			" 2^(GLS254_VERIFY_GEN_WIN-2)-1\n",
+			e == 0 ? "" : "(2^64)*");
+		printf("   (used by signature verification) */\n");
+		printf("static const gls254_point_affine %s[] = {\n",
+			e == 0 ? "PRECOMP_B_ODD" : "PRECOMP_B64_ODD");
+		emit_odd(e, win != 0 ? win : 8, win == 0);
+		printf("};\n");
+	}
+	return 0;
+}
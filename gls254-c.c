@@ -0,0 +1,2027 @@
+/*
+ * Portable C implementation of the GF(2^127), GF(2^254) and GLS254
+ * point functions that are otherwise provided by the assembly source
+ * file (gls254-cm4.s). This file is meant for building the library on
+ * platforms other than the ARM Cortex M4 (e.g. for verifying, on a
+ * server, signatures produced by small devices).
+ *
+ * The implementation follows the assembly code closely: same internal
+ * representation of field elements, same formulas, and same output
+ * values (in particular for qsolve() and the map-to-curve process, so
+ * that encodings are bit-for-bit identical). Everything is constant-time
+ * (assuming that the platform offers constant-time 64-bit integer
+ * multiplications).
+ *
+ * Internally, a GF(2^127) element is a 128-bit value (the polynomial is
+ * taken modulo z^127 + z^63 + 1, but bit 127 may be set); computations
+ * use two 64-bit words, which are assembled from (and split back into)
+ * the four 32-bit words of the gfb127 type.
+ *
+ * For runtime dispatch, this file is compiled several times with
+ * different CPU features and with GLS254_BACKEND_SUFFIX defined (see
+ * backend.h); GLS254_NO_CONSTANTS then suppresses the definition of the
+ * GLS254_NEUTRAL and GLS254_BASE constants in all variants but one.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "backend.h"
+#include "inner.h"
+
+/*
+ * GLS254_PCLMUL enables the use of the x86 PCLMULQDQ opcode for
+ * multiplications and squarings. By default, it is enabled when the
+ * compiler is configured to target x86 CPUs that support that opcode
+ * (e.g. with the '-mpclmul' flag for GCC and Clang).
+ *
+ * GLS254_PMULL similarly enables the use of the AArch64 PMULL and PMULL2
+ * opcodes (cryptographic extension). By default, it is enabled when the
+ * compiler targets little-endian AArch64 with that extension (e.g. with
+ * '-march=armv8-a+crypto').
+ */
+#ifndef GLS254_PCLMUL
+#if (defined __x86_64__ || defined _M_X64) && defined __PCLMUL__
+#define GLS254_PCLMUL   1
+#else
+#define GLS254_PCLMUL   0
+#endif
+#endif
+
+#ifndef GLS254_PMULL
+#if defined __aarch64__ && !defined __AARCH64EB__ \
+	&& (defined __ARM_FEATURE_AES || defined __ARM_FEATURE_CRYPTO)
+#define GLS254_PMULL   1
+#else
+#define GLS254_PMULL   0
+#endif
+#endif
+
+#if GLS254_PCLMUL && GLS254_PMULL
+#error GLS254_PCLMUL and GLS254_PMULL cannot be both enabled
+#endif
+
+/*
+ * GLS254_VPCLMUL enables the 4-lane implementation of gls254_add_x4()
+ * and gls254_xdouble_x4() with AVX-512 and VPCLMULQDQ (one GF(2^127)
+ * element per 128-bit lane of a ZMM register). It requires GLS254_PCLMUL,
+ * and is enabled by default when the compiler targets a CPU with AVX-512F
+ * and VPCLMULQDQ (e.g. '-mavx512f -mvpclmulqdq').
+ */
+#ifndef GLS254_VPCLMUL
+#if GLS254_PCLMUL && defined __AVX512F__ && defined __VPCLMULQDQ__
+#define GLS254_VPCLMUL   1
+#else
+#define GLS254_VPCLMUL   0
+#endif
+#endif
+
+#if GLS254_VPCLMUL && !GLS254_PCLMUL
+#error GLS254_VPCLMUL requires GLS254_PCLMUL
+#endif
+
+/*
+ * GLS254_CLMUL is non-zero when a carryless multiplication opcode is used.
+ */
+#define GLS254_CLMUL   (GLS254_PCLMUL || GLS254_PMULL)
+
+#if GLS254_PCLMUL
+#include <immintrin.h>
+#elif GLS254_PMULL
+#include <arm_neon.h>
+#endif
+
+static inline uint32_t
+dec32le(const void *src)
+{
+	const uint8_t *buf = src;
+	return (uint32_t)buf[0]
+		| ((uint32_t)buf[1] << 8)
+		| ((uint32_t)buf[2] << 16)
+		| ((uint32_t)buf[3] << 24);
+}
+
+static inline void
+enc32le(void *dst, uint32_t x)
+{
+	uint8_t *buf = dst;
+	buf[0] = (uint8_t)x;
+	buf[1] = (uint8_t)(x >> 8);
+	buf[2] = (uint8_t)(x >> 16);
+	buf[3] = (uint8_t)(x >> 24);
+}
+
+/*
+ * Load a GF(2^127) element into two 64-bit words.
+ */
+static inline void
+ld127(uint64_t *lo, uint64_t *hi, const gfb127 *a)
+{
+	*lo = (uint64_t)a->v[0] | ((uint64_t)a->v[1] << 32);
+	*hi = (uint64_t)a->v[2] | ((uint64_t)a->v[3] << 32);
+}
+
+/*
+ * Store two 64-bit words into a GF(2^127) element.
+ */
+static inline void
+st127(gfb127 *d, uint64_t lo, uint64_t hi)
+{
+	d->v[0] = (uint32_t)lo;
+	d->v[1] = (uint32_t)(lo >> 32);
+	d->v[2] = (uint32_t)hi;
+	d->v[3] = (uint32_t)(hi >> 32);
+}
+
+/*
+ * Reduce a 128-bit value (bit 127 possibly set) into its normalized
+ * representation (bit 127 cleared), using z^127 = z^63 + 1.
+ */
+static inline void
+norm127(uint64_t *lo, uint64_t *hi)
+{
+	uint64_t h = *hi >> 63;
+	*lo ^= h | (h << 63);
+	*hi ^= h << 63;
+}
+
+/*
+ * Reduce a 256-bit product c0:c1:c2:c3 (degree at most 254) into a
+ * 128-bit value d0:d1 (bit 127 may be set in the output). We use
+ * z^128 = z^64 + z and z^192 = z^65 + z^64 + z:
+ *   k <- c2 + c3
+ *   d0 <- c0 + (k << 1)
+ *   d1 <- c1 + (k >> 63) + k + (c3 << 1)
+ */
+static inline void
+reduce256(uint64_t *d0, uint64_t *d1,
+	uint64_t c0, uint64_t c1, uint64_t c2, uint64_t c3)
+{
+	uint64_t k = c2 ^ c3;
+	*d0 = c0 ^ (k << 1);
+	*d1 = c1 ^ (k >> 63) ^ k ^ (c3 << 1);
+}
+
+/*
+ * Carryless multiplication of two 64-bit words, low 64 bits of the
+ * result only. Integer multiplications are used on operands with
+ * "holes" so that carries do not spill into the relevant bits (this
+ * is the same technique as the mask-and-multiply trick of the assembly
+ * implementation).
+ */
+static inline uint64_t
+bmul64(uint64_t x, uint64_t y)
+{
+	uint64_t x0, x1, x2, x3;
+	uint64_t y0, y1, y2, y3;
+	uint64_t z0, z1, z2, z3;
+
+	x0 = x & (uint64_t)0x1111111111111111;
+	x1 = x & (uint64_t)0x2222222222222222;
+	x2 = x & (uint64_t)0x4444444444444444;
+	x3 = x & (uint64_t)0x8888888888888888;
+	y0 = y & (uint64_t)0x1111111111111111;
+	y1 = y & (uint64_t)0x2222222222222222;
+	y2 = y & (uint64_t)0x4444444444444444;
+	y3 = y & (uint64_t)0x8888888888888888;
+	z0 = (x0 * y0) ^ (x1 * y3) ^ (x2 * y2) ^ (x3 * y1);
+	z1 = (x0 * y1) ^ (x1 * y0) ^ (x2 * y3) ^ (x3 * y2);
+	z2 = (x0 * y2) ^ (x1 * y1) ^ (x2 * y0) ^ (x3 * y3);
+	z3 = (x0 * y3) ^ (x1 * y2) ^ (x2 * y1) ^ (x3 * y0);
+	z0 &= (uint64_t)0x1111111111111111;
+	z1 &= (uint64_t)0x2222222222222222;
+	z2 &= (uint64_t)0x4444444444444444;
+	z3 &= (uint64_t)0x8888888888888888;
+	return z0 | z1 | z2 | z3;
+}
+
+/*
+ * Bit-reversal of a 64-bit word.
+ */
+static inline uint64_t
+rev64(uint64_t x)
+{
+	x = ((x & (uint64_t)0x5555555555555555) << 1)
+		| ((x >> 1) & (uint64_t)0x5555555555555555);
+	x = ((x & (uint64_t)0x3333333333333333) << 2)
+		| ((x >> 2) & (uint64_t)0x3333333333333333);
+	x = ((x & (uint64_t)0x0F0F0F0F0F0F0F0F) << 4)
+		| ((x >> 4) & (uint64_t)0x0F0F0F0F0F0F0F0F);
+	x = ((x & (uint64_t)0x00FF00FF00FF00FF) << 8)
+		| ((x >> 8) & (uint64_t)0x00FF00FF00FF00FF);
+	x = ((x & (uint64_t)0x0000FFFF0000FFFF) << 16)
+		| ((x >> 16) & (uint64_t)0x0000FFFF0000FFFF);
+	return (x << 32) | (x >> 32);
+}
+
+/*
+ * Spread the 32 bits of x over the even-indexed bits of a 64-bit word
+ * (i.e. carryless squaring of x).
+ */
+static inline uint64_t
+expand32(uint32_t x)
+{
+	uint64_t y = x;
+	y = (y | (y << 16)) & (uint64_t)0x0000FFFF0000FFFF;
+	y = (y | (y << 8)) & (uint64_t)0x00FF00FF00FF00FF;
+	y = (y | (y << 4)) & (uint64_t)0x0F0F0F0F0F0F0F0F;
+	y = (y | (y << 2)) & (uint64_t)0x3333333333333333;
+	y = (y | (y << 1)) & (uint64_t)0x5555555555555555;
+	return y;
+}
+
+/*
+ * Squeeze the even-indexed bits of x into a 32-bit word (odd-indexed
+ * bits are ignored). This is the inverse of expand32().
+ */
+static inline uint32_t
+squeeze64(uint64_t x)
+{
+	x &= (uint64_t)0x5555555555555555;
+	x = (x | (x >> 1)) & (uint64_t)0x3333333333333333;
+	x = (x | (x >> 2)) & (uint64_t)0x0F0F0F0F0F0F0F0F;
+	x = (x | (x >> 4)) & (uint64_t)0x00FF00FF00FF00FF;
+	x = (x | (x >> 8)) & (uint64_t)0x0000FFFF0000FFFF;
+	x = (x | (x >> 16)) & (uint64_t)0x00000000FFFFFFFF;
+	return (uint32_t)x;
+}
+
+/*
+ * Core multiplication in GF(2^127): inputs and output are pairs of
+ * 64-bit words. This uses Karatsuba over 64-bit halves; the high halves
+ * of the 64x64 products are obtained with the bit-reversal trick.
+ */
+static inline void
+mul127(uint64_t *d0, uint64_t *d1,
+	uint64_t a0, uint64_t a1, uint64_t b0, uint64_t b1)
+{
+	uint64_t a2, b2, ra0, ra1, ra2, rb0, rb1, rb2;
+	uint64_t p0l, p0h, p1l, p1h, p2l, p2h;
+
+	a2 = a0 ^ a1;
+	b2 = b0 ^ b1;
+	ra0 = rev64(a0);
+	ra1 = rev64(a1);
+	ra2 = ra0 ^ ra1;
+	rb0 = rev64(b0);
+	rb1 = rev64(b1);
+	rb2 = rb0 ^ rb1;
+
+	p0l = bmul64(a0, b0);
+	p0h = rev64(bmul64(ra0, rb0)) >> 1;
+	p1l = bmul64(a1, b1);
+	p1h = rev64(bmul64(ra1, rb1)) >> 1;
+	p2l = bmul64(a2, b2);
+	p2h = rev64(bmul64(ra2, rb2)) >> 1;
+
+	p2l ^= p0l ^ p1l;
+	p2h ^= p0h ^ p1h;
+	reduce256(d0, d1, p0l, p0h ^ p2l, p1l ^ p2h, p1h);
+}
+
+/*
+ * Core squaring in GF(2^127).
+ */
+static inline void
+square127(uint64_t *d0, uint64_t *d1, uint64_t a0, uint64_t a1)
+{
+	reduce256(d0, d1,
+		expand32((uint32_t)a0), expand32((uint32_t)(a0 >> 32)),
+		expand32((uint32_t)a1), expand32((uint32_t)(a1 >> 32)));
+}
+
+#if GLS254_CLMUL
+/*
+ * Implementation with a carryless multiplication opcode (PCLMULQDQ on
+ * x86, PMULL/PMULL2 on AArch64). A GF(2^127) element fits in a single
+ * 128-bit register (SSE2 or NEON); the in-memory representation of
+ * gfb127 is little-endian, just like the register lanes. Only the
+ * few primitives below are architecture-specific.
+ */
+
+#if GLS254_PCLMUL
+
+typedef __m128i v128;
+
+static inline v128
+ldv127(const gfb127 *a)
+{
+	return _mm_loadu_si128((const __m128i *)(const void *)a);
+}
+
+static inline void
+stv127(gfb127 *d, v128 x)
+{
+	_mm_storeu_si128((__m128i *)(void *)d, x);
+}
+
+#define xorv(a, b)      _mm_xor_si128(a, b)
+#define shl1v(x)        _mm_slli_epi64(x, 1)
+#define shr63v(x)       _mm_srli_epi64(x, 63)
+#define lo2hiv(x)       _mm_slli_si128(x, 8)
+#define hi2lov(x)       _mm_srli_si128(x, 8)
+#define swapv(x)        _mm_shuffle_epi32(x, 0x4E)
+#define clmul_lo(a, b)  _mm_clmulepi64_si128(a, b, 0x00)
+#define clmul_hi(a, b)  _mm_clmulepi64_si128(a, b, 0x11)
+
+#else
+
+typedef uint64x2_t v128;
+
+static inline v128
+ldv127(const gfb127 *a)
+{
+	return vreinterpretq_u64_u32(vld1q_u32(a->v));
+}
+
+static inline void
+stv127(gfb127 *d, v128 x)
+{
+	vst1q_u32(d->v, vreinterpretq_u32_u64(x));
+}
+
+#define xorv(a, b)      veorq_u64(a, b)
+#define shl1v(x)        vshlq_n_u64(x, 1)
+#define shr63v(x)       vshrq_n_u64(x, 63)
+#define lo2hiv(x)       vextq_u64(vdupq_n_u64(0), x, 1)
+#define hi2lov(x)       vextq_u64(x, vdupq_n_u64(0), 1)
+#define swapv(x)        vextq_u64(x, x, 1)
+
+static inline v128
+clmul_lo(v128 a, v128 b)
+{
+	return vreinterpretq_u64_p128(vmull_p64(
+		(poly64_t)vgetq_lane_u64(a, 0),
+		(poly64_t)vgetq_lane_u64(b, 0)));
+}
+
+static inline v128
+clmul_hi(v128 a, v128 b)
+{
+	return vreinterpretq_u64_p128(vmull_high_p64(
+		vreinterpretq_p64_u64(a), vreinterpretq_p64_u64(b)));
+}
+
+#endif
+
+/*
+ * Reduce a 256-bit product lo:hi (degree at most 254) into a 128-bit
+ * value. This is the same computation as reduce256(), with
+ * hi = c2:c3, i.e. we add hi*z + hi*z^64 (with the top word c3 folded
+ * once more into the low 128 bits).
+ */
+static inline v128
+reducev127(v128 lo, v128 hi)
+{
+	v128 t0, t1, t2;
+
+	/* t0 <- hi << 1 (128-bit shift) */
+	t0 = xorv(shl1v(hi), lo2hiv(shr63v(hi)));
+	/* t1 <- (c2 + c3)*z^64 */
+	t1 = lo2hiv(xorv(hi, hi2lov(hi)));
+	/* t2 <- c3*z */
+	t2 = hi2lov(shl1v(hi));
+	return xorv(lo, xorv(t0, xorv(t1, t2)));
+}
+
+/*
+ * Unreduced 128x128 carryless product (Karatsuba, three 64x64 products).
+ */
+static inline void
+mulv127_raw(v128 *lo, v128 *hi, v128 a, v128 b)
+{
+	v128 p0, p1, p2;
+
+	p0 = clmul_lo(a, b);
+	p1 = clmul_hi(a, b);
+	p2 = clmul_lo(xorv(a, swapv(a)), xorv(b, swapv(b)));
+	p2 = xorv(p2, xorv(p0, p1));
+	*lo = xorv(p0, lo2hiv(p2));
+	*hi = xorv(p1, hi2lov(p2));
+}
+
+static inline v128
+mulv127(v128 a, v128 b)
+{
+	v128 lo, hi;
+
+	mulv127_raw(&lo, &hi, a, b);
+	return reducev127(lo, hi);
+}
+
+static inline v128
+squarev127(v128 a)
+{
+	return reducev127(clmul_lo(a, a), clmul_hi(a, a));
+}
+#endif
+
+#if GLS254_VPCLMUL
+/*
+ * 4-lane implementation with AVX-512 and VPCLMULQDQ. A ZMM register
+ * contains four GF(2^127) elements (one per 128-bit lane); all
+ * operations below work on each lane independently, with the same
+ * formulas as the single-lane code above.
+ */
+
+typedef struct {
+	__m512i v0, v1;
+} gfb254x4;
+
+typedef struct {
+	gfb254x4 X, S, Z, T;
+} gls254_point_x4;
+
+#define xor3x4(a, b, c)   _mm512_ternarylogic_epi64(a, b, c, 0x96)
+
+/*
+ * Move the low 64-bit word of each lane to the high word (lo2hix4)
+ * or the converse (hi2lox4), clearing the other word; this uses only
+ * AVX-512F opcodes (byte shifts would need AVX-512BW).
+ */
+#define lo2hix4(x) \
+	_mm512_maskz_shuffle_epi32(0xCCCC, x, (_MM_PERM_ENUM)0x44)
+#define hi2lox4(x) \
+	_mm512_maskz_shuffle_epi32(0x3333, x, (_MM_PERM_ENUM)0xEE)
+
+static inline __m512i
+ld127x4(const gfb127 *a0, const gfb127 *a1,
+	const gfb127 *a2, const gfb127 *a3)
+{
+	__m512i x;
+
+	x = _mm512_castsi128_si512(ldv127(a0));
+	x = _mm512_inserti32x4(x, ldv127(a1), 1);
+	x = _mm512_inserti32x4(x, ldv127(a2), 2);
+	x = _mm512_inserti32x4(x, ldv127(a3), 3);
+	return x;
+}
+
+static inline void
+st127x4(gfb127 *d0, gfb127 *d1, gfb127 *d2, gfb127 *d3, __m512i x)
+{
+	stv127(d0, _mm512_castsi512_si128(x));
+	stv127(d1, _mm512_extracti32x4_epi32(x, 1));
+	stv127(d2, _mm512_extracti32x4_epi32(x, 2));
+	stv127(d3, _mm512_extracti32x4_epi32(x, 3));
+}
+
+static inline void
+ld254x4(gfb254x4 *d, const gfb254 *a0, const gfb254 *a1,
+	const gfb254 *a2, const gfb254 *a3)
+{
+	d->v0 = ld127x4(&a0->v[0], &a1->v[0], &a2->v[0], &a3->v[0]);
+	d->v1 = ld127x4(&a0->v[1], &a1->v[1], &a2->v[1], &a3->v[1]);
+}
+
+static inline void
+st254x4(gfb254 *d0, gfb254 *d1, gfb254 *d2, gfb254 *d3, const gfb254x4 *a)
+{
+	st127x4(&d0->v[0], &d1->v[0], &d2->v[0], &d3->v[0], a->v0);
+	st127x4(&d0->v[1], &d1->v[1], &d2->v[1], &d3->v[1], a->v1);
+}
+
+/*
+ * Load points p[0] to p[3] into a 4-lane point.
+ */
+static inline void
+ldpoint_x4(gls254_point_x4 *d, const gls254_point *p)
+{
+	ld254x4(&d->X, &p[0].X, &p[1].X, &p[2].X, &p[3].X);
+	ld254x4(&d->S, &p[0].S, &p[1].S, &p[2].S, &p[3].S);
+	ld254x4(&d->Z, &p[0].Z, &p[1].Z, &p[2].Z, &p[3].Z);
+	ld254x4(&d->T, &p[0].T, &p[1].T, &p[2].T, &p[3].T);
+}
+
+/*
+ * Store a 4-lane point into p[0] to p[3].
+ */
+static inline void
+stpoint_x4(gls254_point *p, const gls254_point_x4 *a)
+{
+	st254x4(&p[0].X, &p[1].X, &p[2].X, &p[3].X, &a->X);
+	st254x4(&p[0].S, &p[1].S, &p[2].S, &p[3].S, &a->S);
+	st254x4(&p[0].Z, &p[1].Z, &p[2].Z, &p[3].Z, &a->Z);
+	st254x4(&p[0].T, &p[1].T, &p[2].T, &p[3].T, &a->T);
+}
+
+/* Same as reducev127(), on each lane. */
+static inline __m512i
+reduce127x4(__m512i lo, __m512i hi)
+{
+	__m512i t0, t1, t2;
+
+	t0 = _mm512_xor_si512(_mm512_slli_epi64(hi, 1),
+		lo2hix4(_mm512_srli_epi64(hi, 63)));
+	t1 = lo2hix4(_mm512_xor_si512(hi, hi2lox4(hi)));
+	t2 = hi2lox4(_mm512_slli_epi64(hi, 1));
+	return _mm512_xor_si512(lo, xor3x4(t0, t1, t2));
+}
+
+/* Same as mulv127_raw(), on each lane. */
+static inline void
+mul127x4_raw(__m512i *lo, __m512i *hi, __m512i a, __m512i b)
+{
+	__m512i p0, p1, p2;
+
+	p0 = _mm512_clmulepi64_epi128(a, b, 0x00);
+	p1 = _mm512_clmulepi64_epi128(a, b, 0x11);
+	p2 = _mm512_clmulepi64_epi128(
+		_mm512_xor_si512(a, _mm512_shuffle_epi32(a, (_MM_PERM_ENUM)0x4E)),
+		_mm512_xor_si512(b, _mm512_shuffle_epi32(b, (_MM_PERM_ENUM)0x4E)),
+		0x00);
+	p2 = xor3x4(p2, p0, p1);
+	*lo = _mm512_xor_si512(p0, lo2hix4(p2));
+	*hi = _mm512_xor_si512(p1, hi2lox4(p2));
+}
+
+static inline __m512i
+square127x4(__m512i a)
+{
+	return reduce127x4(
+		_mm512_clmulepi64_epi128(a, a, 0x00),
+		_mm512_clmulepi64_epi128(a, a, 0x11));
+}
+
+static inline void
+gfb254x4_add(gfb254x4 *d, const gfb254x4 *a, const gfb254x4 *b)
+{
+	d->v0 = _mm512_xor_si512(a->v0, b->v0);
+	d->v1 = _mm512_xor_si512(a->v1, b->v1);
+}
+
+static inline void
+gfb254x4_mul(gfb254x4 *d, const gfb254x4 *a, const gfb254x4 *b)
+{
+	__m512i c0, c1, e0, e1, f0, f1;
+
+	mul127x4_raw(&c0, &c1, a->v0, b->v0);
+	mul127x4_raw(&e0, &e1, a->v1, b->v1);
+	mul127x4_raw(&f0, &f1, _mm512_xor_si512(a->v0, a->v1),
+		_mm512_xor_si512(b->v0, b->v1));
+	d->v0 = reduce127x4(
+		_mm512_xor_si512(c0, e0), _mm512_xor_si512(c1, e1));
+	d->v1 = reduce127x4(
+		_mm512_xor_si512(c0, f0), _mm512_xor_si512(c1, f1));
+}
+
+static inline void
+gfb254x4_square(gfb254x4 *d, const gfb254x4 *a)
+{
+	__m512i s0, s1;
+
+	s0 = square127x4(a->v0);
+	s1 = square127x4(a->v1);
+	d->v0 = _mm512_xor_si512(s0, s1);
+	d->v1 = s1;
+}
+
+/*
+ * Multiplication of each lane by 1 + z^27 (sqrt(b)), with the same
+ * formulas as gfb127_mul_sb().
+ */
+static inline __m512i
+mul_sb127x4(__m512i x)
+{
+	__m512i s, t;
+
+	s = _mm512_srli_epi64(x, 37);
+	t = hi2lox4(s);
+	return _mm512_xor_si512(
+		xor3x4(x, _mm512_slli_epi64(x, 27), lo2hix4(s)),
+		_mm512_xor_si512(_mm512_slli_epi64(t, 1),
+			lo2hix4(t)));
+}
+
+/*
+ * Multiplication of each lane by 1 + z^54 (b), with the same formulas
+ * as gfb127_mul_b().
+ */
+static inline __m512i
+mul_b127x4(__m512i x)
+{
+	__m512i s, t;
+
+	s = _mm512_srli_epi64(x, 10);
+	t = hi2lox4(s);
+	return _mm512_xor_si512(
+		xor3x4(x, _mm512_slli_epi64(x, 54), lo2hix4(s)),
+		_mm512_xor_si512(_mm512_slli_epi64(t, 1),
+			lo2hix4(t)));
+}
+
+static inline void
+gfb254x4_mul_sb(gfb254x4 *d, const gfb254x4 *a)
+{
+	d->v0 = mul_sb127x4(a->v0);
+	d->v1 = mul_sb127x4(a->v1);
+}
+
+static inline void
+gfb254x4_mul_b(gfb254x4 *d, const gfb254x4 *a)
+{
+	d->v0 = mul_b127x4(a->v0);
+	d->v1 = mul_b127x4(a->v1);
+}
+
+static inline void
+gfb254x4_mul_u(gfb254x4 *d, const gfb254x4 *a)
+{
+	__m512i t;
+
+	t = _mm512_xor_si512(a->v0, a->v1);
+	d->v0 = a->v1;
+	d->v1 = t;
+}
+
+static inline void
+gfb254x4_mul_u1(gfb254x4 *d, const gfb254x4 *a)
+{
+	__m512i t;
+
+	t = _mm512_xor_si512(a->v0, a->v1);
+	d->v1 = a->v0;
+	d->v0 = t;
+}
+#endif
+
+/* ====================================================================== */
+/*
+ * GF(2^127) functions.
+ */
+
+/* see inner.h */
+void
+gfb127_normalize(gfb127 *d, const gfb127 *a)
+{
+	uint64_t lo, hi;
+
+	ld127(&lo, &hi, a);
+	norm127(&lo, &hi);
+	st127(d, lo, hi);
+}
+
+/* see inner.h */
+uint32_t
+gfb127_get_bit(const gfb127 *a, int k)
+{
+	gfb127 t;
+
+	gfb127_normalize(&t, a);
+	return (t.v[k >> 5] >> (k & 31)) & 1;
+}
+
+/* see inner.h */
+void
+gfb127_set_bit(gfb127 *a, int k, uint32_t val)
+{
+	gfb127_normalize(a, a);
+	a->v[k >> 5] &= ~((uint32_t)1 << (k & 31));
+	a->v[k >> 5] |= val << (k & 31);
+}
+
+/* see inner.h */
+void
+gfb127_xor_bit(gfb127 *a, int k, uint32_t val)
+{
+	a->v[k >> 5] ^= val << (k & 31);
+}
+
+/* see inner.h */
+void
+gfb127_set_cond(gfb127 *d, const gfb127 *a, uint32_t ctl)
+{
+	for (int i = 0; i < 4; i ++) {
+		d->v[i] ^= ctl & (d->v[i] ^ a->v[i]);
+	}
+}
+
+/* see inner.h */
+void
+gfb127_add(gfb127 *d, const gfb127 *a, const gfb127 *b)
+{
+	for (int i = 0; i < 4; i ++) {
+		d->v[i] = a->v[i] ^ b->v[i];
+	}
+}
+
+/* see inner.h */
+void
+gfb127_mul_sb(gfb127 *d, const gfb127 *a)
+{
+	uint64_t lo, hi, t;
+
+	/* sqrt(b) = 1 + z^27; the 27 bits pushed beyond z^127 are
+	   reduced with z^128 = z^64 + z. */
+	ld127(&lo, &hi, a);
+	t = hi >> 37;
+	hi ^= (hi << 27) ^ (lo >> 37) ^ t;
+	lo ^= (lo << 27) ^ (t << 1);
+	st127(d, lo, hi);
+}
+
+/* see inner.h */
+void
+gfb127_mul_b(gfb127 *d, const gfb127 *a)
+{
+	uint64_t lo, hi, t;
+
+	/* b = 1 + z^54 */
+	ld127(&lo, &hi, a);
+	t = hi >> 10;
+	hi ^= (hi << 54) ^ (lo >> 10) ^ t;
+	lo ^= (lo << 54) ^ (t << 1);
+	st127(d, lo, hi);
+}
+
+/* see inner.h */
+void
+gfb127_div_z(gfb127 *d, const gfb127 *a)
+{
+	uint64_t lo, hi, m;
+
+	/* 1/z = z^126 + z^62 */
+	ld127(&lo, &hi, a);
+	m = lo << 63;
+	lo ^= m;
+	hi ^= m;
+	lo = (lo >> 1) | (hi << 63);
+	hi >>= 1;
+	st127(d, lo, hi);
+}
+
+/* see inner.h */
+void
+gfb127_div_z2(gfb127 *d, const gfb127 *a)
+{
+	gfb127_div_z(d, a);
+	gfb127_div_z(d, d);
+}
+
+/* see inner.h */
+void
+gfb127_mul(gfb127 *d, const gfb127 *a, const gfb127 *b)
+{
+#if GLS254_CLMUL
+	stv127(d, mulv127(ldv127(a), ldv127(b)));
+#else
+	uint64_t a0, a1, b0, b1;
+
+	ld127(&a0, &a1, a);
+	ld127(&b0, &b1, b);
+	mul127(&a0, &a1, a0, a1, b0, b1);
+	st127(d, a0, a1);
+#endif
+}
+
+/* see inner.h */
+void
+gfb127_square(gfb127 *d, const gfb127 *a)
+{
+#if GLS254_CLMUL
+	stv127(d, squarev127(ldv127(a)));
+#else
+	uint64_t a0, a1;
+
+	ld127(&a0, &a1, a);
+	square127(&a0, &a1, a0, a1);
+	st127(d, a0, a1);
+#endif
+}
+
+/* see inner.h */
+void
+gfb127_xsquare(gfb127 *d, const gfb127 *a, unsigned n)
+{
+#if GLS254_CLMUL
+	v128 x;
+
+	x = ldv127(a);
+	while (n -- > 0) {
+		x = squarev127(x);
+	}
+	stv127(d, x);
+#else
+	uint64_t a0, a1;
+
+	ld127(&a0, &a1, a);
+	while (n -- > 0) {
+		square127(&a0, &a1, a0, a1);
+	}
+	st127(d, a0, a1);
+#endif
+}
+
+/* see inner.h */
+void
+gfb127_invert(gfb127 *d, const gfb127 *a)
+{
+	gfb127 x, x1, x2;
+
+	/*
+	 * let x = a^2
+	 * We want 1/a = a^(2^127 - 2) = x^(2^126 - 1)
+	 * We use the same addition chain as the assembly code (the
+	 * 42-fold Frobenius is computed with plain squarings).
+	 */
+	gfb127_square(&x, a);
+
+	/* x1 <- x^(2^3 - 1) */
+	gfb127_square(&x1, &x);
+	gfb127_mul(&x1, &x1, &x);
+	gfb127_square(&x1, &x1);
+	gfb127_mul(&x1, &x1, &x);
+
+	/* x2 <- x^(2^6 - 1) */
+	gfb127_xsquare(&x2, &x1, 3);
+	gfb127_mul(&x2, &x2, &x1);
+
+	/* x1 <- x^(2^7 - 1) */
+	gfb127_square(&x1, &x2);
+	gfb127_mul(&x1, &x1, &x);
+
+	/* x1 <- x^(2^14 - 1) */
+	gfb127_xsquare(&x2, &x1, 7);
+	gfb127_mul(&x1, &x2, &x1);
+
+	/* x2 <- x^(2^28 - 1) */
+	gfb127_xsquare(&x2, &x1, 14);
+	gfb127_mul(&x2, &x2, &x1);
+
+	/* x1 <- x^(2^42 - 1) */
+	gfb127_xsquare(&x2, &x2, 14);
+	gfb127_mul(&x1, &x2, &x1);
+
+	/* x2 <- x^(2^84 - 1) */
+	gfb127_xsquare(&x2, &x1, 42);
+	gfb127_mul(&x2, &x2, &x1);
+
+	/* d <- x^(2^126 - 1) = 1/a */
+	gfb127_xsquare(&x2, &x2, 42);
+	gfb127_mul(d, &x2, &x1);
+}
+
+/* see inner.h */
+void
+gfb127_div(gfb127 *d, const gfb127 *a, const gfb127 *b)
+{
+	gfb127 t;
+
+	gfb127_invert(&t, b);
+	gfb127_mul(d, a, &t);
+}
+
+/* see inner.h */
+void
+gfb127_sqrt(gfb127 *d, const gfb127 *a)
+{
+	uint64_t lo, hi, ae, ao;
+
+	/*
+	 * Split a = ae^2 + z*ao^2; then:
+	 *   sqrt(a) = ae + sqrt(z)*ao = ae + (z^32 + z^64)*ao
+	 */
+	ld127(&lo, &hi, a);
+	ae = (uint64_t)squeeze64(lo) | ((uint64_t)squeeze64(hi) << 32);
+	ao = (uint64_t)squeeze64(lo >> 1)
+		| ((uint64_t)squeeze64(hi >> 1) << 32);
+	st127(d, ae ^ (ao << 32), ao ^ (ao >> 32));
+}
+
+/* see inner.h */
+uint32_t
+gfb127_trace(const gfb127 *a)
+{
+	return (a->v[0] ^ (a->v[3] >> 31)) & 1;
+}
+
+/*
+ * Halftrace of z^(2*j+1), for j = 0 to 63 (same table as in the
+ * assembly implementation).
+ */
+static const gfb127 HALFTRACE_ODD[] = {
+	{ { 0x00000000, 0x00000000, 0x00000001, 0x00000000 } },
+	{ { 0x01141668, 0x00010112, 0x00010014, 0x00000000 } },
+	{ { 0x0105135E, 0x00010011, 0x00000016, 0x00000001 } },
+	{ { 0x116159DE, 0x01031401, 0x01000426, 0x00000005 } },
+	{ { 0x0117177E, 0x00010115, 0x00000106, 0x00000001 } },
+	{ { 0x041E2620, 0x0010017C, 0x00060260, 0x00000114 } },
+	{ { 0x112C52C8, 0x01010472, 0x00040648, 0x00010012 } },
+	{ { 0x42CC8A00, 0x12045850, 0x10241E00, 0x00040430 } },
+	{ { 0x00060200, 0x00000014, 0x00000010, 0x00000000 } },
+	{ { 0x00240200, 0x00000430, 0x00040600, 0x00000010 } },
+	{ { 0x135E5EE8, 0x0105135E, 0x00121628, 0x00010116 } },
+	{ { 0x2CA82000, 0x04506EC0, 0x00686000, 0x00100640 } },
+	{ { 0x04722C20, 0x0010150C, 0x00021460, 0x00000104 } },
+	{ { 0x3FE878C8, 0x055D5EE2, 0x02284848, 0x00151622 } },
+	{ { 0x7C28E080, 0x15522EC8, 0x00682080, 0x01120648 } },
+	{ { 0xF880C080, 0x75E2E808, 0x48804080, 0x05622808 } },
+	{ { 0x0101115E, 0x00010003, 0x00000002, 0x00000001 } },
+	{ { 0x110050C8, 0x0101000A, 0x00000008, 0x00010002 } },
+	{ { 0x00200000, 0x00000420, 0x00000400, 0x00000000 } },
+	{ { 0x5000C080, 0x11020088, 0x00000080, 0x01020008 } },
+	{ { 0x06522C20, 0x0014132C, 0x00061060, 0x00000104 } },
+	{ { 0x00200000, 0x00000400, 0x00200000, 0x00000400 } },
+	{ { 0x37C878C8, 0x051D52E2, 0x02484848, 0x00151222 } },
+	{ { 0xC0008000, 0x52088080, 0x00008000, 0x12080080 } },
+	{ { 0x053F377E, 0x0013057D, 0x00060646, 0x00000111 } },
+	{ { 0x192050C8, 0x01492C02, 0x00602048, 0x00010442 } },
+	{ { 0x6BE09848, 0x144F5C2A, 0x062068C8, 0x0107146A } },
+	{ { 0x08000000, 0x00402000, 0x08000000, 0x00402000 } },
+	{ { 0x2EE42A00, 0x06547690, 0x004C7E00, 0x00140270 } },
+	{ { 0xE0808000, 0x5628C880, 0x20808000, 0x16284880 } },
+	{ { 0xB8804080, 0x67EAE888, 0x0880C080, 0x176A2888 } },
+	{ { 0x80000000, 0x68808000, 0x80000000, 0x68808000 } },
+	{ { 0x00150736, 0x00000113, 0x00010014, 0x00000001 } },
+	{ { 0x00610916, 0x00021403, 0x01000426, 0x00010007 } },
+	{ { 0x043E2620, 0x0010057C, 0x00060640, 0x00000114 } },
+	{ { 0x12CC4A80, 0x03065858, 0x10241E00, 0x01060438 } },
+	{ { 0x06762E20, 0x0014151C, 0x00021460, 0x00000114 } },
+	{ { 0x2C882000, 0x045062C0, 0x00486800, 0x00100240 } },
+	{ { 0x08200000, 0x00402C00, 0x00602000, 0x00000400 } },
+	{ { 0x38804080, 0x27EAE888, 0x48804080, 0x176A2888 } },
+	{ { 0x143F67B6, 0x01100577, 0x0004064E, 0x00010113 } },
+	{ { 0x49209048, 0x10432C8A, 0x006820C8, 0x0103044A } },
+	{ { 0x6BC09848, 0x146F582A, 0x062068C8, 0x0107106A } },
+	{ { 0xC8008000, 0x52C8A080, 0x08808000, 0x12482080 } },
+	{ { 0x37C47AC8, 0x051D5A92, 0x022C5E48, 0x00150632 } },
+	{ { 0xE8808000, 0x5E68E880, 0x20808000, 0x16686880 } },
+	{ { 0x5800C080, 0x11C22008, 0x08004080, 0x01426008 } },
+	{ { 0x00000000, 0x80000000, 0x80000000, 0x00000000 } },
+	{ { 0x00740E20, 0x00021510, 0x01010430, 0x00010004 } },
+	{ { 0x12AD4396, 0x03044C5B, 0x11241A2E, 0x01070437 } },
+	{ { 0x28B60620, 0x044067BC, 0x004E6E60, 0x00100374 } },
+	{ { 0x2A4C0A00, 0x24ECB0D0, 0x58A45E00, 0x166C2C30 } },
+	{ { 0x4F56BE68, 0x10573996, 0x006A36A8, 0x0103075E } },
+	{ { 0xE488A000, 0x5698C240, 0x08C8E000, 0x12582AC0 } },
+	{ { 0xE0A08000, 0x5E28C480, 0x20E08000, 0x16684C80 } },
+	{ { 0x38804080, 0xA7EAE888, 0xC880C080, 0x176AA888 } },
+	{ { 0x06922420, 0x0214492C, 0x11221C60, 0x01040524 } },
+	{ { 0x636C9A48, 0x34AF9C5A, 0x58C47EC8, 0x1767287A } },
+	{ { 0x8F483848, 0x42F79A6A, 0x0EC888C8, 0x137F3AAA } },
+	{ { 0xF080C080, 0xF5224808, 0xC0804080, 0x05A28808 } },
+	{ { 0x54A8E080, 0x31B2C6C8, 0x58E82080, 0x15722E48 } },
+	{ { 0x18004080, 0xAB4AA088, 0xE800C080, 0x1BCAE088 } },
+	{ { 0x40008000, 0xBA888080, 0xC0008000, 0x3A888080 } },
+	{ { 0x80000000, 0x68808000, 0x80000000, 0x68808000 } }
+};
+
+/* see inner.h */
+void
+gfb127_halftrace(gfb127 *d, const gfb127 *a)
+{
+	uint64_t lo, hi, f, h0, h1, o0, o1;
+
+	/*
+	 * H(1) = 0, so we can clear bit 0. The even-indexed part is
+	 * e = f^2 with f = squeeze(e), and H(f^2) = H(f) + f + Tr(f);
+	 * since f has degree less than 64 and its bit 0 is clear,
+	 * Tr(f) = 0. We apply this repeatedly, accumulating the
+	 * odd-indexed bits (o0:o1), which are then handled with the
+	 * precomputed table.
+	 */
+	ld127(&lo, &hi, a);
+	norm127(&lo, &hi);
+	lo &= ~(uint64_t)1;
+	o0 = lo & (uint64_t)0xAAAAAAAAAAAAAAAA;
+	o1 = hi & (uint64_t)0xAAAAAAAAAAAAAAAA;
+	f = (uint64_t)squeeze64(lo) | ((uint64_t)squeeze64(hi) << 32);
+	h0 = 0;
+	for (int i = 0; i < 6; i ++) {
+		h0 ^= f;
+		o0 ^= f & (uint64_t)0xAAAAAAAAAAAAAAAA;
+		f = squeeze64(f);
+	}
+	h1 = 0;
+	st127(d, h0, h1);
+	for (int j = 0; j < 64; j ++) {
+		uint64_t w = (j < 32) ? o0 : o1;
+		uint32_t m = -(uint32_t)((w >> (((j & 31) << 1) + 1)) & 1);
+		for (int i = 0; i < 4; i ++) {
+			d->v[i] ^= m & HALFTRACE_ODD[j].v[i];
+		}
+	}
+}
+
+/* see inner.h */
+uint32_t
+gfb127_iszero(const gfb127 *a)
+{
+	uint64_t lo, hi, x;
+
+	ld127(&lo, &hi, a);
+	norm127(&lo, &hi);
+	x = lo | hi;
+	x |= x >> 32;
+	return (uint32_t)(((x & 0xFFFFFFFF) - 1) >> 32);
+}
+
+/* see inner.h */
+uint32_t
+gfb127_equals(const gfb127 *a, const gfb127 *b)
+{
+	gfb127 t;
+
+	gfb127_add(&t, a, b);
+	return gfb127_iszero(&t);
+}
+
+/* see inner.h */
+void
+gfb127_encode(void *dst, const gfb127 *a)
+{
+	gfb127 t;
+	uint8_t *buf = dst;
+
+	gfb127_normalize(&t, a);
+	for (int i = 0; i < 4; i ++) {
+		enc32le(buf + (i << 2), t.v[i]);
+	}
+}
+
+/* see inner.h */
+void
+gfb127_decode16_trunc(gfb127 *d, const void *src)
+{
+	const uint8_t *buf = src;
+
+	for (int i = 0; i < 4; i ++) {
+		d->v[i] = dec32le(buf + (i << 2));
+	}
+	d->v[3] &= 0x7FFFFFFF;
+}
+
+/* see inner.h */
+void
+gfb127_decode16_reduce(gfb127 *d, const void *src)
+{
+	const uint8_t *buf = src;
+
+	/* Bit 127 is allowed in the internal representation. */
+	for (int i = 0; i < 4; i ++) {
+		d->v[i] = dec32le(buf + (i << 2));
+	}
+}
+
+/* see inner.h */
+uint32_t
+gfb127_decode16(gfb127 *d, const void *src)
+{
+	const uint8_t *buf = src;
+	uint32_t m;
+
+	m = -(dec32le(buf + 12) >> 31);
+	for (int i = 0; i < 4; i ++) {
+		d->v[i] = dec32le(buf + (i << 2)) & ~m;
+	}
+	return ~m;
+}
+
+/* ====================================================================== */
+/*
+ * GF(2^254) functions.
+ */
+
+/* see inner.h */
+void
+gfb254_mul(gfb254 *d, const gfb254 *a, const gfb254 *b)
+{
+#if GLS254_CLMUL
+	v128 a0, a1, b0, b1, c0, c1, e0, e1, f0, f1;
+
+	/* d = (a0*b0 + a1*b1) + u*((a0 + a1)*(b0 + b1) + a0*b0)
+	   Products are added before reduction. */
+	a0 = ldv127(&a->v[0]);
+	a1 = ldv127(&a->v[1]);
+	b0 = ldv127(&b->v[0]);
+	b1 = ldv127(&b->v[1]);
+	mulv127_raw(&c0, &c1, a0, b0);
+	mulv127_raw(&e0, &e1, a1, b1);
+	mulv127_raw(&f0, &f1,
+		xorv(a0, a1), xorv(b0, b1));
+	stv127(&d->v[0], reducev127(
+		xorv(c0, e0), xorv(c1, e1)));
+	stv127(&d->v[1], reducev127(
+		xorv(c0, f0), xorv(c1, f1)));
+#else
+	uint64_t a0, a1, a2, a3, b0, b1, b2, b3;
+	uint64_t c0, c1, e0, e1, f0, f1;
+
+	/* d = (a0*b0 + a1*b1) + u*((a0 + a1)*(b0 + b1) + a0*b0) */
+	ld127(&a0, &a1, &a->v[0]);
+	ld127(&a2, &a3, &a->v[1]);
+	ld127(&b0, &b1, &b->v[0]);
+	ld127(&b2, &b3, &b->v[1]);
+	mul127(&c0, &c1, a0, a1, b0, b1);
+	mul127(&e0, &e1, a2, a3, b2, b3);
+	mul127(&f0, &f1, a0 ^ a2, a1 ^ a3, b0 ^ b2, b1 ^ b3);
+	st127(&d->v[0], c0 ^ e0, c1 ^ e1);
+	st127(&d->v[1], c0 ^ f0, c1 ^ f1);
+#endif
+}
+
+/* see inner.h */
+void
+gfb254_square(gfb254 *d, const gfb254 *a)
+{
+#if GLS254_CLMUL
+	v128 a0, a1;
+
+	/* d = (a0^2 + a1^2) + u*a1^2 */
+	a0 = squarev127(ldv127(&a->v[0]));
+	a1 = squarev127(ldv127(&a->v[1]));
+	stv127(&d->v[0], xorv(a0, a1));
+	stv127(&d->v[1], a1);
+#else
+	uint64_t a0, a1, a2, a3;
+
+	/* d = (a0^2 + a1^2) + u*a1^2 */
+	ld127(&a0, &a1, &a->v[0]);
+	ld127(&a2, &a3, &a->v[1]);
+	square127(&a0, &a1, a0, a1);
+	square127(&a2, &a3, a2, a3);
+	st127(&d->v[0], a0 ^ a2, a1 ^ a3);
+	st127(&d->v[1], a2, a3);
+#endif
+}
+
+/* see inner.h */
+void
+gfb254_mul_selfphi(gfb127 *d, const gfb254 *a)
+{
+	gfb127 t0, t1;
+
+	/* a*phi(a) = (a0 + a1)^2 + a0*a1 */
+	gfb127_add(&t0, &a->v[0], &a->v[1]);
+	gfb127_square(&t0, &t0);
+	gfb127_mul(&t1, &a->v[0], &a->v[1]);
+	gfb127_add(d, &t0, &t1);
+}
+
+/* see inner.h */
+void
+gfb254_invert(gfb254 *d, const gfb254 *a)
+{
+	gfb127 t;
+
+	/* 1/a = phi(a)/(a*phi(a)), and a*phi(a) is in GF(2^127). */
+	gfb254_mul_selfphi(&t, a);
+	gfb127_invert(&t, &t);
+	gfb127_add(&d->v[0], &a->v[0], &a->v[1]);
+	gfb127_mul(&d->v[0], &d->v[0], &t);
+	gfb127_mul(&d->v[1], &a->v[1], &t);
+}
+
+/* see inner.h */
+void
+gfb254_div(gfb254 *d, const gfb254 *a, const gfb254 *b)
+{
+	gfb254 t;
+
+	gfb254_invert(&t, b);
+	gfb254_mul(d, a, &t);
+}
+
+/* see inner.h */
+void
+gfb254_sqrt(gfb254 *d, const gfb254 *a)
+{
+	/* sqrt(a) = sqrt(a0 + a1) + u*sqrt(a1) */
+	gfb127_add(&d->v[0], &a->v[0], &a->v[1]);
+	gfb127_sqrt(&d->v[0], &d->v[0]);
+	gfb127_sqrt(&d->v[1], &a->v[1]);
+}
+
+/* see inner.h */
+void
+gfb254_qsolve(gfb254 *d, const gfb254 *a)
+{
+	gfb127 y1, t;
+
+	/*
+	 * y1 <- halftrace(a1), adjusted so that Tr(y1) = Tr(a0)
+	 * y0 <- halftrace(a0 + y1^2)
+	 */
+	gfb127_halftrace(&y1, &a->v[1]);
+	gfb127_xor_bit(&y1, 0, gfb127_trace(&y1) ^ gfb127_trace(&a->v[0]));
+	gfb127_square(&t, &y1);
+	gfb127_add(&t, &t, &a->v[0]);
+	d->v[1] = y1;
+	gfb127_halftrace(&d->v[0], &t);
+}
+
+/* see inner.h */
+void
+gfb254_encode(void *dst, const gfb254 *a)
+{
+	gfb127_encode(dst, &a->v[0]);
+	gfb127_encode((uint8_t *)dst + 16, &a->v[1]);
+}
+
+/* see inner.h */
+void
+gfb254_decode32_trunc(gfb254 *d, const void *src)
+{
+	gfb127_decode16_trunc(&d->v[0], src);
+	gfb127_decode16_trunc(&d->v[1], (const uint8_t *)src + 16);
+}
+
+/* see inner.h */
+void
+gfb254_decode32_reduce(gfb254 *d, const void *src)
+{
+	gfb127_decode16_reduce(&d->v[0], src);
+	gfb127_decode16_reduce(&d->v[1], (const uint8_t *)src + 16);
+}
+
+/* see inner.h */
+uint32_t
+gfb254_decode32(gfb254 *d, const void *src)
+{
+	uint32_t r;
+
+	/* Clear all words if bit 127 or bit 255 is 1. */
+	r = gfb127_decode16(&d->v[0], src);
+	r &= gfb127_decode16(&d->v[1], (const uint8_t *)src + 16);
+	for (int i = 0; i < 4; i ++) {
+		d->v[0].v[i] &= r;
+		d->v[1].v[i] &= r;
+	}
+	return r;
+}
+
+/* ====================================================================== */
+/*
+ * GLS254 functions.
+ */
+
+#ifndef GLS254_NO_CONSTANTS
+/* see gls254.h */
+const gls254_point GLS254_NEUTRAL = {
+	/* X = 0 */
+	{ { { { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } },
+	    { { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } } } },
+	/* S = sqrt(b) */
+	{ { { { 0x08000001, 0x00000000, 0x00000000, 0x00000000 } },
+	    { { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } } } },
+	/* Z = 1 */
+	{ { { { 0x00000001, 0x00000000, 0x00000000, 0x00000000 } },
+	    { { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } } } },
+	/* T = 0 */
+	{ { { { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } },
+	    { { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } } } }
+};
+
+/* see gls254.h */
+const gls254_point GLS254_BASE = {
+	/* X */
+	{ { { { 0x326B8675, 0xB6412F20, 0x9AE29894, 0x657CB9F7 } },
+	    { { 0xF66DD010, 0x3932450F, 0xB2E3915E, 0x14C6F62C } } } },
+	/* S */
+	{ { { { 0x023DC896, 0x5FADCA04, 0xA04300F1, 0x763522AD } },
+	    { { 0x9E07345A, 0x206E4C1E, 0x2381CA6D, 0x4F69A66A } } } },
+	/* Z = 1 */
+	{ { { { 0x00000001, 0x00000000, 0x00000000, 0x00000000 } },
+	    { { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } } } },
+	/* T = X*Z */
+	{ { { { 0x326B8675, 0xB6412F20, 0x9AE29894, 0x657CB9F7 } },
+	    { { 0xF66DD010, 0x3932450F, 0xB2E3915E, 0x14C6F62C } } } }
+};
+
+#endif
+
+/* sqrt(b), as a GF(2^254) element */
+static const gfb254 SQRT_B = {
+	{ { { 0x08000001, 0x00000000, 0x00000000, 0x00000000 } },
+	  { { 0x00000000, 0x00000000, 0x00000000, 0x00000000 } } }
+};
+
+/* see gls254.h */
+uint32_t
+gls254_isneutral(const gls254_point *p)
+{
+	return gfb254_iszero(&p->X);
+}
+
+/* see gls254.h */
+uint32_t
+gls254_equals(const gls254_point *p1, const gls254_point *p2)
+{
+	gfb254 t1, t2;
+
+	gfb254_mul(&t1, &p1->S, &p2->T);
+	gfb254_mul(&t2, &p2->S, &p1->T);
+	return gfb254_equals(&t1, &t2);
+}
+
+/* see gls254.h */
+void
+gls254_set_cond(gls254_point *p2, const gls254_point *p1, uint32_t ctl)
+{
+	gfb254_set_cond(&p2->X, &p1->X, ctl);
+	gfb254_set_cond(&p2->S, &p1->S, ctl);
+	gfb254_set_cond(&p2->Z, &p1->Z, ctl);
+	gfb254_set_cond(&p2->T, &p1->T, ctl);
+}
+
+/* see gls254.h */
+void
+gls254_encode(void *dst, const gls254_point *p)
+{
+	gfb254 w;
+
+	/* w <- sqrt(S/T) */
+	gfb254_div(&w, &p->S, &p->T);
+	gfb254_sqrt(&w, &w);
+	gfb254_encode(dst, &w);
+}
+
+/* see gls254.h */
+uint32_t
+gls254_decode(gls254_point *p, const void *src)
+{
+	gfb254 w, d, e, w2;
+	uint32_t r, wz;
+
+	/* w <- decode(src); wz <- w == 0 */
+	r = gfb254_decode32(&w, src);
+	wz = r & gfb254_iszero(&w);
+
+	/* d <- w^2 + w + a */
+	gfb254_square(&w2, &w);
+	gfb254_add(&d, &w, &w2);
+	gfb254_add_u(&d, &d);
+
+	/* e <- b/d^2 */
+	gfb254_square(&e, &d);
+	gfb254_invert(&e, &e);
+	gfb254_mul_b(&e, &e);
+
+	/* If Tr(e) = 1 then the input is not valid (or is zero). */
+	r &= gfb254_trace(&e) - 1;
+
+	/* x <- d*qsolve(e); if Tr(x) = 1, then x <- x + d */
+	gfb254_qsolve(&e, &e);
+	gfb254_mul(&e, &e, &d);
+	gfb254_add(&d, &d, &e);
+	gfb254_set_cond(&e, &d, -gfb254_trace(&e));
+	p->X = e;
+
+	/* s <- x*w^2 (scaled) */
+	gfb254_mul(&w2, &e, &w2);
+	gfb254_mul_sb(&p->S, &w2);
+
+	/* Z = sqrt(b), and T = X*Z = sqrt(b)*X */
+	p->Z = SQRT_B;
+	gfb254_mul_sb(&p->T, &p->X);
+
+	/* Replace the point with the neutral in case of failure. */
+	gls254_set_cond(p, &GLS254_NEUTRAL, ~r);
+
+	/* If w = 0 then we currently have a failure status (and the
+	   point was set to the neutral), but this is not a failure and
+	   we want to return the neutral. */
+	return r | wz;
+}
+
+/* see gls254.h */
+void
+gls254_add(gls254_point *p3,
+	const gls254_point *p1, const gls254_point *p2)
+{
+	gfb254 D, S1S2, E, F, G, t;
+
+	/* D = (S1 + T1)*(S2 + T2) */
+	gfb254_add(&D, &p1->S, &p1->T);
+	gfb254_add(&t, &p2->S, &p2->T);
+	gfb254_mul(&D, &D, &t);
+
+	/* S1S2 = S1*S2 */
+	gfb254_mul(&S1S2, &p1->S, &p2->S);
+
+	/* E = (a^2)*T1*T2 */
+	gfb254_mul(&E, &p1->T, &p2->T);
+	gfb254_mul_u1(&E, &E);
+
+	/* F = (X1*X2)^2 */
+	gfb254_mul(&F, &p1->X, &p2->X);
+	gfb254_square(&F, &F);
+
+	/* G = (Z1*Z2)^2 */
+	gfb254_mul(&G, &p1->Z, &p2->Z);
+	gfb254_square(&G, &G);
+
+	/* X3 = D + S1S2 */
+	gfb254_add(&p3->X, &D, &S1S2);
+
+	/* S3 = sqrt(b)*(G*(S1S2 + E) + F*(D + E)) */
+	gfb254_add(&D, &D, &E);
+	gfb254_add(&S1S2, &S1S2, &E);
+	gfb254_mul(&D, &D, &F);
+	gfb254_mul(&S1S2, &S1S2, &G);
+	gfb254_add(&t, &D, &S1S2);
+	gfb254_mul_sb(&p3->S, &t);
+
+	/* Z3 = sqrt(b)*(F + G) */
+	gfb254_add(&t, &F, &G);
+	gfb254_mul_sb(&p3->Z, &t);
+
+	/* T3 = X3*Z3 */
+	gfb254_mul(&p3->T, &p3->X, &p3->Z);
+}
+
+/* see gls254.h */
+void
+gls254_add_affine(gls254_point *p3,
+	const gls254_point *p1, const gls254_point_affine *p2)
+{
+	gfb254 D, S1S2, E, F, G, t;
+
+	/*
+	 * Point p2 is in affine coordinates:
+	 *    X2 = p2->scaled_x
+	 *    S2 = p2->scaled_s
+	 *    Z2 = 1
+	 *    T2 = p2->scaled_x
+	 */
+
+	/* D = (S1 + T1)*(S2 + T2) */
+	gfb254_add(&D, &p1->S, &p1->T);
+	gfb254_add(&t, &p2->scaled_s, &p2->scaled_x);
+	gfb254_mul(&D, &D, &t);
+
+	/* S1S2 = S1*S2 */
+	gfb254_mul(&S1S2, &p1->S, &p2->scaled_s);
+
+	/* E = (a^2)*T1*T2 */
+	gfb254_mul(&E, &p1->T, &p2->scaled_x);
+	gfb254_mul_u1(&E, &E);
+
+	/* F = (X1*X2)^2 */
+	gfb254_mul(&F, &p1->X, &p2->scaled_x);
+	gfb254_square(&F, &F);
+
+	/* G = (Z1*Z2)^2 = Z1^2 */
+	gfb254_square(&G, &p1->Z);
+
+	/* X3 = D + S1S2 */
+	gfb254_add(&p3->X, &D, &S1S2);
+
+	/* S3 = sqrt(b)*(G*(S1S2 + E) + F*(D + E)) */
+	gfb254_add(&D, &D, &E);
+	gfb254_add(&S1S2, &S1S2, &E);
+	gfb254_mul(&D, &D, &F);
+	gfb254_mul(&S1S2, &S1S2, &G);
+	gfb254_add(&t, &D, &S1S2);
+	gfb254_mul_sb(&p3->S, &t);
+
+	/* Z3 = sqrt(b)*(F + G) */
+	gfb254_add(&t, &F, &G);
+	gfb254_mul_sb(&p3->Z, &t);
+
+	/* T3 = X3*Z3 */
+	gfb254_mul(&p3->T, &p3->X, &p3->Z);
+}
+
+/* see gls254.h */
+void
+gls254_add_affine_affine(gls254_point *p3,
+	const gls254_point_affine *p1, const gls254_point_affine *p2)
+{
+	gfb254 D, S1S2, E, F, t;
+
+	/* D = (S1 + X1)*(S2 + X2) */
+	gfb254_add(&D, &p1->scaled_s, &p1->scaled_x);
+	gfb254_add(&t, &p2->scaled_s, &p2->scaled_x);
+	gfb254_mul(&D, &D, &t);
+
+	/* S1S2 = S1*S2 */
+	gfb254_mul(&S1S2, &p1->scaled_s, &p2->scaled_s);
+
+	/* F = (X1*X2)^2 and E = (a^2)*X1*X2 */
+	gfb254_mul(&E, &p1->scaled_x, &p2->scaled_x);
+	gfb254_square(&F, &E);
+	gfb254_mul_u1(&E, &E);
+
+	/* X3 = D + S1S2 */
+	gfb254_add(&p3->X, &D, &S1S2);
+
+	/* S3 = sqrt(b)*(S1S2 + E + F*(D + E)) */
+	gfb254_add(&D, &D, &E);
+	gfb254_add(&S1S2, &S1S2, &E);
+	gfb254_mul(&D, &D, &F);
+	gfb254_add(&t, &D, &S1S2);
+	gfb254_mul_sb(&p3->S, &t);
+
+	/* Z3 = sqrt(b)*(F + 1) */
+	F.v[0].v[0] ^= 1;
+	gfb254_mul_sb(&p3->Z, &F);
+
+	/* T3 = X3*Z3 */
+	gfb254_mul(&p3->T, &p3->X, &p3->Z);
+}
+
+/* see gls254.h */
+void
+gls254_neg(gls254_point *p3, const gls254_point *p1)
+{
+	gfb254 t;
+
+	gfb254_add(&t, &p1->S, &p1->T);
+	if (p3 != p1) {
+		*p3 = *p1;
+	}
+	p3->S = t;
+}
+
+/* see gls254.h */
+void
+gls254_condneg(gls254_point *p3, const gls254_point *p1, uint32_t ctl)
+{
+	gfb254 t;
+
+	t = p1->T;
+	for (int i = 0; i < 4; i ++) {
+		t.v[0].v[i] &= ctl;
+		t.v[1].v[i] &= ctl;
+	}
+	gfb254_add(&t, &t, &p1->S);
+	if (p3 != p1) {
+		*p3 = *p1;
+	}
+	p3->S = t;
+}
+
+/* see gls254.h */
+void
+gls254_sub(gls254_point *p3,
+	const gls254_point *p1, const gls254_point *p2)
+{
+	gls254_point t;
+
+	gls254_neg(&t, p2);
+	gls254_add(p3, p1, &t);
+}
+
+/* see gls254.h */
+void
+gls254_xdouble(gls254_point *p3, const gls254_point *p1, unsigned n)
+{
+	gfb254 X, Y, Z, T, tmp;
+
+	if (n == 0) {
+		if (p3 != p1) {
+			*p3 = *p1;
+		}
+		return;
+	}
+
+	/*
+	 * Conversion to the working coordinates:
+	 *   X <- sqrt(b)*X1
+	 *   T <- sqrt(b)*T1
+	 *   Z <- Z1
+	 *   Y <- sqrt(b)*S1 + X^2 + a*T
+	 */
+	gfb254_mul_sb(&X, &p1->X);
+	gfb254_mul_sb(&T, &p1->T);
+	Z = p1->Z;
+	gfb254_mul_sb(&Y, &p1->S);
+	gfb254_square(&tmp, &X);
+	gfb254_add(&Y, &Y, &tmp);
+	gfb254_mul_u(&tmp, &T);
+	gfb254_add(&Y, &Y, &tmp);
+
+	do {
+		gfb254 D;
+
+		/* D = (X + sqrt(b)*Z)^2 */
+		gfb254_mul_sb(&D, &Z);
+		gfb254_add(&D, &D, &X);
+		gfb254_square(&D, &D);
+
+		/* Z <- T^2 */
+		gfb254_square(&Z, &T);
+
+		/* X <- D^2 */
+		gfb254_square(&X, &D);
+
+		/* tmp <- E = Y + T + D */
+		gfb254_add(&tmp, &D, &Y);
+		gfb254_add(&tmp, &tmp, &T);
+
+		/* T <- X*Z */
+		gfb254_mul(&T, &X, &Z);
+
+		/* tmp <- (Y*E + (a + b)*Z)^2 */
+		gfb254_mul(&Y, &Y, &tmp);
+		gfb254_mul_u(&tmp, &Z);
+		gfb254_add(&Y, &Y, &tmp);
+		gfb254_mul_b(&tmp, &Z);
+		gfb254_add(&Y, &Y, &tmp);
+		gfb254_square(&tmp, &Y);
+
+		/* Y <- tmp + (a + 1)*T */
+		gfb254_mul_u1(&Y, &T);
+		gfb254_add(&Y, &Y, &tmp);
+	} while (-- n > 0);
+
+	/*
+	 * Convert back the result to (x,s) coordinates on the right curve.
+	 *   X3 <- sqrt(b)*Z
+	 *   Z3 <- X
+	 *   S3 <- sqrt(b)*(Y + (a + 1)*T + X^2) = sqrt(b)*(tmp + X^2)
+	 *   T3 <- sqrt(b)*T
+	 */
+	gfb254_mul_sb(&p3->X, &Z);
+	p3->Z = X;
+	gfb254_square(&X, &X);
+	gfb254_add(&X, &X, &tmp);
+	gfb254_mul_sb(&p3->S, &X);
+	gfb254_mul_sb(&p3->T, &T);
+}
+
+/* see gls254.h */
+void
+gls254_add_x4(gls254_point *p3,
+	const gls254_point *p1, const gls254_point *p2)
+{
+#if GLS254_VPCLMUL
+	gls254_point_x4 q1, q2;
+	gfb254x4 D, S1S2, E, F, G, t;
+
+	/* Same formulas as gls254_add(). */
+	ldpoint_x4(&q1, p1);
+	ldpoint_x4(&q2, p2);
+
+	gfb254x4_add(&D, &q1.S, &q1.T);
+	gfb254x4_add(&t, &q2.S, &q2.T);
+	gfb254x4_mul(&D, &D, &t);
+	gfb254x4_mul(&S1S2, &q1.S, &q2.S);
+	gfb254x4_mul(&E, &q1.T, &q2.T);
+	gfb254x4_mul_u1(&E, &E);
+	gfb254x4_mul(&F, &q1.X, &q2.X);
+	gfb254x4_square(&F, &F);
+	gfb254x4_mul(&G, &q1.Z, &q2.Z);
+	gfb254x4_square(&G, &G);
+
+	gfb254x4_add(&q1.X, &D, &S1S2);
+	gfb254x4_add(&D, &D, &E);
+	gfb254x4_add(&S1S2, &S1S2, &E);
+	gfb254x4_mul(&D, &D, &F);
+	gfb254x4_mul(&S1S2, &S1S2, &G);
+	gfb254x4_add(&t, &D, &S1S2);
+	gfb254x4_mul_sb(&q1.S, &t);
+	gfb254x4_add(&t, &F, &G);
+	gfb254x4_mul_sb(&q1.Z, &t);
+	gfb254x4_mul(&q1.T, &q1.X, &q1.Z);
+	stpoint_x4(p3, &q1);
+#else
+	for (int i = 0; i < 4; i ++) {
+		gls254_add(&p3[i], &p1[i], &p2[i]);
+	}
+#endif
+}
+
+/* see gls254.h */
+void
+gls254_xdouble_x4(gls254_point *p3, const gls254_point *p1, unsigned n)
+{
+#if GLS254_VPCLMUL
+	gls254_point_x4 q;
+	gfb254x4 X, Y, Z, T, tmp;
+
+	if (n == 0) {
+		if (p3 != p1) {
+			memmove(p3, p1, 4 * sizeof(gls254_point));
+		}
+		return;
+	}
+
+	/* Same formulas as gls254_xdouble(). */
+	ldpoint_x4(&q, p1);
+	gfb254x4_mul_sb(&X, &q.X);
+	gfb254x4_mul_sb(&T, &q.T);
+	Z = q.Z;
+	gfb254x4_mul_sb(&Y, &q.S);
+	gfb254x4_square(&tmp, &X);
+	gfb254x4_add(&Y, &Y, &tmp);
+	gfb254x4_mul_u(&tmp, &T);
+	gfb254x4_add(&Y, &Y, &tmp);
+
+	do {
+		gfb254x4 D;
+
+		gfb254x4_mul_sb(&D, &Z);
+		gfb254x4_add(&D, &D, &X);
+		gfb254x4_square(&D, &D);
+		gfb254x4_square(&Z, &T);
+		gfb254x4_square(&X, &D);
+		gfb254x4_add(&tmp, &D, &Y);
+		gfb254x4_add(&tmp, &tmp, &T);
+		gfb254x4_mul(&T, &X, &Z);
+		gfb254x4_mul(&Y, &Y, &tmp);
+		gfb254x4_mul_u(&tmp, &Z);
+		gfb254x4_add(&Y, &Y, &tmp);
+		gfb254x4_mul_b(&tmp, &Z);
+		gfb254x4_add(&Y, &Y, &tmp);
+		gfb254x4_square(&tmp, &Y);
+		gfb254x4_mul_u1(&Y, &T);
+		gfb254x4_add(&Y, &Y, &tmp);
+	} while (-- n > 0);
+
+	gfb254x4_mul_sb(&q.X, &Z);
+	q.Z = X;
+	gfb254x4_square(&X, &X);
+	gfb254x4_add(&X, &X, &tmp);
+	gfb254x4_mul_sb(&q.S, &X);
+	gfb254x4_mul_sb(&q.T, &T);
+	stpoint_x4(p3, &q);
+#else
+	for (int i = 0; i < 4; i ++) {
+		gls254_xdouble(&p3[i], &p1[i], n);
+	}
+#endif
+}
+
+/* see gls254.h */
+void
+gls254_zeta_affine(gls254_point_affine *p2,
+	const gls254_point_affine *p1, uint32_t zn)
+{
+	gfb127 x0, x1, s0, s1, t;
+
+	/*
+	 * zeta(x, s) = (x', s'):
+	 *   x' = (x0 + x1) + x1*u
+	 *   s' = (s0 + s1 + x0) + (s1 + x0 + x1)*u
+	 * If zn is True, then s' should be replaced with s'':
+	 *   s'' = s' + x'
+	 *       = (s0 + s1 + x1) + (s1 + x0)*u
+	 */
+	x0 = p1->scaled_x.v[0];
+	x1 = p1->scaled_x.v[1];
+	s0 = p1->scaled_s.v[0];
+	s1 = p1->scaled_s.v[1];
+	gfb127_add(&p2->scaled_x.v[0], &x0, &x1);
+	p2->scaled_x.v[1] = x1;
+
+	/* t <- x0 (zn = 0) or x1 (zn = -1) */
+	t = x0;
+	gfb127_set_cond(&t, &x1, zn);
+	gfb127_add(&p2->scaled_s.v[0], &s0, &s1);
+	gfb127_add(&p2->scaled_s.v[0], &p2->scaled_s.v[0], &t);
+
+	/* t <- x0 + x1 (zn = 0) or x0 (zn = -1) */
+	gfb127_add(&t, &x0, &x1);
+	gfb127_set_cond(&t, &x0, zn);
+	gfb127_add(&p2->scaled_s.v[1], &s1, &t);
+}
+
+/*
+ * Normalize n points (in place) into affine coordinates, using a single
+ * inversion. The affine coordinates are written in win[]. Points p[]
+ * are consumed (their X and Z coordinates are used as scratch space).
+ */
+static void
+normalize_window(gls254_point_affine *win, gls254_point *p, size_t n)
+{
+	gfb254 r;
+
+	/*
+	 * For all points, the X coordinate receives the product of all
+	 * previous Z coordinates. We then invert the complete product,
+	 * and propagate the inverse backwards.
+	 */
+	r = p[0].Z;
+	for (size_t i = 1; i < n; i ++) {
+		p[i].X = r;
+		gfb254_mul(&r, &r, &p[i].Z);
+	}
+	gfb254_invert(&r, &r);
+	for (size_t i = n - 1; i > 0; i --) {
+		gfb254_mul(&p[i].X, &p[i].X, &r);
+		gfb254_mul(&r, &r, &p[i].Z);
+	}
+	p[0].X = r;
+
+	/*
+	 * Each X slot now contains 1/Z. Affine normalization is:
+	 *   scaled_x <- T/Z^2
+	 *   scaled_s <- S/Z^2
+	 */
+	for (size_t i = 0; i < n; i ++) {
+		gfb254_square(&r, &p[i].X);
+		gfb254_mul(&win[i].scaled_x, &p[i].T, &r);
+		gfb254_mul(&win[i].scaled_s, &p[i].S, &r);
+	}
+}
+
+/* see gls254.h */
+void
+gls254_make_window_affine_8(gls254_point_affine *win, const gls254_point *p)
+{
+	gls254_point pp[8];
+
+	pp[0] = *p;
+	gls254_xdouble(&pp[1], p, 1);
+	gls254_add(&pp[2], &pp[1], p);
+	gls254_xdouble(&pp[3], &pp[1], 1);
+	gls254_add(&pp[4], &pp[2], &pp[1]);
+	gls254_xdouble(&pp[5], &pp[2], 1);
+	gls254_add(&pp[6], &pp[4], &pp[1]);
+	gls254_xdouble(&pp[7], &pp[3], 1);
+	normalize_window(win, pp, 8);
+}
+
+/* see gls254.h */
+void
+gls254_lookup8_affine(gls254_point_affine *p,
+	const gls254_point_affine *win, int8_t k)
+{
+	uint32_t sk, ak;
+
+	/* sk <- sign(k); ak <- abs(k) */
+	sk = (uint32_t)((int32_t)k >> 31);
+	ak = ((uint32_t)(int32_t)k ^ sk) - sk;
+
+	/* Default value is the neutral: X = 0, S = sqrt(b). */
+	memset(&p->scaled_x, 0, sizeof p->scaled_x);
+	p->scaled_s = SQRT_B;
+	for (uint32_t i = 0; i < 8; i ++) {
+		uint32_t m = -(((ak ^ (i + 1)) - 1) >> 31);
+		gfb254_set_cond(&p->scaled_x, &win[i].scaled_x, m);
+		gfb254_set_cond(&p->scaled_s, &win[i].scaled_s, m);
+	}
+
+	/* Conditional negate: add X to S, but only if k < 0. */
+	for (int i = 0; i < 4; i ++) {
+		p->scaled_s.v[0].v[i] ^= sk & p->scaled_x.v[0].v[i];
+		p->scaled_s.v[1].v[i] ^= sk & p->scaled_x.v[1].v[i];
+	}
+}
+
+/* see gls254.h */
+void
+gls254_normalize(gls254_point_affine *q, const gls254_point *p)
+{
+	gfb254 t;
+
+	/* scaled_x = T/Z^2, scaled_s = S/Z^2 */
+	gfb254_square(&t, &p->Z);
+	gfb254_invert(&t, &t);
+	gfb254_mul(&q->scaled_x, &p->T, &t);
+	gfb254_mul(&q->scaled_s, &p->S, &t);
+}
+
+/* see gls254.h */
+void
+gls254_from_affine(gls254_point *q, const gls254_point_affine *p)
+{
+	q->X = p->scaled_x;
+	q->S = p->scaled_s;
+	memset(&q->Z, 0, sizeof q->Z);
+	q->Z.v[0].v[0] = 1;
+	q->T = p->scaled_x;
+}
+
+/* see inner.h */
+uint32_t
+gls254_uncompressed_decode(gls254_point_affine *p, const void *src)
+{
+	gfb254 t0, t1;
+	gfb127 h;
+	uint32_t r;
+
+	/* Decode the two coordinates. */
+	r = gfb254_decode32(&p->scaled_x, src);
+	r &= gfb254_decode32(&p->scaled_s, (const uint8_t *)src + 32);
+
+	/* Compute the unscaled X coordinate and check that its trace
+	   is 0. We only need the high half of sqrt(b)*scaled_x. */
+	gfb127_mul_sb(&h, &p->scaled_x.v[1]);
+	r &= gfb127_trace(&h) - 1;
+
+	/*
+	 * Verify the curve equation. In extended coordinates:
+	 *    S^2 + T*S = (sqrt(b)*X^2 + a*T + sqrt(b)*Z^2)^2
+	 * We have an affine point, hence:
+	 *    X = scaled_x
+	 *    S = scaled_s
+	 *    Z = 1
+	 *    T = scaled_x
+	 */
+	gfb254_square(&t0, &p->scaled_x);
+	t0.v[0].v[0] ^= 1;
+	gfb254_mul_sb(&t0, &t0);
+	gfb254_mul_u(&t1, &p->scaled_x);
+	gfb254_add(&t0, &t0, &t1);
+	gfb254_square(&t0, &t0);
+	gfb254_add(&t1, &p->scaled_x, &p->scaled_s);
+	gfb254_mul(&t1, &t1, &p->scaled_s);
+	return r & gfb254_equals(&t0, &t1);
+}
+
+/* see inner.h */
+void
+gls254_uncompressed_encode(void *dst, const gls254_point_affine *p)
+{
+	gfb254_encode(dst, &p->scaled_x);
+	gfb254_encode((uint8_t *)dst + 32, &p->scaled_s);
+}
+
+/* see inner.h */
+void
+gls254_map_to_point(gls254_point *p, const void *src)
+{
+	gfb254 m1, m2, m3, e1, e2, e3, t, w;
+	uint32_t tr, c2, c3;
+
+	/* Read the source bytes and interpret them as a GF(2^254)
+	   element, by ignoring the top bits. */
+	gfb254_decode32_trunc(&m1, src);
+
+	/* Force bits 0 and 1 of the high half to 1 and 0 respectively.
+	   Also remember the original trace. */
+	tr = m1.v[1].v[0] & 1;
+	m1.v[1].v[0] = (m1.v[1].v[0] & ~(uint32_t)3) | 1;
+
+	/*
+	 * m_1 = c
+	 * m_2 = c + z^2
+	 * m_3 = c + c^2/z^2
+	 */
+	m2 = m1;
+	m2.v[0].v[0] ^= 4;
+	gfb254_square(&m3, &m1);
+	gfb254_div_z2(&m3, &m3);
+	gfb254_add(&m3, &m3, &m1);
+
+	/*
+	 * e_i = b/m_i (with a single inversion)
+	 */
+	gfb254_mul(&e1, &m1, &m2);
+	gfb254_mul(&e2, &e1, &m3);
+	gfb254_invert(&e2, &e2);
+	gfb254_mul(&e3, &e1, &e2);
+	gfb254_mul(&t, &e2, &m3);
+	gfb254_mul(&e1, &t, &m2);
+	gfb254_mul(&e2, &t, &m1);
+	gfb254_mul_b(&e1, &e1);
+	gfb254_mul_b(&e2, &e2);
+	gfb254_mul_b(&e3, &e3);
+
+	/* Select the minimal index i such that Tr(e_i) = 0, and write
+	   m_i and e_i in m1 and e1, respectively. */
+	c2 = -gfb254_trace(&e1);
+	c3 = c2 & -gfb254_trace(&e2);
+	gfb254_set_cond(&m1, &m2, c2);
+	gfb254_set_cond(&m1, &m3, c3);
+	gfb254_set_cond(&e1, &e2, c2);
+	gfb254_set_cond(&e1, &e3, c3);
+
+	/* d <- sqrt(m) (into m1); w <- qsolve(d), with lsb(w) adjusted
+	   to match the original trace of the input. */
+	gfb254_sqrt(&m1, &m1);
+	gfb254_qsolve(&w, &m1);
+	w.v[0].v[0] = (w.v[0].v[0] & ~(uint32_t)1) | tr;
+
+	/*
+	 * We now have:
+	 *   m1   d = w^2 + w + a
+	 *   w    w
+	 *   e1   e = b/d^2 with Tr(e) = 0
+	 * We can finish decoding w into a point:
+	 *   f <- qsolve(e)
+	 *   x <- d*f
+	 *   if Tr(x) = 1, then: x <- x + d
+	 *   s <- x*w^2
+	 */
+	gfb254_qsolve(&e1, &e1);
+	gfb254_mul(&e1, &e1, &m1);
+	gfb254_add(&t, &e1, &m1);
+	gfb254_set_cond(&e1, &t, -gfb254_trace(&e1));
+	p->X = e1;
+	gfb254_square(&w, &w);
+	gfb254_mul(&p->S, &p->X, &w);
+
+	/* Adjust the scaling of S, fill Z and T. */
+	gfb254_mul_sb(&p->S, &p->S);
+	gfb254_mul_sb(&p->T, &p->X);
+	p->Z = SQRT_B;
+}
+
+#ifdef GLS254_BACKEND_SUFFIX
+/*
+ * Table of all functions of this variant (with renamed names), for
+ * runtime dispatch.
+ */
+#define GLS254_STRINGIFY_(x)   #x
+#define GLS254_STRINGIFY(x)    GLS254_STRINGIFY_(x)
+#define GLS254_BACKEND_ENTRY(ret, name, params, args)   name,
+const gls254_backend GLS254_CONCAT(gls254_backend, GLS254_BACKEND_SUFFIX) = {
+	/* skip the leading '_' of the suffix */
+	GLS254_STRINGIFY(GLS254_BACKEND_SUFFIX) + 1,
+	GLS254_BACKEND_FUNCTIONS(GLS254_BACKEND_ENTRY, GLS254_BACKEND_ENTRY)
+};
+#endif
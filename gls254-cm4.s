@@ -3321,6 +3321,69 @@ Lgls254_xdouble_exit:
 	pop	{ r4, r5, r6, r7, r8, r10, r11, pc }
 	.size	gls254_xdouble, .-gls254_xdouble
 
+@ =======================================================================
+@ void gls254_add_x4(gls254_point *p3,
+@                    const gls254_point *p1, const gls254_point *p2)
+@
+@ Uses the external ABI. There is no lane-parallel implementation on
+@ this architecture: this calls gls254_add() on each of the 4 lanes.
+@ =======================================================================
+
+	.align	1
+	.global	gls254_add_x4
+	.thumb
+	.thumb_func
+	.type	gls254_add_x4, %function
+gls254_add_x4:
+	push	{ r4, r5, r6, r7, r8, lr }
+	mov	r4, r0
+	mov	r5, r1
+	mov	r6, r2
+	movs	r7, #4
+Lgls254_add_x4_loop:
+	mov	r0, r4
+	mov	r1, r5
+	mov	r2, r6
+	bl	gls254_add
+	adds	r4, #128
+	adds	r5, #128
+	adds	r6, #128
+	subs	r7, #1
+	bne	Lgls254_add_x4_loop
+	pop	{ r4, r5, r6, r7, r8, pc }
+	.size	gls254_add_x4, .-gls254_add_x4
+
+@ =======================================================================
+@ void gls254_xdouble_x4(gls254_point *p3,
+@                        const gls254_point *p1, unsigned n)
+@
+@ Uses the external ABI. There is no lane-parallel implementation on
+@ this architecture: this calls gls254_xdouble() on each of the 4 lanes.
+@ =======================================================================
+
+	.align	1
+	.global	gls254_xdouble_x4
+	.thumb
+	.thumb_func
+	.type	gls254_xdouble_x4, %function
+gls254_xdouble_x4:
+	push	{ r4, r5, r6, r7, r8, lr }
+	mov	r4, r0
+	mov	r5, r1
+	mov	r6, r2
+	movs	r7, #4
+Lgls254_xdouble_x4_loop:
+	mov	r0, r4
+	mov	r1, r5
+	mov	r2, r6
+	bl	gls254_xdouble
+	adds	r4, #128
+	adds	r5, #128
+	subs	r7, #1
+	bne	Lgls254_xdouble_x4_loop
+	pop	{ r4, r5, r6, r7, r8, pc }
+	.size	gls254_xdouble_x4, .-gls254_xdouble_x4
+
 @ =======================================================================
 @ void inner_gls254_zeta_affine(gls254_point_affine *p2,
 @                               const gls254_point_affine *p1, uint32_t zn)
@@ -4352,6 +4415,406 @@ gls254_map_to_point:
 	pop	{ r4, r5, r6, r7, r8, r10, r11, pc }
 	.size	gls254_map_to_point, .-gls254_map_to_point
 
+@ =======================================================================
+@ SCALAR FUNCTIONS
+@ =======================================================================
+
+@ These functions implement the integer multiplications and the partial
+@ reduction modulo r used by scalar.c (which calls them when compiled with
+@ GLS254_SCALAR_ASM=1). Integers (types i128, i256, i384 and i512 in
+@ scalar.c) are sequences of 32-bit limbs in little-endian order. The
+@ multiplications rely on UMAAL, which computes a 32x32->64 product plus
+@ two 32-bit addends without overflow and without modifying the flags.
+@ All functions are constant-time.
+
+@ =======================================================================
+@ void scalar_mul128x128(i256 *d, const i128 *a, const i128 *b)
+@
+@ Multiply two 128-bit integers (four 32-bit limbs each, little-endian
+@ order); the 256-bit product is written in d. Operand scanning with
+@ UMAAL: each row adds a*b[j] into a sliding window of four limbs.
+@
+@ Uses the external ABI.
+@ =======================================================================
+
+	.align	1
+	.global	scalar_mul128x128
+	.thumb
+	.thumb_func
+	.type	scalar_mul128x128, %function
+scalar_mul128x128:
+	push	{ r4, r5, r6, r7, r8, r10, r11, lr }
+	ldm	r1, { r3, r4, r5, r6 }
+	ldr	r7, [r2]
+	umull	r8, lr, r3, r7
+	mov	r10, #0
+	umaal	r10, lr, r4, r7
+	mov	r11, #0
+	umaal	r11, lr, r5, r7
+	mov	r12, #0
+	umaal	r12, lr, r6, r7
+	str	r8, [r0]
+	ldr	r7, [r2, #4]
+	mov	r8, #0
+	umaal	r10, r8, r3, r7
+	umaal	r11, r8, r4, r7
+	umaal	r12, r8, r5, r7
+	umaal	lr, r8, r6, r7
+	str	r10, [r0, #4]
+	ldr	r7, [r2, #8]
+	mov	r10, #0
+	umaal	r11, r10, r3, r7
+	umaal	r12, r10, r4, r7
+	umaal	lr, r10, r5, r7
+	umaal	r8, r10, r6, r7
+	str	r11, [r0, #8]
+	ldr	r7, [r2, #12]
+	mov	r11, #0
+	umaal	r12, r11, r3, r7
+	umaal	lr, r11, r4, r7
+	umaal	r8, r11, r5, r7
+	umaal	r10, r11, r6, r7
+	str	r12, [r0, #12]
+	strd	lr, r8, [r0, #16]
+	strd	r10, r11, [r0, #24]
+	pop	{ r4, r5, r6, r7, r8, r10, r11, pc }
+	.size	scalar_mul128x128, .-scalar_mul128x128
+
+@ =======================================================================
+@ void scalar_mul256x256(i512 *d, const i256 *a, const i256 *b)
+@
+@ Multiply two 256-bit integers; the 512-bit product is written in d.
+@ The low half of a is multiplied by b (eight rows), then the high half
+@ (eight more rows, accumulated onto the output limbs). UMAAL does not
+@ modify the flags, so the carry of the additions of the limbs from the
+@ first pass is kept in the C flag across rows.
+@
+@ Uses the external ABI.
+@ =======================================================================
+
+	.align	1
+	.global	scalar_mul256x256
+	.thumb
+	.thumb_func
+	.type	scalar_mul256x256, %function
+scalar_mul256x256:
+	push	{ r4, r5, r6, r7, r8, r10, r11, lr }
+
+	@ First pass: a[0..3]*b -> d[0..11].
+	ldm	r1!, { r3, r4, r5, r6 }
+	ldr	r7, [r2]
+	umull	r8, lr, r3, r7
+	mov	r10, #0
+	umaal	r10, lr, r4, r7
+	mov	r11, #0
+	umaal	r11, lr, r5, r7
+	mov	r12, #0
+	umaal	r12, lr, r6, r7
+	str	r8, [r0]
+	ldr	r7, [r2, #4]
+	mov	r8, #0
+	umaal	r10, r8, r3, r7
+	umaal	r11, r8, r4, r7
+	umaal	r12, r8, r5, r7
+	umaal	lr, r8, r6, r7
+	str	r10, [r0, #4]
+	ldr	r7, [r2, #8]
+	mov	r10, #0
+	umaal	r11, r10, r3, r7
+	umaal	r12, r10, r4, r7
+	umaal	lr, r10, r5, r7
+	umaal	r8, r10, r6, r7
+	str	r11, [r0, #8]
+	ldr	r7, [r2, #12]
+	mov	r11, #0
+	umaal	r12, r11, r3, r7
+	umaal	lr, r11, r4, r7
+	umaal	r8, r11, r5, r7
+	umaal	r10, r11, r6, r7
+	str	r12, [r0, #12]
+	ldr	r7, [r2, #16]
+	mov	r12, #0
+	umaal	lr, r12, r3, r7
+	umaal	r8, r12, r4, r7
+	umaal	r10, r12, r5, r7
+	umaal	r11, r12, r6, r7
+	str	lr, [r0, #16]
+	ldr	r7, [r2, #20]
+	mov	lr, #0
+	umaal	r8, lr, r3, r7
+	umaal	r10, lr, r4, r7
+	umaal	r11, lr, r5, r7
+	umaal	r12, lr, r6, r7
+	str	r8, [r0, #20]
+	ldr	r7, [r2, #24]
+	mov	r8, #0
+	umaal	r10, r8, r3, r7
+	umaal	r11, r8, r4, r7
+	umaal	r12, r8, r5, r7
+	umaal	lr, r8, r6, r7
+	str	r10, [r0, #24]
+	ldr	r7, [r2, #28]
+	mov	r10, #0
+	umaal	r11, r10, r3, r7
+	umaal	r12, r10, r4, r7
+	umaal	lr, r10, r5, r7
+	umaal	r8, r10, r6, r7
+	str	r11, [r0, #28]
+	strd	r12, lr, [r0, #32]
+	strd	r8, r10, [r0, #40]
+
+	@ Second pass: a[4..7]*b added to d[4..15].
+	ldm	r1, { r3, r4, r5, r6 }
+	ldrd	r8, r10, [r0, #16]
+	ldrd	r11, r12, [r0, #24]
+	ldr	r7, [r2]
+	mov	lr, #0
+	umaal	r8, lr, r3, r7
+	umaal	r10, lr, r4, r7
+	umaal	r11, lr, r5, r7
+	umaal	r12, lr, r6, r7
+	str	r8, [r0, #16]
+	ldr	r7, [r0, #32]
+	adds	lr, lr, r7
+	ldr	r7, [r2, #4]
+	mov	r8, #0
+	umaal	r10, r8, r3, r7
+	umaal	r11, r8, r4, r7
+	umaal	r12, r8, r5, r7
+	umaal	lr, r8, r6, r7
+	str	r10, [r0, #20]
+	ldr	r7, [r0, #36]
+	adcs	r8, r8, r7
+	ldr	r7, [r2, #8]
+	mov	r10, #0
+	umaal	r11, r10, r3, r7
+	umaal	r12, r10, r4, r7
+	umaal	lr, r10, r5, r7
+	umaal	r8, r10, r6, r7
+	str	r11, [r0, #24]
+	ldr	r7, [r0, #40]
+	adcs	r10, r10, r7
+	ldr	r7, [r2, #12]
+	mov	r11, #0
+	umaal	r12, r11, r3, r7
+	umaal	lr, r11, r4, r7
+	umaal	r8, r11, r5, r7
+	umaal	r10, r11, r6, r7
+	str	r12, [r0, #28]
+	ldr	r7, [r0, #44]
+	adcs	r11, r11, r7
+	ldr	r7, [r2, #16]
+	mov	r12, #0
+	umaal	lr, r12, r3, r7
+	umaal	r8, r12, r4, r7
+	umaal	r10, r12, r5, r7
+	umaal	r11, r12, r6, r7
+	str	lr, [r0, #32]
+	adcs	r12, r12, #0
+	ldr	r7, [r2, #20]
+	mov	lr, #0
+	umaal	r8, lr, r3, r7
+	umaal	r10, lr, r4, r7
+	umaal	r11, lr, r5, r7
+	umaal	r12, lr, r6, r7
+	str	r8, [r0, #36]
+	adcs	lr, lr, #0
+	ldr	r7, [r2, #24]
+	mov	r8, #0
+	umaal	r10, r8, r3, r7
+	umaal	r11, r8, r4, r7
+	umaal	r12, r8, r5, r7
+	umaal	lr, r8, r6, r7
+	str	r10, [r0, #40]
+	adcs	r8, r8, #0
+	ldr	r7, [r2, #28]
+	mov	r10, #0
+	umaal	r11, r10, r3, r7
+	umaal	r12, r10, r4, r7
+	umaal	lr, r10, r5, r7
+	umaal	r8, r10, r6, r7
+	str	r11, [r0, #44]
+	adcs	r10, r10, #0
+	strd	r12, lr, [r0, #48]
+	strd	r8, r10, [r0, #56]
+	pop	{ r4, r5, r6, r7, r8, r10, r11, pc }
+	.size	scalar_mul256x256, .-scalar_mul256x256
+
+@ =======================================================================
+@ void scalar_modr_reduce384_partial(i256 *d, const i384 *a)
+@
+@ Given input a (up to 2^384-1), perform a partial reduction modulo r;
+@ output (into d) fits on 254 bits (hence lower than 2*r). This computes
+@ the same value as the C code in scalar.c:
+@   t = a0 - 8*r0*a1  (with a = a0 + a1*2^256, and 2^256 = -8*r0 mod r)
+@   t = t + 16*r  if t < 0
+@   t = t - r0*floor(t / 2^253), then add r back if negative
+@
+@ Uses the external ABI.
+@ =======================================================================
+
+	.align	1
+	.global	scalar_modr_reduce384_partial
+	.thumb
+	.thumb_func
+	.type	scalar_modr_reduce384_partial, %function
+scalar_modr_reduce384_partial:
+	push	{ r4, r5, r6, r7, r8, r10, r11, lr }
+	sub	sp, #16
+
+	@ Compute a1*(8*r0) = a1*(8*r0 mod 2^128) + a1*2^128 with the same
+	@ rows as in scalar_mul128x128(); the low limbs are subtracted from
+	@ a0 as soon as they are final (t0..t3 go to the stack).
+	ldrd	r3, r4, [r1, #32]
+	ldrd	r5, r6, [r1, #40]
+	movw	r7, #0x67A8
+	movt	r7, #0xA1D4
+	umull	r8, lr, r3, r7
+	mov	r10, #0
+	umaal	r10, lr, r4, r7
+	mov	r11, #0
+	umaal	r11, lr, r5, r7
+	mov	r12, #0
+	umaal	r12, lr, r6, r7
+	ldr	r2, [r1]
+	subs	r2, r2, r8
+	str	r2, [sp]
+	movw	r7, #0x1BE7
+	movt	r7, #0xE5EF
+	mov	r8, #0
+	umaal	r10, r8, r3, r7
+	umaal	r11, r8, r4, r7
+	umaal	r12, r8, r5, r7
+	umaal	lr, r8, r6, r7
+	ldr	r2, [r1, #4]
+	sbcs	r2, r2, r10
+	str	r2, [sp, #4]
+	movw	r7, #0xED69
+	movt	r7, #0xE0D0
+	mov	r10, #0
+	umaal	r11, r10, r3, r7
+	umaal	r12, r10, r4, r7
+	umaal	lr, r10, r5, r7
+	umaal	r8, r10, r6, r7
+	ldr	r2, [r1, #8]
+	sbcs	r2, r2, r11
+	str	r2, [sp, #8]
+	movw	r7, #0x3EF6
+	movt	r7, #0xF8D2
+	mov	r11, #0
+	umaal	r12, r11, r3, r7
+	umaal	lr, r11, r4, r7
+	umaal	r8, r11, r5, r7
+	umaal	r10, r11, r6, r7
+	ldr	r2, [r1, #12]
+	sbcs	r2, r2, r12
+	str	r2, [sp, #12]
+	mov	r7, #1
+	mov	r2, #0
+	umaal	lr, r2, r3, r7
+	umaal	r8, r2, r4, r7
+	umaal	r10, r2, r5, r7
+	umaal	r11, r2, r6, r7
+	@ Subtract the high limbs; t8 (in r7) is 0, -1 or -2.
+	ldrd	r3, r4, [r1, #16]
+	ldrd	r5, r6, [r1, #24]
+	sbcs	r3, r3, lr
+	sbcs	r4, r4, r8
+	sbcs	r5, r5, r10
+	sbcs	r6, r6, r11
+	mov	r7, #0
+	sbc	r7, r7, r2
+
+	@ Add 16*r if t < 0.
+	ldm	sp, { r8, r10, r11, r12 }
+	asr	r2, r7, #31
+	movw	lr, #0xCF50
+	movt	lr, #0x43A8
+	and	lr, lr, r2
+	adds	r8, r8, lr
+	movw	lr, #0x37CF
+	movt	lr, #0xCBDE
+	and	lr, lr, r2
+	adcs	r10, r10, lr
+	movw	lr, #0xDAD3
+	movt	lr, #0xC1A1
+	and	lr, lr, r2
+	adcs	r11, r11, lr
+	movw	lr, #0x7DED
+	movt	lr, #0xF1A4
+	and	lr, lr, r2
+	adcs	r12, r12, lr
+	and	lr, r2, #3
+	adcs	r3, r3, lr
+	adcs	r4, r4, #0
+	adcs	r5, r5, #0
+	adcs	r6, r6, #0
+	and	lr, r2, #2
+	adc	r7, r7, lr
+
+	@ Partial reduction: with 2^253 = -r0 mod r, subtract r0*ah from
+	@ the low 253 bits, where ah = floor(t / 2^253).
+	lsl	r7, r7, #3
+	orr	r7, r7, r6, lsr #29
+	bic	r6, r6, #0xE0000000
+	mov	r1, #0
+	movw	lr, #0x8CF5
+	movt	lr, #0xF43A
+	mov	r2, #0
+	umaal	r2, r1, r7, lr
+	subs	r8, r8, r2
+	movw	lr, #0xE37C
+	movt	lr, #0x3CBD
+	mov	r2, #0
+	umaal	r2, r1, r7, lr
+	sbcs	r10, r10, r2
+	movw	lr, #0x1DAD
+	movt	lr, #0xDC1A
+	mov	r2, #0
+	umaal	r2, r1, r7, lr
+	sbcs	r11, r11, r2
+	movw	lr, #0x47DE
+	movt	lr, #0x3F1A
+	mov	r2, #0
+	umaal	r2, r1, r7, lr
+	sbcs	r12, r12, r2
+	sbcs	r3, r3, r1
+	sbcs	r4, r4, #0
+	sbcs	r5, r5, #0
+	sbcs	r6, r6, #0
+
+	@ If there was a borrow, add r once.
+	sbc	r2, r2, r2
+	movw	lr, #0x8CF5
+	movt	lr, #0xF43A
+	and	lr, lr, r2
+	adds	r8, r8, lr
+	movw	lr, #0xE37C
+	movt	lr, #0x3CBD
+	and	lr, lr, r2
+	adcs	r10, r10, lr
+	movw	lr, #0x1DAD
+	movt	lr, #0xDC1A
+	and	lr, lr, r2
+	adcs	r11, r11, lr
+	movw	lr, #0x47DE
+	movt	lr, #0x3F1A
+	and	lr, lr, r2
+	adcs	r12, r12, lr
+	adcs	r3, r3, #0
+	adcs	r4, r4, #0
+	adcs	r5, r5, #0
+	and	r2, r2, #0x20000000
+	adc	r6, r6, r2
+	strd	r8, r10, [r0]
+	strd	r11, r12, [r0, #8]
+	strd	r3, r4, [r0, #16]
+	strd	r5, r6, [r0, #24]
+
+	add	sp, #16
+	pop	{ r4, r5, r6, r7, r8, r10, r11, pc }
+	.size	scalar_modr_reduce384_partial, .-scalar_modr_reduce384_partial
+
 @ =======================================================================
 @ UTILITY FUNCTIONS FOR BENCHMARKS
 @ =======================================================================
@@ -4778,3 +5241,31 @@ bench_gls254_lookup8_affine:
 	add	sp, #584
 	pop	{ r4, r5, r6, r7, r8, r10, r11, pc }
 	.size	bench_gls254_lookup8_affine, .-bench_gls254_lookup8_affine
+
+	.align	1
+	.global	bench_scalar_mul
+	.thumb
+	.thumb_func
+	.type	bench_scalar_mul, %function
+bench_scalar_mul:
+	push	{ r4, r5, r6, r7, r8, r10, r11, lr }
+	sub	sp, #104
+	add	r0, sp, #8
+	add	r1, sp, #40
+	add	r2, sp, #72
+	movw	r7, #0x1004
+	movt	r7, #0xE000
+	ldr	r7, [r7]
+	str	r7, [sp]
+
+	bl	scalar_mul
+
+	movw	r7, #0x1004
+	movt	r7, #0xE000
+	ldr	r0, [r7]
+	ldr	r1, [sp]
+	subs	r0, r1
+	subs	r0, #9
+	add	sp, #104
+	pop	{ r4, r5, r6, r7, r8, r10, r11, pc }
+	.size	bench_scalar_mul, .-bench_scalar_mul
@@ -0,0 +1,207 @@
+/*
+ * Runtime dispatch between the compiled variants of the low-level
+ * functions (see backend.h). The implementation is selected once, on
+ * first use (or at load time, on compilers that support constructor
+ * functions), based on the features of the current CPU:
+ *
+ *   x86_64:   AVX-512 + VPCLMULQDQ if supported, else PCLMULQDQ if
+ *             supported, else portable C code
+ *   AArch64:  PMULL if supported, portable C code otherwise
+ *
+ * All the functions listed in backend.h are defined here and forward
+ * the call to the selected implementation.
+ */
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "backend.h"
+#include "inner.h"
+
+/*
+ * GLS254_DISPATCH_PCLMUL and GLS254_DISPATCH_PMULL indicate whether the
+ * corresponding variants are compiled and linked in. The Makefile adds
+ * the variants based on the compiler target architecture, which is
+ * what the default values below also use.
+ */
+#ifndef GLS254_DISPATCH_PCLMUL
+#if defined __x86_64__ || defined _M_X64
+#define GLS254_DISPATCH_PCLMUL   1
+#else
+#define GLS254_DISPATCH_PCLMUL   0
+#endif
+#endif
+
+#ifndef GLS254_DISPATCH_PMULL
+#if defined __aarch64__ && !defined __AARCH64EB__
+#define GLS254_DISPATCH_PMULL   1
+#else
+#define GLS254_DISPATCH_PMULL   0
+#endif
+#endif
+
+#if GLS254_DISPATCH_PCLMUL
+#if defined _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+#if GLS254_DISPATCH_PMULL && defined __linux__
+#include <sys/auxv.h>
+#ifndef HWCAP_PMULL
+#define HWCAP_PMULL   (1 << 4)
+#endif
+#endif
+
+extern const gls254_backend gls254_backend_generic;
+#if GLS254_DISPATCH_PCLMUL
+extern const gls254_backend gls254_backend_pclmul;
+extern const gls254_backend gls254_backend_vpclmul;
+#endif
+#if GLS254_DISPATCH_PMULL
+extern const gls254_backend gls254_backend_pmull;
+#endif
+
+#if GLS254_DISPATCH_PCLMUL
+/*
+ * Returns 1 if the CPU supports PCLMULQDQ (CPUID leaf 1, bit 1 of ECX).
+ * SSE2 is always present on x86_64.
+ */
+static int
+cpu_has_pclmul(void)
+{
+#if defined _MSC_VER
+	int rr[4];
+
+	__cpuid(rr, 1);
+	return (rr[2] >> 1) & 1;
+#else
+	unsigned eax, ebx, ecx, edx;
+
+	if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+		return 0;
+	}
+	return (ecx >> 1) & 1;
+#endif
+}
+
+/*
+ * Returns 1 if the CPU supports AVX-512F and VPCLMULQDQ, and the OS
+ * saves the ZMM registers on context switches (XCR0 bits 1, 2 and 5 to 7).
+ */
+static int
+cpu_has_vpclmul(void)
+{
+	unsigned ebx7, ecx7, xcr0;
+
+#if defined _MSC_VER
+	int rr[4];
+
+	__cpuid(rr, 1);
+	if (!((rr[2] >> 27) & 1)) {
+		/* no OSXSAVE */
+		return 0;
+	}
+	__cpuidex(rr, 7, 0);
+	ebx7 = (unsigned)rr[1];
+	ecx7 = (unsigned)rr[2];
+	xcr0 = (unsigned)_xgetbv(0);
+#else
+	unsigned eax, ebx, ecx, edx;
+
+	if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) || !((ecx >> 27) & 1)) {
+		/* no OSXSAVE */
+		return 0;
+	}
+	if (__get_cpuid_max(0, NULL) < 7) {
+		return 0;
+	}
+	__cpuid_count(7, 0, eax, ebx, ecx, edx);
+	ebx7 = ebx;
+	ecx7 = ecx;
+	__asm__ volatile ("xgetbv" : "=a" (eax), "=d" (edx) : "c" (0));
+	xcr0 = eax;
+#endif
+	return ((ebx7 >> 16) & 1) && ((ecx7 >> 10) & 1)
+		&& (xcr0 & 0xE6) == 0xE6;
+}
+#endif
+
+#if GLS254_DISPATCH_PMULL
+/*
+ * Returns 1 if the CPU supports PMULL (AArch64 cryptographic extension).
+ */
+static int
+cpu_has_pmull(void)
+{
+#if defined __linux__
+	return (getauxval(AT_HWCAP) & HWCAP_PMULL) != 0;
+#elif defined __APPLE__
+	/* All 64-bit Apple CPUs have the cryptographic extension. */
+	return 1;
+#else
+	return 0;
+#endif
+}
+#endif
+
+static const gls254_backend *
+select_backend(void)
+{
+#if GLS254_DISPATCH_PCLMUL
+	if (cpu_has_pclmul()) {
+		if (cpu_has_vpclmul()) {
+			return &gls254_backend_vpclmul;
+		}
+		return &gls254_backend_pclmul;
+	}
+#endif
+#if GLS254_DISPATCH_PMULL
+	if (cpu_has_pmull()) {
+		return &gls254_backend_pmull;
+	}
+#endif
+	return &gls254_backend_generic;
+}
+
+/*
+ * Selected implementation. If two threads concurrently make the first
+ * call, then both compute and store the same value; the pointer is
+ * atomic so that this is not a data race. Relaxed ordering suffices
+ * since the backend structures are constant.
+ */
+static _Atomic(const gls254_backend *) backend_impl = NULL;
+
+static inline const gls254_backend *
+get_backend(void)
+{
+	const gls254_backend *b;
+
+	b = atomic_load_explicit(&backend_impl, memory_order_relaxed);
+	if (b == NULL) {
+		b = select_backend();
+		atomic_store_explicit(&backend_impl, b, memory_order_relaxed);
+	}
+	return b;
+}
+
+#if defined __GNUC__ || defined __clang__
+/*
+ * Make the selection at load time, before any thread is started.
+ */
+__attribute__((constructor))
+static void
+init_backend(void)
+{
+	(void)get_backend();
+}
+#endif
+
+#define GLS254_FORWARD_R(ret, name, params, args) \
+	ret name params { return get_backend()->f_ ## name args; }
+#define GLS254_FORWARD_V(ret, name, params, args) \
+	ret name params { get_backend()->f_ ## name args; }
+
+GLS254_BACKEND_FUNCTIONS(GLS254_FORWARD_R, GLS254_FORWARD_V)
@@ -86,6 +86,14 @@ uint32_t gls254_decode(gls254_point *p, const void *src);
  */
 void gls254_encode(void *dst, const gls254_point *p);
 
+/*
+ * Encode points `p[0]` to `p[num - 1]` into `32*num` bytes at `*dst`
+ * (32 bytes per point, in order). The output is the same as with
+ * `gls254_encode()` on each point, but a single field inversion is
+ * shared by each group of up to 16 points.
+ */
+void gls254_encode_batch(void *dst, const gls254_point *p, size_t num);
+
 /*
  * Add points `*p1` and `*p2`, with result in `*p3`. The operands need
  * not be distinct structures.
@@ -136,6 +144,20 @@ gls254_double(gls254_point *p3, const gls254_point *p1)
 	gls254_xdouble(p3, p1, 1);
 }
 
+/*
+ * Lane-parallel versions of `gls254_add()` and `gls254_xdouble()`: each
+ * pointer designates an array of 4 points, and the operation is applied
+ * independently on each of the 4 lanes (i.e. `p3[i]` is set to
+ * `p1[i] + p2[i]`, or to `p1[i]` doubled `n` times, for i = 0 to 3).
+ * Arrays may overlap only if they are identical. On x86 CPUs with
+ * AVX-512 and VPCLMULQDQ, the 4 lanes are computed simultaneously;
+ * otherwise, these functions are equivalent to calling the single-lane
+ * functions in a loop.
+ */
+void gls254_add_x4(gls254_point *p3,
+	const gls254_point *p1, const gls254_point *p2);
+void gls254_xdouble_x4(gls254_point *p3, const gls254_point *p1, unsigned n);
+
 /*
  * Fill `win[0]` to `win[7]` with points 1*P to 8*P, respectively. The
  * points are normalized to affine (scaled) coordinates.
@@ -180,6 +202,101 @@ void gls254_add_affine_affine(gls254_point *p3,
  */
 void gls254_mul(gls254_point *q, const gls254_point *p, const void *k);
 
+/*
+ * Scalar split and recoded for `gls254_mul()`: the two halves of the
+ * scalar (from the zeta endomorphism) as signed 4-bit digits, and their
+ * signs. Recoding a scalar once with `gls254_scalar_recode()` saves the
+ * reduction and split work when the same scalar is used for many
+ * multiplications (e.g. a long-term private key). The contents are
+ * opaque; they are as secret as the scalar itself.
+ */
+typedef struct {
+	int8_t sd0[32], sd1[32];
+	uint32_t s0, zn;
+} gls254_scalar_recoded;
+
+/*
+ * Recode the scalar `k` (same encoding as in `gls254_mul()`) into `*sr`.
+ */
+void gls254_scalar_recode(gls254_scalar_recoded *sr, const void *k);
+
+/*
+ * Same as `gls254_mul(q, p, k)`, with `sr` computed from `k` by
+ * `gls254_scalar_recode()`. This is constant-time.
+ */
+void gls254_mul_recoded(gls254_point *q, const gls254_point *p,
+	const gls254_scalar_recoded *sr);
+
+/*
+ * Batch point multiplication: for i = 0 to `num - 1`, point `q[i]` is
+ * set to `k_i*p[i]`, where `k_i` is the 32-byte scalar starting at
+ * offset `32*i` in `k` (same encoding as in `gls254_mul()`). Output
+ * array `q` may be the same as `p`, but they shall not otherwise overlap.
+ * This is constant-time (except for the value of `num`). Independent
+ * multiplications are processed in groups of 4 with the lane-parallel
+ * functions `gls254_add_x4()` and `gls254_xdouble_x4()`.
+ */
+void gls254_mul_batch(gls254_point *q, const gls254_point *p,
+	const void *k, size_t num);
+
+/*
+ * Multi-scalar multiplication: `*q` is set to the sum of `k_i*p[i]`
+ * for i = 0 to `num - 1`, where `k_i` is the 32-byte scalar starting at
+ * offset `32*i` in `k` (same encoding as in `gls254_mul()`). Each scalar
+ * is split into two half-size scalars with the zeta endomorphism, and
+ * the resulting terms are processed with the bucket (Pippenger) method,
+ * by blocks of `GLS254_MSM_BLOCK` input points (a compile-time setting
+ * for curve.c). This is much faster than individual multiplications when
+ * `num` is large. Stack usage is about 60 kB with the default blocks of
+ * 256 points, and about 10 kB with blocks of 32 points (the default when
+ * compiling for an ARM M-profile core such as the Cortex M4).
+ *
+ * THIS FUNCTION IS NOT CONSTANT-TIME. It must be used only with public
+ * points and scalars.
+ */
+void gls254_msm_vartime(gls254_point *q, const gls254_point *p,
+	const void *k, size_t num);
+
+/*
+ * Multi-scalar multiplication for a small number of points: `*q` is set
+ * to the sum of `k_i*p[i]` for i = 0 to `num - 1`, where `k_i` is the
+ * 32-byte scalar starting at offset `32*i` in `k` (same encoding as in
+ * `gls254_mul()`). Points are processed with interleaved windows
+ * (Straus): each point gets its own 8-point window (as in
+ * `gls254_make_window_affine_8()`), and a single chain of doublings is
+ * shared by up to 16 points. For large `num`, `gls254_msm_vartime()` is
+ * faster.
+ *
+ * `gls254_mul_multi()` is constant-time (except for the value of `num`).
+ * `gls254_mul_multi_vartime()` uses width-4 NAF digits, hence fewer
+ * additions; IT IS NOT CONSTANT-TIME and must be used only with public
+ * points and scalars.
+ */
+void gls254_mul_multi(gls254_point *q, const gls254_point *p,
+	const void *k, size_t num);
+void gls254_mul_multi_vartime(gls254_point *q, const gls254_point *p,
+	const void *k, size_t num);
+
+/*
+ * Double-scalar multiplication: `*q` is set to `u*P1 + v*P2` (for
+ * `gls254_mul2_vartime()`), or to `u*P + v*B`, with B the conventional
+ * generator (for `gls254_mul_add_gen_vartime()`). Scalars `u` and `v`
+ * are 32 bytes each, with the same encoding as in `gls254_mul()`. Both
+ * scalars share a single chain of doublings; for the generator, the
+ * precomputed tables of signature verification are used, so that
+ * `gls254_mul_add_gen_vartime()` costs about as much as
+ * `gls254_verify_vartime()`. This is faster than two calls to
+ * `gls254_mul()` (or `gls254_mulgen()`) and an addition.
+ *
+ * THESE FUNCTIONS ARE NOT CONSTANT-TIME. They must be used only with
+ * public points and scalars (e.g. in signature verification).
+ */
+void gls254_mul2_vartime(gls254_point *q,
+	const gls254_point *p1, const void *u,
+	const gls254_point *p2, const void *v);
+void gls254_mul_add_gen_vartime(gls254_point *q,
+	const gls254_point *p, const void *u, const void *v);
+
 /*
  * Same as `gls254_mul(q, &GLS254_BASE, k)`. This uses internal precomputed
  * tables for the conventional generator, and is faster than `gls254_mul()`
@@ -187,11 +304,46 @@ void gls254_mul(gls254_point *q, const gls254_point *p, const void *k);
  */
 void gls254_mulgen(gls254_point *q, const void *k);
 
+/*
+ * Precomputed tables for a fixed point P, to speed up multiplications of
+ * that point by many scalars (e.g. ECDH with a long-lived peer). The
+ * tables contain i*(2^(32*j))*P for i = 1 to 8 and j = 0 to 3 (2 kB),
+ * and `gls254_mul_precomputed()` then uses the same algorithm as
+ * `gls254_mulgen()`. The contents are opaque.
+ */
+typedef struct {
+	gls254_point_affine tab[32];
+} gls254_precomputed_point;
+
+/*
+ * Compute the tables for point `*p` into `*pp`. The cost is about that
+ * of one `gls254_mul()` call.
+ */
+void gls254_precompute_point(gls254_precomputed_point *pp,
+	const gls254_point *p);
+
+/*
+ * Same as `gls254_mul(q, p, k)`, with `pp` computed from point `p` by
+ * `gls254_precompute_point()`. This is constant-time.
+ */
+void gls254_mul_precomputed(gls254_point *q,
+	const gls254_precomputed_point *pp, const void *k);
+
 /*
  * Normalize a point `*p` to affine coordinates.
  */
 void gls254_normalize(gls254_point_affine *q, const gls254_point *p);
 
+/*
+ * Normalize points `p[0]` to `p[num - 1]` to affine coordinates into
+ * `q[0]` to `q[num - 1]`. This yields the same results as calling
+ * `gls254_normalize()` on each point, but a single field inversion is
+ * shared by each group of up to 16 points, which makes it much faster
+ * for large batches. This is constant-time (except for `num`).
+ */
+void gls254_normalize_batch(gls254_point_affine *q,
+	const gls254_point *p, size_t num);
+
 /*
  * Convert a point from affine to extended coordinates.
  */
@@ -231,6 +383,14 @@ void gls254_hash_to_point(gls254_point *p, const char *hash_name,
  */
 void scalar_reduce(void *d, const void *a, size_t a_len);
 
+/*
+ * Reduce a 64-byte integer (`*a`, unsigned little-endian convention) into
+ * a scalar `*d`. This is the same as `scalar_reduce(d, a, 64)`, which uses
+ * it; deriving a scalar from a 64-byte hash or XOF output reduces the
+ * bias to a negligible level.
+ */
+void scalar_reduce64(void *d, const void *a);
+
 /*
  * Test whether a scalar is reduced: returned value is 1 if the scalar `*a`
  * (32 bytes) encodes an integer in the 0 to r-1 range; otherwise, 0 is
@@ -272,6 +432,36 @@ void scalar_mul(void *d, const void *a, const void *b);
  */
 void scalar_half(void *d, const void *a);
 
+/*
+ * Scalar inversion: d <- 1/a mod r (d is set to zero if a = 0 mod r).
+ * This uses the constant-time safegcd algorithm (Bernstein-Yang), which
+ * is much faster than a modular exponentiation.
+ */
+void scalar_invert(void *d, const void *a);
+
+/*
+ * Batch scalar inversion: for i = 0 to `num - 1`, the inverse of the
+ * scalar at offset `32*i` in `a` is written at offset `32*i` in `d`
+ * (zero for a zero scalar). A single inversion is performed (Montgomery's
+ * trick), plus three multiplications per scalar. Arrays `d` and `a`
+ * shall not overlap.
+ */
+void scalar_batch_invert(void *d, const void *a, size_t num);
+
+/*
+ * Lagrange coefficients at zero: given `num` distinct non-zero scalars
+ * x_i (e.g. participant identifiers in a threshold scheme), at offset
+ * `32*i` in `ids`, the coefficient:
+ *   lambda_i = prod_{j != i} x_j/(x_j - x_i) mod r
+ * is written at offset `32*i` in `lambda`. A value shared with Shamir's
+ * scheme is then the sum of lambda_i*s_i over the shares s_i. This costs
+ * a single inversion and about 2*num^2 multiplications. Returned value
+ * is 1 on success, or 0 if an identifier is zero or two identifiers are
+ * equal (all coefficients are then zero). Arrays `lambda` and `ids`
+ * shall not overlap.
+ */
+int scalar_lagrange_coeffs(void *lambda, const void *ids, size_t num);
+
 /*
  * Scalar split: given value mu =
  * 10811011514837737534717025162521437705238749575629098770843741413709931738644
@@ -366,6 +556,21 @@ void gls254_encode_private(void *dst, const gls254_private_key *sk);
  */
 int gls254_decode_public(gls254_public_key *pk, const void *src);
 
+/*
+ * Decode `num` public keys from their encoded forms (`32*num` bytes at
+ * `*src`, 32 bytes per key, in order) into `pk[0]` to `pk[num - 1]`.
+ * Each key is decoded and validated as with `gls254_decode_public()`
+ * (invalid keys are set to the "invalid key" value), but a single field
+ * inversion is shared by each group of up to 16 keys.
+ *
+ * If `valid` is not NULL, then it receives a bitmap of `(num + 7)/8`
+ * bytes: bit `i % 8` of byte `valid[i / 8]` is set to 1 if key `i` was
+ * valid, 0 otherwise. Returned value is 1 if all keys were valid, 0 if
+ * at least one key was invalid.
+ */
+int gls254_decode_public_batch(gls254_public_key *pk, uint8_t *valid,
+	const void *src, size_t num);
+
 /*
  * Encode a public key into exactly 32 bytes.
  */
@@ -415,6 +620,100 @@ void gls254_sign(void *sig, const gls254_private_key *sk,
 int gls254_verify_vartime(const gls254_public_key *pk, const void *sig,
         const char *hash_name, const void *data, size_t data_len);
 
+/*
+ * Extended signatures: the signature (64 bytes) consists of the encoded
+ * R point (32 bytes) followed by the s scalar (32 bytes), instead of the
+ * challenge (16 bytes) followed by s in the normal format. For a given
+ * key, seed and data, `gls254_sign_ext()` uses the same R and s as
+ * `gls254_sign()`. Extended signatures are larger, but allow batch
+ * verification (see `gls254_verify_batch_vartime()`).
+ *
+ * Parameters have the same meaning as for `gls254_sign()` and
+ * `gls254_verify_vartime()`. `gls254_verify_ext_vartime()` returns 1 on
+ * success, 0 on error, and is not constant-time.
+ */
+void gls254_sign_ext(void *sig, const gls254_private_key *sk,
+	const void *seed, size_t seed_len, const char *hash_name,
+	const void *data, size_t data_len);
+int gls254_verify_ext_vartime(const gls254_public_key *pk, const void *sig,
+	const char *hash_name, const void *data, size_t data_len);
+
+/*
+ * An element to verify with `gls254_verify_batch_vartime()`: public key,
+ * extended signature (64 bytes), and signed data (with the same
+ * conventions as in `gls254_verify_vartime()`).
+ */
+typedef struct {
+	const gls254_public_key *pk;
+	const void *sig;
+	const char *hash_name;
+	const void *data;
+	size_t data_len;
+} gls254_verify_item;
+
+/*
+ * Batch verification of `num` extended signatures. Signatures are
+ * processed in groups of up to 16; for each group, a single combined
+ * equation (with 128-bit weights on each signature) is checked, with one
+ * chain of point doublings for the whole group, and a single term for
+ * all signatures that use the same public key. If the combined check
+ * fails, then the signatures of that group are verified one by one to
+ * find out which ones are invalid.
+ *
+ * The weights are derived from the provided randomness (`rnd`, of
+ * length `rnd_len` bytes) and from all the verified values. The caller
+ * should provide some fresh random bytes (e.g. 16 or 32 bytes from the
+ * OS random generator); if `rnd_len` is zero, then verification is
+ * deterministic (the weights are still bound to all verified values
+ * through hashing).
+ *
+ * If `valid` is not NULL, then it receives a bitmap of `(num + 7)/8`
+ * bytes: bit `i % 8` of byte `valid[i / 8]` is set to 1 if signature
+ * `i` is valid, 0 otherwise. Returned value is 1 if all signatures are
+ * valid, 0 otherwise. This function uses about 32 kB of stack space.
+ *
+ * THIS FUNCTION IS NOT CONSTANT-TIME.
+ */
+int gls254_verify_batch_vartime(uint8_t *valid,
+	const gls254_verify_item *items, size_t num,
+	const void *rnd, size_t rnd_len);
+
+/*
+ * Verification context for a public key: a copy of the key and a table
+ * of precomputed multiples of the key (about 2 kB). When many signatures
+ * are verified against the same key, initializing a context once makes
+ * each subsequent verification faster, since the per-call window build
+ * (which includes an inversion) is skipped, and a wider window is used.
+ * The contents are opaque.
+ */
+typedef struct {
+	gls254_public_key pk;
+	gls254_point_affine win[32];
+} gls254_verify_context;
+
+/*
+ * Initialize a verification context for the given public key. If the
+ * key is invalid (neutral, as set by a failed decoding), then the
+ * context is still initialized, but all verifications with it fail.
+ */
+void gls254_verify_context_init(gls254_verify_context *vc,
+	const gls254_public_key *pk);
+
+/*
+ * Verify a signature (normal or extended format) against the public key
+ * of a verification context. These functions return the same results
+ * as `gls254_verify_vartime()` and `gls254_verify_ext_vartime()`,
+ * respectively, with the same parameters.
+ *
+ * THESE FUNCTIONS ARE NOT CONSTANT-TIME.
+ */
+int gls254_verify_ctx_vartime(const gls254_verify_context *vc,
+	const void *sig, const char *hash_name,
+	const void *data, size_t data_len);
+int gls254_verify_ext_ctx_vartime(const gls254_verify_context *vc,
+	const void *sig, const char *hash_name,
+	const void *data, size_t data_len);
+
 /*
  * Symbolic names for classic hash functions. In general, the symbolic
  * name is obtained by removing all punctuation signs from the function
@@ -449,6 +748,40 @@ int gls254_verify_vartime(const gls254_public_key *pk, const void *sig,
 int gls254_ECDH(void *shared_key, const gls254_private_key *sk,
 	const gls254_public_key *pk_peer);
 
+/*
+ * Same as `gls254_ECDH()`, with `sr` computed from the private scalar
+ * (`sk->sec`) with `gls254_scalar_recode()`. This is faster when the
+ * same private key is used with many peers.
+ */
+int gls254_ECDH_recoded(void *shared_key, const gls254_private_key *sk,
+	const gls254_scalar_recoded *sr, const gls254_public_key *pk_peer);
+
+/*
+ * Same as `gls254_ECDH()`, with `pp` computed from the peer public key
+ * (`&pk_peer->pp`) with `gls254_precompute_point()`. This is faster when
+ * several key exchanges are made with the same peer.
+ */
+int gls254_ECDH_precomputed(void *shared_key, const gls254_private_key *sk,
+	const gls254_public_key *pk_peer, const gls254_precomputed_point *pp);
+
+/*
+ * Batch ECDH: for i = 0 to `num - 1`, the shared key between the
+ * private key `sk` and the peer public key `pk_peers[i]` is written at
+ * offset `32*i` in `shared_keys` (same value as with `gls254_ECDH()`).
+ * The private scalar is split and recoded only once; multiplications
+ * advance four at a time, in lockstep, and field inversions (for the
+ * windows and for the encoding of the shared points) are shared by
+ * groups of up to 16 peers.
+ *
+ * If `valid` is not NULL, then it receives a bitmap of `(num + 7)/8`
+ * bytes: bit `i % 8` of byte `valid[i / 8]` is set to 1 if peer key `i`
+ * was valid, 0 otherwise. Returned value is 1 if all peer keys were
+ * valid, 0 otherwise. This is constant-time (except for `num`).
+ */
+int gls254_ECDH_batch(void *shared_keys, uint8_t *valid,
+	const gls254_private_key *sk, const gls254_public_key *pk_peers,
+	size_t num);
+
 /*
  * FOR BENCHMARKS ONLY. This is a "raw ECDH" implementation that expects
  * and outputs points in uncompressed affine format, over 64 bytes (and
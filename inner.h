@@ -13,8 +13,10 @@
 /*
  * GF(2^127) operations.
  *
- * All these functions are defined in the assembly source file. They have
- * external linkage only so as to support test code.
+ * All these functions are defined in the backend source file (either
+ * gls254-cm4.s for the ARM Cortex M4 assembly, or gls254-c.c for the
+ * portable C code). They have external linkage only so as to support
+ * test code.
  *
  * General rules:
  *  - Everything is constant-time.
@@ -85,7 +87,7 @@ uint32_t gfb127_decode16(gfb127 *d, const void *src);
 /*
  * GF(2^254) operations.
  *
- * All non-inline functions are defined in the assembly source file. They
+ * All non-inline functions are defined in the backend source file. They
  * have external linkage only so as to support test code.
  *
  * The same rules as for GF(2^127) code apply here.
@@ -119,9 +121,9 @@ uint32_t gfb127_decode16(gfb127 *d, const void *src);
  * and decode32_reduce() uses these bits with implicit reduction (like
  * decode16_reduce() for GF(2^127)).
  *
- * None of the inline functions defined below is used by non-test code.
- * The assembly implementation includes optimized versions of these
- * functions.
+ * The inline functions defined below are not used by curve.c. The
+ * assembly implementation includes optimized versions of these
+ * functions; the portable C implementation uses them directly.
  */
 
 static inline void
@@ -214,6 +216,15 @@ void gfb254_mul_selfphi(gfb127 *d, const gfb254 *a);
 
 void gfb254_invert(gfb254 *d, const gfb254 *a);
 
+/*
+ * Invert n elements a[0..n-1] into d[0..n-1], with a single inversion
+ * and 3*(n-1) multiplications. As with gfb254_invert(), a zero input
+ * yields a zero output (this does not impact the other outputs, and
+ * is constant-time). Arrays d and a must not overlap.
+ * Defined in curve.c (generic code on top of the backend functions).
+ */
+void gfb254_batch_invert(gfb254 *d, const gfb254 *a, size_t n);
+
 void gfb254_div(gfb254 *d, const gfb254 *a, const gfb254 *b);
 
 void gfb254_sqrt(gfb254 *d, const gfb254 *a);
@@ -0,0 +1,3081 @@
+/*
+ * Precomputed multiples of the conventional generator B, affine format
+ * (scaled_x, scaled_s), for curve.c. This file was generated by
+ * gen_precomp; do not edit.
+ */
+
+/* Points i*(2^(128*j/T))*B for i = 1 to 8 and j = 0 to T-1, with
+   T = GLS254_MULGEN_TABLES (used by gls254_mulgen()) */
+static const gls254_point_affine PRECOMP_COMB[] = {
+#if GLS254_MULGEN_TABLES == 4
+	// B * 1
+	{ { { { { 0x326B8675, 0xB6412F20, 0x9AE29894, 0x657CB9F7 } },
+	      { { 0xF66DD010, 0x3932450F, 0xB2E3915E, 0x14C6F62C } } } },
+	  { { { { 0x023DC896, 0x5FADCA04, 0xA04300F1, 0x763522AD } },
+	      { { 0x9E07345A, 0x206E4C1E, 0x2381CA6D, 0x4F69A66A } } } } },
+	// B * 2
+	{ { { { { 0xD693FA8F, 0x415A7930, 0xDF2F1CA6, 0x1D78874E } },
+	      { { 0xDAE036F7, 0xF61DEA7C, 0xE5F279EA, 0x4B30C0F5 } } } },
+	  { { { { 0xFBD6BE01, 0xC19ED043, 0x6ABE9465, 0x693D8F2F } },
+	      { { 0xD452AB50, 0x0F2F0D9C, 0x0A6EE21C, 0x19720E49 } } } } },
+	// B * 3
+	{ { { { { 0x1889FE19, 0x0BC57355, 0x1393238B, 0x665C451B } },
+	      { { 0x27CA6F4D, 0xE053B1D0, 0x34043EA7, 0x5C27A07D } } } },
+	  { { { { 0xA1F56BB6, 0xFE1E7723, 0x7D15931D, 0x7B780510 } },
+	      { { 0xE184E5DF, 0xAE7D87EF, 0xF11925D5, 0x0F6F5F4E } } } } },
+	// B * 4
+	{ { { { { 0x06C9A0C8, 0xA11DB5F2, 0xC72A3AB3, 0x061309D0 } },
+	      { { 0xEED4F57B, 0x91999BBE, 0xC3C0D1DA, 0x77F10DBD } } } },
+	  { { { { 0x812A13C2, 0x38EE9EC6, 0x9DCA6BB5, 0x77FBC24A } },
+	      { { 0xC034074B, 0x181DB8C3, 0xA8E44BBD, 0x6D296D30 } } } } },
+	// B * 5
+	{ { { { { 0xCF1FAB5F, 0xC715B038, 0x610AD947, 0x0DA235C1 } },
+	      { { 0x7E52B936, 0xD3AC0FF5, 0x42EA1434, 0x7094DAC3 } } } },
+	  { { { { 0x32462848, 0x06A589BB, 0x1566BBAF, 0x0F876725 } },
+	      { { 0x17C2DAAB, 0x9F808AC9, 0x55FE4D2C, 0x32B14A68 } } } } },
+	// B * 6
+	{ { { { { 0x2FEA71F8, 0xB210B545, 0x921194F5, 0x14D11ED1 } },
+	      { { 0x4E3E4518, 0x476FF44B, 0x007A5A24, 0x6F68AAC2 } } } },
+	  { { { { 0x43C891FA, 0x57BE3BF0, 0x548C5D6C, 0x4F28EEAF } },
+	      { { 0xE898732D, 0x72895485, 0xB3EB369B, 0x5683B98C } } } } },
+	// B * 7
+	{ { { { { 0xA16EAC69, 0x1F6121CE, 0xBC02778C, 0x19EB28FD } },
+	      { { 0xB2803207, 0x0E86728B, 0xD9893789, 0x03E9B9FC } } } },
+	  { { { { 0x7604ABE1, 0x13DE2DAE, 0xA6611933, 0x5121D6B7 } },
+	      { { 0x9644C754, 0xAFC835F3, 0xE19E6CB3, 0x0A1F6E2D } } } } },
+	// B * 8
+	{ { { { { 0xF80BD001, 0xCDCB2821, 0xC02477B7, 0x4D1FCC11 } },
+	      { { 0x237C442C, 0x2A6A17AF, 0xD4D6114C, 0x1301DB82 } } } },
+	  { { { { 0x44C7077A, 0x83CF1AA2, 0xBC942DCB, 0x327AC316 } },
+	      { { 0x8D0BBFA4, 0xAA4C2E84, 0x2A0788B2, 0x235DF1F9 } } } } },
+	// (2^32)*B * 1
+	{ { { { { 0x4DDB30B8, 0x63557581, 0x5030FA03, 0x5B61982B } },
+	      { { 0x22FC0A21, 0x11DFBA3C, 0x0F317C69, 0x59B8AAF2 } } } },
+	  { { { { 0x4BA656F7, 0x24CCD3E5, 0x8F12A690, 0x75E44943 } },
+	      { { 0x83593FAD, 0x35A7574A, 0xD281984B, 0x605B7617 } } } } },
+	// (2^32)*B * 2
+	{ { { { { 0x63E928F5, 0x90CF4E35, 0x5223D2E7, 0x50074E81 } },
+	      { { 0x354B113C, 0x5C404A45, 0xC8167241, 0x0FA6E6AE } } } },
+	  { { { { 0x6DA726AA, 0xA1301F5B, 0x36FADE6F, 0x417E796A } },
+	      { { 0xA030F951, 0x132B507C, 0x27837BD6, 0x1B059582 } } } } },
+	// (2^32)*B * 3
+	{ { { { { 0xBD1848ED, 0x3EB8194B, 0xA973E23F, 0x49233033 } },
+	      { { 0x9659B3C6, 0x162E3AC5, 0xCF1B0A47, 0x55D7E164 } } } },
+	  { { { { 0x50D0746F, 0x8408AE6F, 0xDA5B5D8C, 0x54B1EF88 } },
+	      { { 0xE0266218, 0xBEEF1BC0, 0x31BD68F4, 0x47AEBA16 } } } } },
+	// (2^32)*B * 4
+	{ { { { { 0xFEBCA318, 0xACDCDE13, 0x6F23CA1C, 0x2054A068 } },
+	      { { 0x9A944830, 0x4FC664CE, 0x5CC70929, 0x0EE62762 } } } },
+	  { { { { 0xF712C3D2, 0x10FFCF13, 0x378DADCF, 0x7AEF8651 } },
+	      { { 0x3A88BB41, 0x83BF078A, 0xED94CCB7, 0x6540AA59 } } } } },
+	// (2^32)*B * 5
+	{ { { { { 0x548A5B5C, 0xC3A9CDF7, 0x09251988, 0x7CC55823 } },
+	      { { 0x1D8FB1B6, 0x359CFD6F, 0xAEBB6DFE, 0x16617EA6 } } } },
+	  { { { { 0x3B570A8D, 0x5402D084, 0xDDCA45AF, 0x72E1B8FC } },
+	      { { 0x6A5F05AF, 0x8E894715, 0x4943A009, 0x47E972B5 } } } } },
+	// (2^32)*B * 6
+	{ { { { { 0x9D224CE8, 0x21ED4996, 0xF0314FFD, 0x502BF009 } },
+	      { { 0x29EDEB9F, 0x378AD19D, 0x0F08EA14, 0x217F953E } } } },
+	  { { { { 0x58AA005F, 0xFBEACAA8, 0xB084D2E9, 0x5C3956EA } },
+	      { { 0x9C0AF3DD, 0x02FFF925, 0x4DA7B8F3, 0x2E6C4558 } } } } },
+	// (2^32)*B * 7
+	{ { { { { 0xA435418E, 0xEFE3D1C9, 0x78B4B863, 0x29220A41 } },
+	      { { 0xAB5842A9, 0xF43A2709, 0x40A92711, 0x0C7C4F15 } } } },
+	  { { { { 0x7D638424, 0x1C6B7791, 0x16ED213B, 0x611353A7 } },
+	      { { 0x4BC271D7, 0x64291F07, 0x1D26E566, 0x65DD7EC4 } } } } },
+	// (2^32)*B * 8
+	{ { { { { 0xC194ECC9, 0x9B4DA61D, 0xCA8836CF, 0x7CB707BD } },
+	      { { 0xD4BFFDF2, 0x77ACDF95, 0xD3A61F80, 0x36586184 } } } },
+	  { { { { 0xC2CE8B3D, 0xCDAA62F1, 0x824B839B, 0x10B26E50 } },
+	      { { 0x667C1F45, 0xFC7E3B92, 0x267FACD9, 0x27F128AB } } } } },
+	// (2^64)*B * 1
+	{ { { { { 0x4D3AE7AC, 0x26123159, 0x28CEB8AD, 0x082A5BBF } },
+	      { { 0x83030F30, 0xD959B911, 0x5AF1898E, 0x4447B9E0 } } } },
+	  { { { { 0x4D3DE629, 0x2C7A5450, 0xA6F9484C, 0x431796A3 } },
+	      { { 0xE5D3C8CD, 0x357D7D22, 0xE5323C2E, 0x147CCFFB } } } } },
+	// (2^64)*B * 2
+	{ { { { { 0xF207FAC6, 0x05704BF4, 0x161BD3A2, 0x0F16C7B1 } },
+	      { { 0x870DEC6E, 0x1AD76AF2, 0xD0BF2740, 0x4FB614A7 } } } },
+	  { { { { 0x28566D8A, 0x45D7C01C, 0x4077ABED, 0x005002FF } },
+	      { { 0x5672D4B3, 0x6542A776, 0xA98AB48D, 0x04137083 } } } } },
+	// (2^64)*B * 3
+	{ { { { { 0xF0350244, 0x27C990FF, 0x857F7525, 0x18A5BC91 } },
+	      { { 0x79997083, 0x6004C035, 0xE0E1B992, 0x1744491A } } } },
+	  { { { { 0x17682DD3, 0x9C8593D7, 0x84AE8661, 0x402364E0 } },
+	      { { 0xB2E2B9F3, 0x20F86314, 0x4D9B1FB5, 0x545AF79A } } } } },
+	// (2^64)*B * 4
+	{ { { { { 0xDDA5DC0B, 0x23CBD429, 0x6A5208C3, 0x27DF09B6 } },
+	      { { 0x8B8FF984, 0x10BCC45E, 0x205DF31F, 0x4D7FE346 } } } },
+	  { { { { 0xC97F02A7, 0x0CB81A89, 0x7D64DBF2, 0x3C1C9D27 } },
+	      { { 0x704354B3, 0xF84A977B, 0x368738E4, 0x2C8704A6 } } } } },
+	// (2^64)*B * 5
+	{ { { { { 0x448B153F, 0x5FBA8828, 0x9A0F0423, 0x01E91ADB } },
+	      { { 0x4BFABFFD, 0x1441B534, 0xA4E2D56F, 0x6D0A611A } } } },
+	  { { { { 0xC6ED13FE, 0x67C71E1C, 0xA6321549, 0x4DEFBBD5 } },
+	      { { 0x5515923F, 0xA187801F, 0xB7921BE3, 0x5FAD2693 } } } } },
+	// (2^64)*B * 6
+	{ { { { { 0x9A07D071, 0xCBD5E245, 0xCE94BD91, 0x578067F7 } },
+	      { { 0x22EBB7B9, 0x393D9B57, 0xF4C2C566, 0x07F1E938 } } } },
+	  { { { { 0x7ACE6FEC, 0xAF27AF4B, 0x2CE0A5CF, 0x6DE1B7A6 } },
+	      { { 0x633B4D64, 0xD0C6FCA2, 0x989F7B92, 0x2813A2EA } } } } },
+	// (2^64)*B * 7
+	{ { { { { 0x41DBB5A8, 0x0A58149A, 0x1073E8F8, 0x106DF92D } },
+	      { { 0x493E86B2, 0x197899FC, 0x2197B358, 0x2E0E05CE } } } },
+	  { { { { 0x709BC381, 0x2D603F9B, 0xA19EED77, 0x26507080 } },
+	      { { 0x1A0926FE, 0x5D86707B, 0x55F08B86, 0x2C55B877 } } } } },
+	// (2^64)*B * 8
+	{ { { { { 0xCD1523B9, 0x43086DD4, 0x4CF14DC9, 0x25B6941E } },
+	      { { 0x40028B29, 0x0C30580B, 0xA4F8EDDF, 0x6B6816FF } } } },
+	  { { { { 0x84749178, 0xB9FFB6EF, 0x8D83172B, 0x16BFA2F7 } },
+	      { { 0x577E2135, 0xCD9F9599, 0xC1FB34BF, 0x0B9E5031 } } } } },
+	// (2^96)*B * 1
+	{ { { { { 0xDA88E093, 0x653346E6, 0x9CD13872, 0x30002265 } },
+	      { { 0x5F29D20B, 0x65532D39, 0x7CB5DE42, 0x30FE4C5C } } } },
+	  { { { { 0x421D4A31, 0x0D181FE3, 0x94F4D3F7, 0x35F3E726 } },
+	      { { 0xDD3ED40C, 0x0AB661AD, 0x4F2CADE5, 0x542B83C0 } } } } },
+	// (2^96)*B * 2
+	{ { { { { 0xCF11A8C7, 0x5450A803, 0x1DB4620C, 0x1A3EFC52 } },
+	      { { 0xB4D6810F, 0x3FA30220, 0x1BC8AF08, 0x56C04218 } } } },
+	  { { { { 0xFCE09354, 0x97E3B24D, 0xE7E9C001, 0x7B0F3BAF } },
+	      { { 0xBD91FC40, 0x2DD1D729, 0xC21B1AD2, 0x05C74680 } } } } },
+	// (2^96)*B * 3
+	{ { { { { 0x431C5C00, 0x8F7A7F37, 0x22605514, 0x4487CC96 } },
+	      { { 0x955E5D1C, 0x754A0DB2, 0xB8D0072A, 0x6AA1BE4A } } } },
+	  { { { { 0x6B1BFC14, 0xA6D4611F, 0x6B2E8951, 0x00390364 } },
+	      { { 0x0D536882, 0x723A689D, 0x973B29AB, 0x3B33B3BD } } } } },
+	// (2^96)*B * 4
+	{ { { { { 0xF4444850, 0xE2D4EE8A, 0xD2D38B53, 0x7C4CCD23 } },
+	      { { 0xECC474E6, 0x66C8957A, 0x9CF325E5, 0x70291606 } } } },
+	  { { { { 0xE0752CC9, 0x6FEC1E66, 0x3FC42538, 0x3E40F3D7 } },
+	      { { 0x8A03A6D1, 0x5E66D9FE, 0x77C4AEDF, 0x73FDAD68 } } } } },
+	// (2^96)*B * 5
+	{ { { { { 0x4F97E0A6, 0x20505FA3, 0x16909F86, 0x79ACB745 } },
+	      { { 0x82094271, 0xA163A5DC, 0x2F63A6BC, 0x1B6E5456 } } } },
+	  { { { { 0x7E812C96, 0x9EFD3DD1, 0x136FD51D, 0x6901EB6C } },
+	      { { 0xC0488EEA, 0x13157F6F, 0x0270A4C0, 0x67729C40 } } } } },
+	// (2^96)*B * 6
+	{ { { { { 0xE30AA449, 0xDBEAF734, 0xB81EC506, 0x2E1D908E } },
+	      { { 0x61127B0E, 0xF2611727, 0xBA512D9F, 0x2DC2FA82 } } } },
+	  { { { { 0x68E311D9, 0x44172899, 0xD5748EBC, 0x57F6D770 } },
+	      { { 0x99E2D413, 0x97723CD4, 0xCC746EF0, 0x283638AE } } } } },
+	// (2^96)*B * 7
+	{ { { { { 0x8B0BCCC7, 0xE16BBA3D, 0x44C9E28F, 0x29BE1EE4 } },
+	      { { 0x751536A3, 0x6E4A728A, 0x00888F7C, 0x08FD01F0 } } } },
+	  { { { { 0x6105457B, 0x3346C207, 0x67B0008B, 0x290BC8D9 } },
+	      { { 0x8C9C3D6E, 0xCC0E64B7, 0x2E01B797, 0x14197A7C } } } } },
+	// (2^96)*B * 8
+	{ { { { { 0xF4B109E4, 0x891B5765, 0x03AA5B0A, 0x4C341F78 } },
+	      { { 0xB329C9A0, 0x7DF0A0F3, 0x55940920, 0x6E637EAE } } } },
+	  { { { { 0x7624B8A0, 0x81C1B2EF, 0x54F22B55, 0x528F805E } },
+	      { { 0x7A0FFB48, 0x43A540E6, 0x07BE133F, 0x7A79D0B6 } } } } },
+#elif GLS254_MULGEN_TABLES == 8
+	// B * 1
+	{ { { { { 0x326B8675, 0xB6412F20, 0x9AE29894, 0x657CB9F7 } },
+	      { { 0xF66DD010, 0x3932450F, 0xB2E3915E, 0x14C6F62C } } } },
+	  { { { { 0x023DC896, 0x5FADCA04, 0xA04300F1, 0x763522AD } },
+	      { { 0x9E07345A, 0x206E4C1E, 0x2381CA6D, 0x4F69A66A } } } } },
+	// B * 2
+	{ { { { { 0xD693FA8F, 0x415A7930, 0xDF2F1CA6, 0x1D78874E } },
+	      { { 0xDAE036F7, 0xF61DEA7C, 0xE5F279EA, 0x4B30C0F5 } } } },
+	  { { { { 0xFBD6BE01, 0xC19ED043, 0x6ABE9465, 0x693D8F2F } },
+	      { { 0xD452AB50, 0x0F2F0D9C, 0x0A6EE21C, 0x19720E49 } } } } },
+	// B * 3
+	{ { { { { 0x1889FE19, 0x0BC57355, 0x1393238B, 0x665C451B } },
+	      { { 0x27CA6F4D, 0xE053B1D0, 0x34043EA7, 0x5C27A07D } } } },
+	  { { { { 0xA1F56BB6, 0xFE1E7723, 0x7D15931D, 0x7B780510 } },
+	      { { 0xE184E5DF, 0xAE7D87EF, 0xF11925D5, 0x0F6F5F4E } } } } },
+	// B * 4
+	{ { { { { 0x06C9A0C8, 0xA11DB5F2, 0xC72A3AB3, 0x061309D0 } },
+	      { { 0xEED4F57B, 0x91999BBE, 0xC3C0D1DA, 0x77F10DBD } } } },
+	  { { { { 0x812A13C2, 0x38EE9EC6, 0x9DCA6BB5, 0x77FBC24A } },
+	      { { 0xC034074B, 0x181DB8C3, 0xA8E44BBD, 0x6D296D30 } } } } },
+	// B * 5
+	{ { { { { 0xCF1FAB5F, 0xC715B038, 0x610AD947, 0x0DA235C1 } },
+	      { { 0x7E52B936, 0xD3AC0FF5, 0x42EA1434, 0x7094DAC3 } } } },
+	  { { { { 0x32462848, 0x06A589BB, 0x1566BBAF, 0x0F876725 } },
+	      { { 0x17C2DAAB, 0x9F808AC9, 0x55FE4D2C, 0x32B14A68 } } } } },
+	// B * 6
+	{ { { { { 0x2FEA71F8, 0xB210B545, 0x921194F5, 0x14D11ED1 } },
+	      { { 0x4E3E4518, 0x476FF44B, 0x007A5A24, 0x6F68AAC2 } } } },
+	  { { { { 0x43C891FA, 0x57BE3BF0, 0x548C5D6C, 0x4F28EEAF } },
+	      { { 0xE898732D, 0x72895485, 0xB3EB369B, 0x5683B98C } } } } },
+	// B * 7
+	{ { { { { 0xA16EAC69, 0x1F6121CE, 0xBC02778C, 0x19EB28FD } },
+	      { { 0xB2803207, 0x0E86728B, 0xD9893789, 0x03E9B9FC } } } },
+	  { { { { 0x7604ABE1, 0x13DE2DAE, 0xA6611933, 0x5121D6B7 } },
+	      { { 0x9644C754, 0xAFC835F3, 0xE19E6CB3, 0x0A1F6E2D } } } } },
+	// B * 8
+	{ { { { { 0xF80BD001, 0xCDCB2821, 0xC02477B7, 0x4D1FCC11 } },
+	      { { 0x237C442C, 0x2A6A17AF, 0xD4D6114C, 0x1301DB82 } } } },
+	  { { { { 0x44C7077A, 0x83CF1AA2, 0xBC942DCB, 0x327AC316 } },
+	      { { 0x8D0BBFA4, 0xAA4C2E84, 0x2A0788B2, 0x235DF1F9 } } } } },
+	// (2^16)*B * 1
+	{ { { { { 0x5603B9BF, 0xBB5FBF2F, 0x98B576B4, 0x4116A532 } },
+	      { { 0x2B5C4B00, 0x151A4CBB, 0x19F67653, 0x65FD95A1 } } } },
+	  { { { { 0x8588F5A0, 0x1E4D4153, 0xBFFBAFE0, 0x1697B728 } },
+	      { { 0xEDBFA37E, 0x7D8DD3DB, 0x5A7EA4CE, 0x17E9C5DE } } } } },
+	// (2^16)*B * 2
+	{ { { { { 0x316A1FE5, 0xEDC20D38, 0x1D7C64EF, 0x595F5371 } },
+	      { { 0x01B258D5, 0x6FC95B1B, 0x4C38D3D2, 0x173847B4 } } } },
+	  { { { { 0x66A97939, 0x797A38EC, 0xAB628228, 0x7B09419A } },
+	      { { 0x199028FB, 0xF5121543, 0xB35928B9, 0x147C6217 } } } } },
+	// (2^16)*B * 3
+	{ { { { { 0x62D75E04, 0x79903D39, 0x16C9A092, 0x22CE4276 } },
+	      { { 0xE844BC78, 0x3526ED89, 0xD5E30BF4, 0x19F5ECEB } } } },
+	  { { { { 0x650A795E, 0x5E4C510E, 0x6145497F, 0x7620ED2A } },
+	      { { 0x7FFA8242, 0x3ED9F0CE, 0x3D2AD607, 0x6F532914 } } } } },
+	// (2^16)*B * 4
+	{ { { { { 0xD464A400, 0xFFD584D5, 0x2C24699F, 0x05DBD05C } },
+	      { { 0xC3075493, 0x2D270E5D, 0xC0B4F6DA, 0x3378365C } } } },
+	  { { { { 0x840E8BA4, 0xEA43590A, 0x123EF605, 0x6764FEEF } },
+	      { { 0x9663D2F6, 0x99B02919, 0xF2838856, 0x4CAC6706 } } } } },
+	// (2^16)*B * 5
+	{ { { { { 0x489FBA63, 0xBC673A32, 0x6357ABE4, 0x043A2500 } },
+	      { { 0xDFC01C42, 0x22499F73, 0xA879C25F, 0x1D5D2409 } } } },
+	  { { { { 0x00E9ACB3, 0xE7A4E5B4, 0xC776ABEC, 0x79326BFA } },
+	      { { 0x3BE08F4F, 0x731C33D2, 0x307A172D, 0x7463FA2F } } } } },
+	// (2^16)*B * 6
+	{ { { { { 0x0E4C1365, 0x30125CEE, 0x01BA0CCD, 0x506449C8 } },
+	      { { 0xADDF20DF, 0x2111819E, 0x40FCD6E3, 0x16DDD39C } } } },
+	  { { { { 0x60A9B5D4, 0x2F40CBCE, 0x9AA2C074, 0x3C5EE79B } },
+	      { { 0x2F706D29, 0xC44E87AF, 0x33D996E4, 0x4D13143D } } } } },
+	// (2^16)*B * 7
+	{ { { { { 0x85EF0180, 0x9B65ECE6, 0x940B104D, 0x49B98D5B } },
+	      { { 0x25FD1B43, 0x55676A13, 0x66258A97, 0x14D2B13A } } } },
+	  { { { { 0xB4971DB9, 0x9295DAE3, 0x38BD98F3, 0x1228F6F9 } },
+	      { { 0x6E5580B5, 0x98F7656B, 0x10CD0138, 0x79EB218D } } } } },
+	// (2^16)*B * 8
+	{ { { { { 0x28DFBBF3, 0xDC55A228, 0x0216C316, 0x42758EC7 } },
+	      { { 0x03EBB993, 0xB1D5008C, 0x8B02959D, 0x5DA6A610 } } } },
+	  { { { { 0x32AF273B, 0x22653BF6, 0x7863B996, 0x297725D5 } },
+	      { { 0x3CF58605, 0x4A3B79EF, 0x55FDF51E, 0x24DBA95D } } } } },
+	// (2^32)*B * 1
+	{ { { { { 0x4DDB30B8, 0x63557581, 0x5030FA03, 0x5B61982B } },
+	      { { 0x22FC0A21, 0x11DFBA3C, 0x0F317C69, 0x59B8AAF2 } } } },
+	  { { { { 0x4BA656F7, 0x24CCD3E5, 0x8F12A690, 0x75E44943 } },
+	      { { 0x83593FAD, 0x35A7574A, 0xD281984B, 0x605B7617 } } } } },
+	// (2^32)*B * 2
+	{ { { { { 0x63E928F5, 0x90CF4E35, 0x5223D2E7, 0x50074E81 } },
+	      { { 0x354B113C, 0x5C404A45, 0xC8167241, 0x0FA6E6AE } } } },
+	  { { { { 0x6DA726AA, 0xA1301F5B, 0x36FADE6F, 0x417E796A } },
+	      { { 0xA030F951, 0x132B507C, 0x27837BD6, 0x1B059582 } } } } },
+	// (2^32)*B * 3
+	{ { { { { 0xBD1848ED, 0x3EB8194B, 0xA973E23F, 0x49233033 } },
+	      { { 0x9659B3C6, 0x162E3AC5, 0xCF1B0A47, 0x55D7E164 } } } },
+	  { { { { 0x50D0746F, 0x8408AE6F, 0xDA5B5D8C, 0x54B1EF88 } },
+	      { { 0xE0266218, 0xBEEF1BC0, 0x31BD68F4, 0x47AEBA16 } } } } },
+	// (2^32)*B * 4
+	{ { { { { 0xFEBCA318, 0xACDCDE13, 0x6F23CA1C, 0x2054A068 } },
+	      { { 0x9A944830, 0x4FC664CE, 0x5CC70929, 0x0EE62762 } } } },
+	  { { { { 0xF712C3D2, 0x10FFCF13, 0x378DADCF, 0x7AEF8651 } },
+	      { { 0x3A88BB41, 0x83BF078A, 0xED94CCB7, 0x6540AA59 } } } } },
+	// (2^32)*B * 5
+	{ { { { { 0x548A5B5C, 0xC3A9CDF7, 0x09251988, 0x7CC55823 } },
+	      { { 0x1D8FB1B6, 0x359CFD6F, 0xAEBB6DFE, 0x16617EA6 } } } },
+	  { { { { 0x3B570A8D, 0x5402D084, 0xDDCA45AF, 0x72E1B8FC } },
+	      { { 0x6A5F05AF, 0x8E894715, 0x4943A009, 0x47E972B5 } } } } },
+	// (2^32)*B * 6
+	{ { { { { 0x9D224CE8, 0x21ED4996, 0xF0314FFD, 0x502BF009 } },
+	      { { 0x29EDEB9F, 0x378AD19D, 0x0F08EA14, 0x217F953E } } } },
+	  { { { { 0x58AA005F, 0xFBEACAA8, 0xB084D2E9, 0x5C3956EA } },
+	      { { 0x9C0AF3DD, 0x02FFF925, 0x4DA7B8F3, 0x2E6C4558 } } } } },
+	// (2^32)*B * 7
+	{ { { { { 0xA435418E, 0xEFE3D1C9, 0x78B4B863, 0x29220A41 } },
+	      { { 0xAB5842A9, 0xF43A2709, 0x40A92711, 0x0C7C4F15 } } } },
+	  { { { { 0x7D638424, 0x1C6B7791, 0x16ED213B, 0x611353A7 } },
+	      { { 0x4BC271D7, 0x64291F07, 0x1D26E566, 0x65DD7EC4 } } } } },
+	// (2^32)*B * 8
+	{ { { { { 0xC194ECC9, 0x9B4DA61D, 0xCA8836CF, 0x7CB707BD } },
+	      { { 0xD4BFFDF2, 0x77ACDF95, 0xD3A61F80, 0x36586184 } } } },
+	  { { { { 0xC2CE8B3D, 0xCDAA62F1, 0x824B839B, 0x10B26E50 } },
+	      { { 0x667C1F45, 0xFC7E3B92, 0x267FACD9, 0x27F128AB } } } } },
+	// (2^48)*B * 1
+	{ { { { { 0xE7D22B99, 0x29B675E3, 0x32C67197, 0x022B6694 } },
+	      { { 0x4ED2A423, 0x179E4E91, 0x234B6400, 0x63D86CB0 } } } },
+	  { { { { 0x6BBF8F32, 0xD0C3495D, 0x54459C23, 0x17B7FE06 } },
+	      { { 0x80DD8210, 0xE54B5E95, 0x94DACCD3, 0x657CF971 } } } } },
+	// (2^48)*B * 2
+	{ { { { { 0x1F583AA7, 0xC9B73227, 0xC831B657, 0x48EBE938 } },
+	      { { 0x3DD239B2, 0x08882673, 0xE2795C0F, 0x5A1B83A7 } } } },
+	  { { { { 0x663CADC2, 0x55B90869, 0xA293D68D, 0x558747CE } },
+	      { { 0xEC04D71B, 0xC0D11B5F, 0x4B7DD481, 0x1F359981 } } } } },
+	// (2^48)*B * 3
+	{ { { { { 0xC74CA692, 0x88257C77, 0xFE2543D0, 0x083CA721 } },
+	      { { 0x545B6075, 0xD35CC1F8, 0x937BD410, 0x25517FD0 } } } },
+	  { { { { 0xF4A229B3, 0x95728815, 0x69C8BDF6, 0x4EEBAF37 } },
+	      { { 0x52ECC702, 0x4058035A, 0xBBDED186, 0x1CCFEC1A } } } } },
+	// (2^48)*B * 4
+	{ { { { { 0xAD87370F, 0xFFFC3AB1, 0x49F6C0D6, 0x4FBD707B } },
+	      { { 0xB244138F, 0x0735E39B, 0xC6AC4AD7, 0x35FBF7D1 } } } },
+	  { { { { 0x415340D7, 0xC63ADBF0, 0xA74232B1, 0x5C7B01DD } },
+	      { { 0xF7343964, 0xD040A472, 0x7AABE0B4, 0x53547D50 } } } } },
+	// (2^48)*B * 5
+	{ { { { { 0xFB42D19F, 0x3DD7A80D, 0xDAD45900, 0x2B3B54FB } },
+	      { { 0x76356340, 0x2C8286E5, 0xC04E2063, 0x2688738A } } } },
+	  { { { { 0xB773591E, 0xE6411CD8, 0xA0D53C14, 0x46E22C91 } },
+	      { { 0x2385D850, 0x976674A0, 0x59FE3A9B, 0x0256E9EC } } } } },
+	// (2^48)*B * 6
+	{ { { { { 0x3A9CD59F, 0x684C0A06, 0xA8717000, 0x625B8BD7 } },
+	      { { 0xBF606FD2, 0x30299878, 0x5B348ACB, 0x58C023C4 } } } },
+	  { { { { 0x2918F1E4, 0xCED7EE9C, 0xCC457719, 0x0B1D80FC } },
+	      { { 0xB19404A3, 0xD2930402, 0x2F29363A, 0x2F0E7637 } } } } },
+	// (2^48)*B * 7
+	{ { { { { 0x374870D5, 0xE0D62664, 0x4A3B6122, 0x481C9821 } },
+	      { { 0x8B01FD1E, 0xAB158BB2, 0x14E9DCF7, 0x11F514A3 } } } },
+	  { { { { 0x78696395, 0x5514EFE5, 0xA656D2E7, 0x7FCBA955 } },
+	      { { 0x5DDB9E5B, 0x7C323607, 0xE68E6A8C, 0x2BB4DA27 } } } } },
+	// (2^48)*B * 8
+	{ { { { { 0xC1EEDEAA, 0x910E755E, 0x986379C5, 0x54CB83C9 } },
+	      { { 0xBF8A2419, 0x6198DBEA, 0xA7877EA2, 0x329700D0 } } } },
+	  { { { { 0x0E39DD4A, 0x7EECDE99, 0x560E7792, 0x76DA79D1 } },
+	      { { 0xB55A0C2B, 0x166369EB, 0x475BC922, 0x4357A81C } } } } },
+	// (2^64)*B * 1
+	{ { { { { 0x4D3AE7AC, 0x26123159, 0x28CEB8AD, 0x082A5BBF } },
+	      { { 0x83030F30, 0xD959B911, 0x5AF1898E, 0x4447B9E0 } } } },
+	  { { { { 0x4D3DE629, 0x2C7A5450, 0xA6F9484C, 0x431796A3 } },
+	      { { 0xE5D3C8CD, 0x357D7D22, 0xE5323C2E, 0x147CCFFB } } } } },
+	// (2^64)*B * 2
+	{ { { { { 0xF207FAC6, 0x05704BF4, 0x161BD3A2, 0x0F16C7B1 } },
+	      { { 0x870DEC6E, 0x1AD76AF2, 0xD0BF2740, 0x4FB614A7 } } } },
+	  { { { { 0x28566D8A, 0x45D7C01C, 0x4077ABED, 0x005002FF } },
+	      { { 0x5672D4B3, 0x6542A776, 0xA98AB48D, 0x04137083 } } } } },
+	// (2^64)*B * 3
+	{ { { { { 0xF0350244, 0x27C990FF, 0x857F7525, 0x18A5BC91 } },
+	      { { 0x79997083, 0x6004C035, 0xE0E1B992, 0x1744491A } } } },
+	  { { { { 0x17682DD3, 0x9C8593D7, 0x84AE8661, 0x402364E0 } },
+	      { { 0xB2E2B9F3, 0x20F86314, 0x4D9B1FB5, 0x545AF79A } } } } },
+	// (2^64)*B * 4
+	{ { { { { 0xDDA5DC0B, 0x23CBD429, 0x6A5208C3, 0x27DF09B6 } },
+	      { { 0x8B8FF984, 0x10BCC45E, 0x205DF31F, 0x4D7FE346 } } } },
+	  { { { { 0xC97F02A7, 0x0CB81A89, 0x7D64DBF2, 0x3C1C9D27 } },
+	      { { 0x704354B3, 0xF84A977B, 0x368738E4, 0x2C8704A6 } } } } },
+	// (2^64)*B * 5
+	{ { { { { 0x448B153F, 0x5FBA8828, 0x9A0F0423, 0x01E91ADB } },
+	      { { 0x4BFABFFD, 0x1441B534, 0xA4E2D56F, 0x6D0A611A } } } },
+	  { { { { 0xC6ED13FE, 0x67C71E1C, 0xA6321549, 0x4DEFBBD5 } },
+	      { { 0x5515923F, 0xA187801F, 0xB7921BE3, 0x5FAD2693 } } } } },
+	// (2^64)*B * 6
+	{ { { { { 0x9A07D071, 0xCBD5E245, 0xCE94BD91, 0x578067F7 } },
+	      { { 0x22EBB7B9, 0x393D9B57, 0xF4C2C566, 0x07F1E938 } } } },
+	  { { { { 0x7ACE6FEC, 0xAF27AF4B, 0x2CE0A5CF, 0x6DE1B7A6 } },
+	      { { 0x633B4D64, 0xD0C6FCA2, 0x989F7B92, 0x2813A2EA } } } } },
+	// (2^64)*B * 7
+	{ { { { { 0x41DBB5A8, 0x0A58149A, 0x1073E8F8, 0x106DF92D } },
+	      { { 0x493E86B2, 0x197899FC, 0x2197B358, 0x2E0E05CE } } } },
+	  { { { { 0x709BC381, 0x2D603F9B, 0xA19EED77, 0x26507080 } },
+	      { { 0x1A0926FE, 0x5D86707B, 0x55F08B86, 0x2C55B877 } } } } },
+	// (2^64)*B * 8
+	{ { { { { 0xCD1523B9, 0x43086DD4, 0x4CF14DC9, 0x25B6941E } },
+	      { { 0x40028B29, 0x0C30580B, 0xA4F8EDDF, 0x6B6816FF } } } },
+	  { { { { 0x84749178, 0xB9FFB6EF, 0x8D83172B, 0x16BFA2F7 } },
+	      { { 0x577E2135, 0xCD9F9599, 0xC1FB34BF, 0x0B9E5031 } } } } },
+	// (2^80)*B * 1
+	{ { { { { 0xB55870B7, 0x130A3549, 0x8EE758CD, 0x1A9D5042 } },
+	      { { 0x068F1BE6, 0xD34BB378, 0xC2FBEFAD, 0x0EDED54C } } } },
+	  { { { { 0x5A650012, 0xAD6C8154, 0xC5524209, 0x6322B057 } },
+	      { { 0x3223D5BE, 0x74F024CD, 0x61272535, 0x346E9D86 } } } } },
+	// (2^80)*B * 2
+	{ { { { { 0xAB845819, 0x77619D35, 0xEE212213, 0x6F41B94D } },
+	      { { 0x177BADCC, 0xB2D5E03A, 0x985647A4, 0x37B2D9CB } } } },
+	  { { { { 0xCDF50548, 0x0F9AE058, 0x6D415C28, 0x50943D82 } },
+	      { { 0x51B1B10E, 0x997CEB96, 0x8363D9F4, 0x103AD918 } } } } },
+	// (2^80)*B * 3
+	{ { { { { 0xE01ABBC4, 0xADDD51E3, 0xB2149F0A, 0x4906CBB8 } },
+	      { { 0xB9862DED, 0x3D7C9B8F, 0x0A4E56C0, 0x35B2A175 } } } },
+	  { { { { 0x8A34EF91, 0x2676116E, 0x5FA1CB29, 0x69BE66A5 } },
+	      { { 0x3D60EC50, 0xCAC77717, 0xFAB03C38, 0x4581C45D } } } } },
+	// (2^80)*B * 4
+	{ { { { { 0x731BC743, 0xD7BC7BFC, 0x257AAFC4, 0x4B3CA8E6 } },
+	      { { 0x4D46A027, 0xBE6D0DFA, 0x658DAB78, 0x74EE3DB4 } } } },
+	  { { { { 0xD3792799, 0x3EA84B83, 0x094DE2FE, 0x3EABF450 } },
+	      { { 0x283EFB4F, 0x31948694, 0x6150E80B, 0x300F339F } } } } },
+	// (2^80)*B * 5
+	{ { { { { 0x64E2F323, 0x6BFCD024, 0x600F5805, 0x3786CA40 } },
+	      { { 0xA39FC498, 0x85974B82, 0x2A2DC265, 0x52FC37E2 } } } },
+	  { { { { 0xDC12D51E, 0xA221DADD, 0xBEF98C2F, 0x626A671B } },
+	      { { 0xB84544B0, 0x873150F8, 0x12C75B0B, 0x589CAEAC } } } } },
+	// (2^80)*B * 6
+	{ { { { { 0x2DF1B6A6, 0xAD0555F4, 0x9FB2D766, 0x163F167C } },
+	      { { 0xA47BC35F, 0x28DA9452, 0x31FECB94, 0x67E0A6D6 } } } },
+	  { { { { 0x6FC9D146, 0xED083D74, 0x4A4E33BA, 0x152AA658 } },
+	      { { 0x070DBF74, 0x172D3E25, 0x31146EDF, 0x57F32D4B } } } } },
+	// (2^80)*B * 7
+	{ { { { { 0xE4A2AA0D, 0x73C0C052, 0x3DF89257, 0x2B18FB38 } },
+	      { { 0xDE04B477, 0x8313DDDA, 0x4CBA7147, 0x1FF574B3 } } } },
+	  { { { { 0xE3AFD217, 0xBBEEF1BB, 0x99D9AA71, 0x39C47560 } },
+	      { { 0x36E7A8F7, 0x4D430031, 0xA3983973, 0x343816CA } } } } },
+	// (2^80)*B * 8
+	{ { { { { 0x29D5041A, 0x93166588, 0x9848862A, 0x71A003CB } },
+	      { { 0x0C5CC629, 0xFCFC34E6, 0x1D5869E3, 0x72D844F8 } } } },
+	  { { { { 0xDD308A7D, 0xB51DB6B6, 0xFE07C8D4, 0x4EF9C7E4 } },
+	      { { 0xB82B490D, 0x36F62659, 0x0DC3F62B, 0x266D4317 } } } } },
+	// (2^96)*B * 1
+	{ { { { { 0xDA88E093, 0x653346E6, 0x9CD13872, 0x30002265 } },
+	      { { 0x5F29D20B, 0x65532D39, 0x7CB5DE42, 0x30FE4C5C } } } },
+	  { { { { 0x421D4A31, 0x0D181FE3, 0x94F4D3F7, 0x35F3E726 } },
+	      { { 0xDD3ED40C, 0x0AB661AD, 0x4F2CADE5, 0x542B83C0 } } } } },
+	// (2^96)*B * 2
+	{ { { { { 0xCF11A8C7, 0x5450A803, 0x1DB4620C, 0x1A3EFC52 } },
+	      { { 0xB4D6810F, 0x3FA30220, 0x1BC8AF08, 0x56C04218 } } } },
+	  { { { { 0xFCE09354, 0x97E3B24D, 0xE7E9C001, 0x7B0F3BAF } },
+	      { { 0xBD91FC40, 0x2DD1D729, 0xC21B1AD2, 0x05C74680 } } } } },
+	// (2^96)*B * 3
+	{ { { { { 0x431C5C00, 0x8F7A7F37, 0x22605514, 0x4487CC96 } },
+	      { { 0x955E5D1C, 0x754A0DB2, 0xB8D0072A, 0x6AA1BE4A } } } },
+	  { { { { 0x6B1BFC14, 0xA6D4611F, 0x6B2E8951, 0x00390364 } },
+	      { { 0x0D536882, 0x723A689D, 0x973B29AB, 0x3B33B3BD } } } } },
+	// (2^96)*B * 4
+	{ { { { { 0xF4444850, 0xE2D4EE8A, 0xD2D38B53, 0x7C4CCD23 } },
+	      { { 0xECC474E6, 0x66C8957A, 0x9CF325E5, 0x70291606 } } } },
+	  { { { { 0xE0752CC9, 0x6FEC1E66, 0x3FC42538, 0x3E40F3D7 } },
+	      { { 0x8A03A6D1, 0x5E66D9FE, 0x77C4AEDF, 0x73FDAD68 } } } } },
+	// (2^96)*B * 5
+	{ { { { { 0x4F97E0A6, 0x20505FA3, 0x16909F86, 0x79ACB745 } },
+	      { { 0x82094271, 0xA163A5DC, 0x2F63A6BC, 0x1B6E5456 } } } },
+	  { { { { 0x7E812C96, 0x9EFD3DD1, 0x136FD51D, 0x6901EB6C } },
+	      { { 0xC0488EEA, 0x13157F6F, 0x0270A4C0, 0x67729C40 } } } } },
+	// (2^96)*B * 6
+	{ { { { { 0xE30AA449, 0xDBEAF734, 0xB81EC506, 0x2E1D908E } },
+	      { { 0x61127B0E, 0xF2611727, 0xBA512D9F, 0x2DC2FA82 } } } },
+	  { { { { 0x68E311D9, 0x44172899, 0xD5748EBC, 0x57F6D770 } },
+	      { { 0x99E2D413, 0x97723CD4, 0xCC746EF0, 0x283638AE } } } } },
+	// (2^96)*B * 7
+	{ { { { { 0x8B0BCCC7, 0xE16BBA3D, 0x44C9E28F, 0x29BE1EE4 } },
+	      { { 0x751536A3, 0x6E4A728A, 0x00888F7C, 0x08FD01F0 } } } },
+	  { { { { 0x6105457B, 0x3346C207, 0x67B0008B, 0x290BC8D9 } },
+	      { { 0x8C9C3D6E, 0xCC0E64B7, 0x2E01B797, 0x14197A7C } } } } },
+	// (2^96)*B * 8
+	{ { { { { 0xF4B109E4, 0x891B5765, 0x03AA5B0A, 0x4C341F78 } },
+	      { { 0xB329C9A0, 0x7DF0A0F3, 0x55940920, 0x6E637EAE } } } },
+	  { { { { 0x7624B8A0, 0x81C1B2EF, 0x54F22B55, 0x528F805E } },
+	      { { 0x7A0FFB48, 0x43A540E6, 0x07BE133F, 0x7A79D0B6 } } } } },
+	// (2^112)*B * 1
+	{ { { { { 0xD66BA56A, 0xC1F4C633, 0x32533CB0, 0x7D9B1E41 } },
+	      { { 0x7A815900, 0xA8F063FC, 0x90C430AB, 0x2AE42303 } } } },
+	  { { { { 0x418C5E31, 0x9C88AFA1, 0x61408152, 0x7C5EAC42 } },
+	      { { 0x9A33D05D, 0xB59EEFF3, 0x36288A15, 0x2A922A97 } } } } },
+	// (2^112)*B * 2
+	{ { { { { 0xB8DB9C6D, 0x931C8419, 0xD2EF0F7E, 0x4A5AC93A } },
+	      { { 0xD9AEF481, 0xB9E9521C, 0xA16E3943, 0x09666931 } } } },
+	  { { { { 0xBC4DABF3, 0x278865AF, 0x6999A78A, 0x60C0EF4C } },
+	      { { 0x67A2D56F, 0x4C0D0DAC, 0xD04AF633, 0x0A00AB0C } } } } },
+	// (2^112)*B * 3
+	{ { { { { 0xB8EEFD6F, 0xDDDFC57C, 0xABC65840, 0x49A078F7 } },
+	      { { 0x9A0F9FB0, 0xA1F8ED39, 0x1F17E1B4, 0x02AC378C } } } },
+	  { { { { 0x24069D94, 0x18AFB5E3, 0x8D7C904F, 0x419ABF98 } },
+	      { { 0x56779F66, 0x8918CAA7, 0xFF58D5FC, 0x3082A874 } } } } },
+	// (2^112)*B * 4
+	{ { { { { 0x8983088E, 0x66788093, 0x81DEDA98, 0x120E42C2 } },
+	      { { 0xC3F75791, 0x89B9BDB3, 0x7CF831FE, 0x4FD7CC58 } } } },
+	  { { { { 0xEB6DFEF1, 0x14E7BF07, 0x8837D49E, 0x51654F7E } },
+	      { { 0x160EF58E, 0xFE34DDFA, 0x4B6E4E9E, 0x0FA0A648 } } } } },
+	// (2^112)*B * 5
+	{ { { { { 0xE56B95E0, 0x9F07368D, 0x5692A8FD, 0x5F3BF106 } },
+	      { { 0x7E35A689, 0x8B98E41E, 0x49CB6756, 0x221B29D9 } } } },
+	  { { { { 0x49E44F7D, 0x22E6C2AD, 0xF9256E10, 0x48E6BCAC } },
+	      { { 0xA7AE3CB9, 0x167749EE, 0xA8452C87, 0x20307DAC } } } } },
+	// (2^112)*B * 6
+	{ { { { { 0x314930A8, 0xA729913B, 0x2D9351C1, 0x09818428 } },
+	      { { 0xB38B95A1, 0x8E4EE183, 0x89DD53C4, 0x09325D13 } } } },
+	  { { { { 0x45BC16A0, 0x0921260C, 0xCC6F38C8, 0x2FAC10BC } },
+	      { { 0xE27A51BE, 0xE0021878, 0xEC80E8A2, 0x2329C0C1 } } } } },
+	// (2^112)*B * 7
+	{ { { { { 0x2C64FE7D, 0x8CB11D82, 0x437DB362, 0x5C7396E2 } },
+	      { { 0x4C582F34, 0x901EA0EF, 0x53FD55DB, 0x30FFA58F } } } },
+	  { { { { 0x55536293, 0x7814C638, 0x378CBC90, 0x46F5D442 } },
+	      { { 0x3917C055, 0xF06C8D81, 0x6ACE7778, 0x78369F1A } } } } },
+	// (2^112)*B * 8
+	{ { { { { 0xD241D1DA, 0xC1A67FDC, 0x1EBB2337, 0x4922C3E5 } },
+	      { { 0xBC8F3100, 0x586723B1, 0xE06B02BD, 0x338E8FEE } } } },
+	  { { { { 0x8E962BC6, 0x7CEB5378, 0xE5BC30BA, 0x5A84135F } },
+	      { { 0x5DB09F90, 0x0DDC2083, 0x366F4DB8, 0x21324171 } } } } },
+#elif GLS254_MULGEN_TABLES == 16
+	// B * 1
+	{ { { { { 0x326B8675, 0xB6412F20, 0x9AE29894, 0x657CB9F7 } },
+	      { { 0xF66DD010, 0x3932450F, 0xB2E3915E, 0x14C6F62C } } } },
+	  { { { { 0x023DC896, 0x5FADCA04, 0xA04300F1, 0x763522AD } },
+	      { { 0x9E07345A, 0x206E4C1E, 0x2381CA6D, 0x4F69A66A } } } } },
+	// B * 2
+	{ { { { { 0xD693FA8F, 0x415A7930, 0xDF2F1CA6, 0x1D78874E } },
+	      { { 0xDAE036F7, 0xF61DEA7C, 0xE5F279EA, 0x4B30C0F5 } } } },
+	  { { { { 0xFBD6BE01, 0xC19ED043, 0x6ABE9465, 0x693D8F2F } },
+	      { { 0xD452AB50, 0x0F2F0D9C, 0x0A6EE21C, 0x19720E49 } } } } },
+	// B * 3
+	{ { { { { 0x1889FE19, 0x0BC57355, 0x1393238B, 0x665C451B } },
+	      { { 0x27CA6F4D, 0xE053B1D0, 0x34043EA7, 0x5C27A07D } } } },
+	  { { { { 0xA1F56BB6, 0xFE1E7723, 0x7D15931D, 0x7B780510 } },
+	      { { 0xE184E5DF, 0xAE7D87EF, 0xF11925D5, 0x0F6F5F4E } } } } },
+	// B * 4
+	{ { { { { 0x06C9A0C8, 0xA11DB5F2, 0xC72A3AB3, 0x061309D0 } },
+	      { { 0xEED4F57B, 0x91999BBE, 0xC3C0D1DA, 0x77F10DBD } } } },
+	  { { { { 0x812A13C2, 0x38EE9EC6, 0x9DCA6BB5, 0x77FBC24A } },
+	      { { 0xC034074B, 0x181DB8C3, 0xA8E44BBD, 0x6D296D30 } } } } },
+	// B * 5
+	{ { { { { 0xCF1FAB5F, 0xC715B038, 0x610AD947, 0x0DA235C1 } },
+	      { { 0x7E52B936, 0xD3AC0FF5, 0x42EA1434, 0x7094DAC3 } } } },
+	  { { { { 0x32462848, 0x06A589BB, 0x1566BBAF, 0x0F876725 } },
+	      { { 0x17C2DAAB, 0x9F808AC9, 0x55FE4D2C, 0x32B14A68 } } } } },
+	// B * 6
+	{ { { { { 0x2FEA71F8, 0xB210B545, 0x921194F5, 0x14D11ED1 } },
+	      { { 0x4E3E4518, 0x476FF44B, 0x007A5A24, 0x6F68AAC2 } } } },
+	  { { { { 0x43C891FA, 0x57BE3BF0, 0x548C5D6C, 0x4F28EEAF } },
+	      { { 0xE898732D, 0x72895485, 0xB3EB369B, 0x5683B98C } } } } },
+	// B * 7
+	{ { { { { 0xA16EAC69, 0x1F6121CE, 0xBC02778C, 0x19EB28FD } },
+	      { { 0xB2803207, 0x0E86728B, 0xD9893789, 0x03E9B9FC } } } },
+	  { { { { 0x7604ABE1, 0x13DE2DAE, 0xA6611933, 0x5121D6B7 } },
+	      { { 0x9644C754, 0xAFC835F3, 0xE19E6CB3, 0x0A1F6E2D } } } } },
+	// B * 8
+	{ { { { { 0xF80BD001, 0xCDCB2821, 0xC02477B7, 0x4D1FCC11 } },
+	      { { 0x237C442C, 0x2A6A17AF, 0xD4D6114C, 0x1301DB82 } } } },
+	  { { { { 0x44C7077A, 0x83CF1AA2, 0xBC942DCB, 0x327AC316 } },
+	      { { 0x8D0BBFA4, 0xAA4C2E84, 0x2A0788B2, 0x235DF1F9 } } } } },
+	// (2^8)*B * 1
+	{ { { { { 0x6953A016, 0xB88E4005, 0xD2232083, 0x43C6EC23 } },
+	      { { 0xB6390D73, 0x7130F7CF, 0xD66B8688, 0x6FF555B5 } } } },
+	  { { { { 0xBACF5878, 0x54804FF8, 0x286472DF, 0x26BF6872 } },
+	      { { 0xA425F62A, 0x7D9D7BA0, 0x5B2DC304, 0x10017F16 } } } } },
+	// (2^8)*B * 2
+	{ { { { { 0xFF87F125, 0x52A4FE43, 0xA45C0B27, 0x66237AC8 } },
+	      { { 0x39946CF7, 0xD79B0362, 0x6DE58B5F, 0x2760FC7D } } } },
+	  { { { { 0xA98B9845, 0x28C080D5, 0x20A6AA23, 0x4E4C4AB4 } },
+	      { { 0xEE7867A0, 0xC0135113, 0xBA95E062, 0x48A5C489 } } } } },
+	// (2^8)*B * 3
+	{ { { { { 0xB955E645, 0xE98DE4CB, 0xE09AFE8C, 0x562613F0 } },
+	      { { 0xEFFBDF05, 0x7E7798C0, 0x9B9E32A2, 0x35B42FBA } } } },
+	  { { { { 0x3E9C1619, 0x8D927400, 0x2EF1D683, 0x7A48F929 } },
+	      { { 0xB5D563FD, 0xB064BAFD, 0xA59D35E2, 0x2B92B12B } } } } },
+	// (2^8)*B * 4
+	{ { { { { 0x8DDE1AA2, 0xCCB5397F, 0xD5F36CB6, 0x11017048 } },
+	      { { 0x260E0C2A, 0xBFD1A530, 0x68B9C414, 0x14145662 } } } },
+	  { { { { 0xF2A1DE94, 0xC3843766, 0x28E00569, 0x3F9836B4 } },
+	      { { 0x4EB29C21, 0x077D8592, 0xF6E1D9D5, 0x6079EC32 } } } } },
+	// (2^8)*B * 5
+	{ { { { { 0x4BBAE75B, 0x703D8343, 0x057C0743, 0x40AEF57D } },
+	      { { 0x95C2505B, 0x212BDAB1, 0x33A28F9C, 0x38D7319C } } } },
+	  { { { { 0xD1E65551, 0x6DCDD2FA, 0x447FB32E, 0x23357609 } },
+	      { { 0x0855FF0E, 0x758726CA, 0x1CD4DD96, 0x770BC2D3 } } } } },
+	// (2^8)*B * 6
+	{ { { { { 0x54B8D340, 0xE994DFC8, 0x5D489537, 0x2B46C955 } },
+	      { { 0x90F63A63, 0xAC6BB1F4, 0x7AE688C3, 0x55E98C5B } } } },
+	  { { { { 0xF59C23E9, 0x7DFF4405, 0x8D9AFA62, 0x4530367E } },
+	      { { 0xD8D9A92F, 0xBCA617E2, 0xFC2E6797, 0x0F21AD71 } } } } },
+	// (2^8)*B * 7
+	{ { { { { 0xCFFCE8E3, 0x01430A3B, 0xD0EE65C0, 0x48CEA748 } },
+	      { { 0x660F497D, 0xE0733F23, 0xA613BDC6, 0x7CBB6979 } } } },
+	  { { { { 0x04DAEBB3, 0x17179A3F, 0x04F4B380, 0x53B3A6BF } },
+	      { { 0x502DFD17, 0xEA07BEFD, 0x16F7195A, 0x0EB5908F } } } } },
+	// (2^8)*B * 8
+	{ { { { { 0x50632F2C, 0x61C2769C, 0x9501A8A8, 0x400763A6 } },
+	      { { 0xECD7CAE0, 0x6DD5EE37, 0x059E1A95, 0x64361800 } } } },
+	  { { { { 0x3F1DE8D4, 0xB31B0BBD, 0x76D5D25E, 0x7C80A27D } },
+	      { { 0xFAFFEF01, 0xFAD4105D, 0x063792CF, 0x299E0F6A } } } } },
+	// (2^16)*B * 1
+	{ { { { { 0x5603B9BF, 0xBB5FBF2F, 0x98B576B4, 0x4116A532 } },
+	      { { 0x2B5C4B00, 0x151A4CBB, 0x19F67653, 0x65FD95A1 } } } },
+	  { { { { 0x8588F5A0, 0x1E4D4153, 0xBFFBAFE0, 0x1697B728 } },
+	      { { 0xEDBFA37E, 0x7D8DD3DB, 0x5A7EA4CE, 0x17E9C5DE } } } } },
+	// (2^16)*B * 2
+	{ { { { { 0x316A1FE5, 0xEDC20D38, 0x1D7C64EF, 0x595F5371 } },
+	      { { 0x01B258D5, 0x6FC95B1B, 0x4C38D3D2, 0x173847B4 } } } },
+	  { { { { 0x66A97939, 0x797A38EC, 0xAB628228, 0x7B09419A } },
+	      { { 0x199028FB, 0xF5121543, 0xB35928B9, 0x147C6217 } } } } },
+	// (2^16)*B * 3
+	{ { { { { 0x62D75E04, 0x79903D39, 0x16C9A092, 0x22CE4276 } },
+	      { { 0xE844BC78, 0x3526ED89, 0xD5E30BF4, 0x19F5ECEB } } } },
+	  { { { { 0x650A795E, 0x5E4C510E, 0x6145497F, 0x7620ED2A } },
+	      { { 0x7FFA8242, 0x3ED9F0CE, 0x3D2AD607, 0x6F532914 } } } } },
+	// (2^16)*B * 4
+	{ { { { { 0xD464A400, 0xFFD584D5, 0x2C24699F, 0x05DBD05C } },
+	      { { 0xC3075493, 0x2D270E5D, 0xC0B4F6DA, 0x3378365C } } } },
+	  { { { { 0x840E8BA4, 0xEA43590A, 0x123EF605, 0x6764FEEF } },
+	      { { 0x9663D2F6, 0x99B02919, 0xF2838856, 0x4CAC6706 } } } } },
+	// (2^16)*B * 5
+	{ { { { { 0x489FBA63, 0xBC673A32, 0x6357ABE4, 0x043A2500 } },
+	      { { 0xDFC01C42, 0x22499F73, 0xA879C25F, 0x1D5D2409 } } } },
+	  { { { { 0x00E9ACB3, 0xE7A4E5B4, 0xC776ABEC, 0x79326BFA } },
+	      { { 0x3BE08F4F, 0x731C33D2, 0x307A172D, 0x7463FA2F } } } } },
+	// (2^16)*B * 6
+	{ { { { { 0x0E4C1365, 0x30125CEE, 0x01BA0CCD, 0x506449C8 } },
+	      { { 0xADDF20DF, 0x2111819E, 0x40FCD6E3, 0x16DDD39C } } } },
+	  { { { { 0x60A9B5D4, 0x2F40CBCE, 0x9AA2C074, 0x3C5EE79B } },
+	      { { 0x2F706D29, 0xC44E87AF, 0x33D996E4, 0x4D13143D } } } } },
+	// (2^16)*B * 7
+	{ { { { { 0x85EF0180, 0x9B65ECE6, 0x940B104D, 0x49B98D5B } },
+	      { { 0x25FD1B43, 0x55676A13, 0x66258A97, 0x14D2B13A } } } },
+	  { { { { 0xB4971DB9, 0x9295DAE3, 0x38BD98F3, 0x1228F6F9 } },
+	      { { 0x6E5580B5, 0x98F7656B, 0x10CD0138, 0x79EB218D } } } } },
+	// (2^16)*B * 8
+	{ { { { { 0x28DFBBF3, 0xDC55A228, 0x0216C316, 0x42758EC7 } },
+	      { { 0x03EBB993, 0xB1D5008C, 0x8B02959D, 0x5DA6A610 } } } },
+	  { { { { 0x32AF273B, 0x22653BF6, 0x7863B996, 0x297725D5 } },
+	      { { 0x3CF58605, 0x4A3B79EF, 0x55FDF51E, 0x24DBA95D } } } } },
+	// (2^24)*B * 1
+	{ { { { { 0x9C0C4E5F, 0xCA49E7C9, 0x75237779, 0x028BFE50 } },
+	      { { 0x45764454, 0x00795FC4, 0x508B2CEF, 0x4C21F485 } } } },
+	  { { { { 0x90F91C1D, 0x615A0EBB, 0x77756434, 0x1C3FF3C3 } },
+	      { { 0x1B4BA454, 0x2B9A39B2, 0xF766F4D0, 0x787F9682 } } } } },
+	// (2^24)*B * 2
+	{ { { { { 0x9389B8BE, 0x34134588, 0x8685FC25, 0x4BD8E04E } },
+	      { { 0x29E7DBE2, 0xB20A6247, 0x0F120AD1, 0x3DC5F5ED } } } },
+	  { { { { 0x3C40213C, 0xE88EF81E, 0x0F559C20, 0x1D614460 } },
+	      { { 0x21ABA386, 0xA71FEE8B, 0xBDE605CB, 0x09DA1923 } } } } },
+	// (2^24)*B * 3
+	{ { { { { 0xFA670F19, 0xBFFBE89E, 0x12ED7341, 0x4B5AF012 } },
+	      { { 0x938C8053, 0x5CD21BDD, 0xCD098026, 0x6C43C877 } } } },
+	  { { { { 0x020F0D5C, 0x21183145, 0xE5215464, 0x21825669 } },
+	      { { 0x729791FE, 0xB88D758C, 0x49205236, 0x763560E2 } } } } },
+	// (2^24)*B * 4
+	{ { { { { 0x037C7FCA, 0x94BD10E3, 0xD9CEF811, 0x656298EF } },
+	      { { 0xD7F43679, 0xF692F72B, 0x7139A07D, 0x6D56B9D3 } } } },
+	  { { { { 0x024D0D40, 0x295C9EA9, 0xD6F0CB79, 0x0DAA9646 } },
+	      { { 0x11DB6045, 0x0F0BBC20, 0xCEBA94CE, 0x0C7C0B6A } } } } },
+	// (2^24)*B * 5
+	{ { { { { 0xB295AFC6, 0x9A85183C, 0x371C8094, 0x66EE8407 } },
+	      { { 0x1E75BB2B, 0x5FEC9B1D, 0xE573A31B, 0x19179478 } } } },
+	  { { { { 0x459F9520, 0x38BFA8DB, 0xCE4D3A65, 0x784A537D } },
+	      { { 0x517EE5C5, 0x158B2135, 0xA3047383, 0x2D807A19 } } } } },
+	// (2^24)*B * 6
+	{ { { { { 0xAA6340B3, 0x129E3609, 0x2F65E9DB, 0x0FEFC186 } },
+	      { { 0xBDBDF97C, 0x61F15BB3, 0x20F5BD0E, 0x7AA153A0 } } } },
+	  { { { { 0xB5C8CFD9, 0x8C58679F, 0xCAF35DB9, 0x343B18EA } },
+	      { { 0x3F652AFB, 0x326B0CFA, 0x767A141F, 0x71176994 } } } } },
+	// (2^24)*B * 7
+	{ { { { { 0x90A4BD9B, 0x7B001336, 0x88C0BDE7, 0x7B1D05AF } },
+	      { { 0x65420BC7, 0x8007B2F2, 0x9B162CFA, 0x39F1521A } } } },
+	  { { { { 0xFD80C443, 0x59BCCC03, 0x2CDF68C2, 0x0477293F } },
+	      { { 0xF37FBD3F, 0x59DAB929, 0xD891392F, 0x12D43753 } } } } },
+	// (2^24)*B * 8
+	{ { { { { 0xAE935B30, 0x77E9C3C7, 0x4036CF04, 0x6DFEE1E9 } },
+	      { { 0x8E1F6B72, 0xDD55FC93, 0x83EB6FF4, 0x0F6C018F } } } },
+	  { { { { 0x452E0A89, 0x6BF9B617, 0xE79F8BBE, 0x2F6EEB42 } },
+	      { { 0x528346EB, 0x30233678, 0x5AD5F2F4, 0x704CFF32 } } } } },
+	// (2^32)*B * 1
+	{ { { { { 0x4DDB30B8, 0x63557581, 0x5030FA03, 0x5B61982B } },
+	      { { 0x22FC0A21, 0x11DFBA3C, 0x0F317C69, 0x59B8AAF2 } } } },
+	  { { { { 0x4BA656F7, 0x24CCD3E5, 0x8F12A690, 0x75E44943 } },
+	      { { 0x83593FAD, 0x35A7574A, 0xD281984B, 0x605B7617 } } } } },
+	// (2^32)*B * 2
+	{ { { { { 0x63E928F5, 0x90CF4E35, 0x5223D2E7, 0x50074E81 } },
+	      { { 0x354B113C, 0x5C404A45, 0xC8167241, 0x0FA6E6AE } } } },
+	  { { { { 0x6DA726AA, 0xA1301F5B, 0x36FADE6F, 0x417E796A } },
+	      { { 0xA030F951, 0x132B507C, 0x27837BD6, 0x1B059582 } } } } },
+	// (2^32)*B * 3
+	{ { { { { 0xBD1848ED, 0x3EB8194B, 0xA973E23F, 0x49233033 } },
+	      { { 0x9659B3C6, 0x162E3AC5, 0xCF1B0A47, 0x55D7E164 } } } },
+	  { { { { 0x50D0746F, 0x8408AE6F, 0xDA5B5D8C, 0x54B1EF88 } },
+	      { { 0xE0266218, 0xBEEF1BC0, 0x31BD68F4, 0x47AEBA16 } } } } },
+	// (2^32)*B * 4
+	{ { { { { 0xFEBCA318, 0xACDCDE13, 0x6F23CA1C, 0x2054A068 } },
+	      { { 0x9A944830, 0x4FC664CE, 0x5CC70929, 0x0EE62762 } } } },
+	  { { { { 0xF712C3D2, 0x10FFCF13, 0x378DADCF, 0x7AEF8651 } },
+	      { { 0x3A88BB41, 0x83BF078A, 0xED94CCB7, 0x6540AA59 } } } } },
+	// (2^32)*B * 5
+	{ { { { { 0x548A5B5C, 0xC3A9CDF7, 0x09251988, 0x7CC55823 } },
+	      { { 0x1D8FB1B6, 0x359CFD6F, 0xAEBB6DFE, 0x16617EA6 } } } },
+	  { { { { 0x3B570A8D, 0x5402D084, 0xDDCA45AF, 0x72E1B8FC } },
+	      { { 0x6A5F05AF, 0x8E894715, 0x4943A009, 0x47E972B5 } } } } },
+	// (2^32)*B * 6
+	{ { { { { 0x9D224CE8, 0x21ED4996, 0xF0314FFD, 0x502BF009 } },
+	      { { 0x29EDEB9F, 0x378AD19D, 0x0F08EA14, 0x217F953E } } } },
+	  { { { { 0x58AA005F, 0xFBEACAA8, 0xB084D2E9, 0x5C3956EA } },
+	      { { 0x9C0AF3DD, 0x02FFF925, 0x4DA7B8F3, 0x2E6C4558 } } } } },
+	// (2^32)*B * 7
+	{ { { { { 0xA435418E, 0xEFE3D1C9, 0x78B4B863, 0x29220A41 } },
+	      { { 0xAB5842A9, 0xF43A2709, 0x40A92711, 0x0C7C4F15 } } } },
+	  { { { { 0x7D638424, 0x1C6B7791, 0x16ED213B, 0x611353A7 } },
+	      { { 0x4BC271D7, 0x64291F07, 0x1D26E566, 0x65DD7EC4 } } } } },
+	// (2^32)*B * 8
+	{ { { { { 0xC194ECC9, 0x9B4DA61D, 0xCA8836CF, 0x7CB707BD } },
+	      { { 0xD4BFFDF2, 0x77ACDF95, 0xD3A61F80, 0x36586184 } } } },
+	  { { { { 0xC2CE8B3D, 0xCDAA62F1, 0x824B839B, 0x10B26E50 } },
+	      { { 0x667C1F45, 0xFC7E3B92, 0x267FACD9, 0x27F128AB } } } } },
+	// (2^40)*B * 1
+	{ { { { { 0x75760DFC, 0xEDFF5AD3, 0xEA88F1A6, 0x6A8FB85A } },
+	      { { 0x166624A2, 0xDDC1F53A, 0x15ECD8EE, 0x337D092F } } } },
+	  { { { { 0x0AB84457, 0x5CA20C12, 0x209234EA, 0x053C636C } },
+	      { { 0x2C298BFE, 0x798BFE45, 0xBBC0A11A, 0x678C7377 } } } } },
+	// (2^40)*B * 2
+	{ { { { { 0xBDE1B2A6, 0xF1365955, 0xFE899242, 0x6A7776DE } },
+	      { { 0xACF8B816, 0xAE2FD6AC, 0xBFBF0DC5, 0x41BF72A8 } } } },
+	  { { { { 0x2398B49A, 0x685CEC29, 0x3AC3B9D5, 0x444CC3D8 } },
+	      { { 0x53AF6262, 0x133F714D, 0xA1146992, 0x54C831A1 } } } } },
+	// (2^40)*B * 3
+	{ { { { { 0x4EAD54CB, 0xD821D317, 0xE769069B, 0x4A30EC22 } },
+	      { { 0x33D9AAA6, 0xF9DF4AAE, 0xB54063B0, 0x071801CD } } } },
+	  { { { { 0x73F255E9, 0x7CEB3A5B, 0x14461116, 0x1D3D1D47 } },
+	      { { 0xDA05B9AA, 0x6AB21CE1, 0xDB3733B7, 0x3A068543 } } } } },
+	// (2^40)*B * 4
+	{ { { { { 0xEA7C93A2, 0xBDC1BAAB, 0x06478B5E, 0x2CEC2814 } },
+	      { { 0x6FC648BD, 0x5C6E3CCB, 0x0BD965E6, 0x6DA83813 } } } },
+	  { { { { 0xD66E71D1, 0xFF82ED0F, 0x3BD197D8, 0x7A5FC66A } },
+	      { { 0xD4041676, 0x077B0697, 0xE27A99A3, 0x1BAE9AC1 } } } } },
+	// (2^40)*B * 5
+	{ { { { { 0x1F662154, 0x7426F8B3, 0xB68F5DBE, 0x646D7960 } },
+	      { { 0x6DA0AE97, 0x96EC60DD, 0x94075DC8, 0x0F76B97C } } } },
+	  { { { { 0xF082F242, 0xB55590FF, 0xCE849171, 0x18EBAEAD } },
+	      { { 0x402D717D, 0x8D036AF7, 0x57D21231, 0x686ADF63 } } } } },
+	// (2^40)*B * 6
+	{ { { { { 0x98F74BD1, 0x5C995052, 0x3DC14353, 0x558A44CC } },
+	      { { 0xF15A5E09, 0x3B2734CC, 0x6EF3E29F, 0x0895F4B8 } } } },
+	  { { { { 0x4A0E45F0, 0x84874B57, 0xC01D1AF9, 0x3029D4EC } },
+	      { { 0xA1A4B7DA, 0x6B438085, 0x19EBCECF, 0x18010294 } } } } },
+	// (2^40)*B * 7
+	{ { { { { 0x1C78F6B3, 0xB14238FF, 0xAC9280B9, 0x74EEB8E7 } },
+	      { { 0x787D2049, 0x279878E8, 0x466C760E, 0x4BCB1A3F } } } },
+	  { { { { 0xF0006F7D, 0x2696BA9E, 0xA6631A3F, 0x129B3A2B } },
+	      { { 0x04E061A9, 0x6A11B665, 0x05CE0E58, 0x200CF453 } } } } },
+	// (2^40)*B * 8
+	{ { { { { 0xDE9BB16E, 0x648C077A, 0x1D120176, 0x09235364 } },
+	      { { 0x2CFD6885, 0x59FD693E, 0x5059EBDC, 0x648B40D9 } } } },
+	  { { { { 0x08869942, 0x28726BB3, 0xCA947C45, 0x4E1D0590 } },
+	      { { 0xFED01B9F, 0x3B63FEEC, 0x5D05C354, 0x7430E410 } } } } },
+	// (2^48)*B * 1
+	{ { { { { 0xE7D22B99, 0x29B675E3, 0x32C67197, 0x022B6694 } },
+	      { { 0x4ED2A423, 0x179E4E91, 0x234B6400, 0x63D86CB0 } } } },
+	  { { { { 0x6BBF8F32, 0xD0C3495D, 0x54459C23, 0x17B7FE06 } },
+	      { { 0x80DD8210, 0xE54B5E95, 0x94DACCD3, 0x657CF971 } } } } },
+	// (2^48)*B * 2
+	{ { { { { 0x1F583AA7, 0xC9B73227, 0xC831B657, 0x48EBE938 } },
+	      { { 0x3DD239B2, 0x08882673, 0xE2795C0F, 0x5A1B83A7 } } } },
+	  { { { { 0x663CADC2, 0x55B90869, 0xA293D68D, 0x558747CE } },
+	      { { 0xEC04D71B, 0xC0D11B5F, 0x4B7DD481, 0x1F359981 } } } } },
+	// (2^48)*B * 3
+	{ { { { { 0xC74CA692, 0x88257C77, 0xFE2543D0, 0x083CA721 } },
+	      { { 0x545B6075, 0xD35CC1F8, 0x937BD410, 0x25517FD0 } } } },
+	  { { { { 0xF4A229B3, 0x95728815, 0x69C8BDF6, 0x4EEBAF37 } },
+	      { { 0x52ECC702, 0x4058035A, 0xBBDED186, 0x1CCFEC1A } } } } },
+	// (2^48)*B * 4
+	{ { { { { 0xAD87370F, 0xFFFC3AB1, 0x49F6C0D6, 0x4FBD707B } },
+	      { { 0xB244138F, 0x0735E39B, 0xC6AC4AD7, 0x35FBF7D1 } } } },
+	  { { { { 0x415340D7, 0xC63ADBF0, 0xA74232B1, 0x5C7B01DD } },
+	      { { 0xF7343964, 0xD040A472, 0x7AABE0B4, 0x53547D50 } } } } },
+	// (2^48)*B * 5
+	{ { { { { 0xFB42D19F, 0x3DD7A80D, 0xDAD45900, 0x2B3B54FB } },
+	      { { 0x76356340, 0x2C8286E5, 0xC04E2063, 0x2688738A } } } },
+	  { { { { 0xB773591E, 0xE6411CD8, 0xA0D53C14, 0x46E22C91 } },
+	      { { 0x2385D850, 0x976674A0, 0x59FE3A9B, 0x0256E9EC } } } } },
+	// (2^48)*B * 6
+	{ { { { { 0x3A9CD59F, 0x684C0A06, 0xA8717000, 0x625B8BD7 } },
+	      { { 0xBF606FD2, 0x30299878, 0x5B348ACB, 0x58C023C4 } } } },
+	  { { { { 0x2918F1E4, 0xCED7EE9C, 0xCC457719, 0x0B1D80FC } },
+	      { { 0xB19404A3, 0xD2930402, 0x2F29363A, 0x2F0E7637 } } } } },
+	// (2^48)*B * 7
+	{ { { { { 0x374870D5, 0xE0D62664, 0x4A3B6122, 0x481C9821 } },
+	      { { 0x8B01FD1E, 0xAB158BB2, 0x14E9DCF7, 0x11F514A3 } } } },
+	  { { { { 0x78696395, 0x5514EFE5, 0xA656D2E7, 0x7FCBA955 } },
+	      { { 0x5DDB9E5B, 0x7C323607, 0xE68E6A8C, 0x2BB4DA27 } } } } },
+	// (2^48)*B * 8
+	{ { { { { 0xC1EEDEAA, 0x910E755E, 0x986379C5, 0x54CB83C9 } },
+	      { { 0xBF8A2419, 0x6198DBEA, 0xA7877EA2, 0x329700D0 } } } },
+	  { { { { 0x0E39DD4A, 0x7EECDE99, 0x560E7792, 0x76DA79D1 } },
+	      { { 0xB55A0C2B, 0x166369EB, 0x475BC922, 0x4357A81C } } } } },
+	// (2^56)*B * 1
+	{ { { { { 0x57D63CFA, 0x53C7C5D4, 0x99C5B1D6, 0x413E4B40 } },
+	      { { 0xC3EEA1FE, 0x7BCA9A15, 0x35EF47AC, 0x470EB1EF } } } },
+	  { { { { 0xD8C6A83F, 0xC30F6FE3, 0xAF9D3D59, 0x04E0C73B } },
+	      { { 0x529F2617, 0x54856738, 0x8DA892F0, 0x4D053D02 } } } } },
+	// (2^56)*B * 2
+	{ { { { { 0x197CC107, 0x3A191357, 0x071029FE, 0x012B8E01 } },
+	      { { 0x7EB9E318, 0x0502BEC1, 0x117363D5, 0x22E62664 } } } },
+	  { { { { 0xF3F9669E, 0x76E614DA, 0xDCF9702C, 0x75CED114 } },
+	      { { 0x0058E5D9, 0x1D7B9761, 0xD512215E, 0x7DB962C4 } } } } },
+	// (2^56)*B * 3
+	{ { { { { 0xB260DB37, 0x8667D543, 0x0C98338E, 0x59289B6C } },
+	      { { 0x7A195D24, 0x77C25177, 0x9102E92A, 0x09A3CB68 } } } },
+	  { { { { 0xBF4B7C30, 0x7B637619, 0x0F9E7D3B, 0x3D8F2457 } },
+	      { { 0x12E84F53, 0x2A4C9EF6, 0xC13E2058, 0x2B41DDE5 } } } } },
+	// (2^56)*B * 4
+	{ { { { { 0x57120AA3, 0xA0F48D18, 0xDE29EA72, 0x5A8ABBE8 } },
+	      { { 0xDC4A975D, 0x7ACC9FF9, 0xADFC1C26, 0x7E6C12B1 } } } },
+	  { { { { 0x1249C479, 0x221B9110, 0x5609CD76, 0x7E561CE1 } },
+	      { { 0x83E528E7, 0x21406D15, 0xA93DDB8A, 0x0595813A } } } } },
+	// (2^56)*B * 5
+	{ { { { { 0xF52705C8, 0x7752C56C, 0xBD08F268, 0x5AA0B329 } },
+	      { { 0x9013E4C4, 0x0B3B1528, 0x08026BC8, 0x6133012F } } } },
+	  { { { { 0x85F3394D, 0x2ACC58C2, 0x74FBD9FF, 0x728B9032 } },
+	      { { 0x72DA7295, 0x629C48BE, 0x7D989DBB, 0x13157B6D } } } } },
+	// (2^56)*B * 6
+	{ { { { { 0x3497B2E4, 0x616218CA, 0x6FE1A23F, 0x5F62FB27 } },
+	      { { 0x847F9F28, 0x40DA9D98, 0x5B3A3E00, 0x3DB26CAB } } } },
+	  { { { { 0x521D389C, 0x8ED16541, 0x47511BCB, 0x3DAB2174 } },
+	      { { 0x32A2A693, 0x5762A182, 0xEA98EF8C, 0x5282875A } } } } },
+	// (2^56)*B * 7
+	{ { { { { 0x5BFF24B9, 0xDC99B15D, 0xB413FA5F, 0x39D9FBF7 } },
+	      { { 0x82D6E2C8, 0xF6E363C2, 0xE9198811, 0x22B3C787 } } } },
+	  { { { { 0xA2B6E8BD, 0xED28F02B, 0x4FAC4F70, 0x3733AF83 } },
+	      { { 0x7337DFE4, 0x9264B3A7, 0x74D0D42D, 0x022283D1 } } } } },
+	// (2^56)*B * 8
+	{ { { { { 0x8FE0EBD2, 0xB856F04D, 0x034244BE, 0x7CDB5B51 } },
+	      { { 0x426EB0E0, 0x42EC57A5, 0x907268AE, 0x5EB7AA0D } } } },
+	  { { { { 0x4D9E8260, 0xE3B34E8A, 0x99E942E5, 0x3117F052 } },
+	      { { 0xC8E4AC09, 0xEF61CA84, 0x5AD11E46, 0x5BF2AE6B } } } } },
+	// (2^64)*B * 1
+	{ { { { { 0x4D3AE7AC, 0x26123159, 0x28CEB8AD, 0x082A5BBF } },
+	      { { 0x83030F30, 0xD959B911, 0x5AF1898E, 0x4447B9E0 } } } },
+	  { { { { 0x4D3DE629, 0x2C7A5450, 0xA6F9484C, 0x431796A3 } },
+	      { { 0xE5D3C8CD, 0x357D7D22, 0xE5323C2E, 0x147CCFFB } } } } },
+	// (2^64)*B * 2
+	{ { { { { 0xF207FAC6, 0x05704BF4, 0x161BD3A2, 0x0F16C7B1 } },
+	      { { 0x870DEC6E, 0x1AD76AF2, 0xD0BF2740, 0x4FB614A7 } } } },
+	  { { { { 0x28566D8A, 0x45D7C01C, 0x4077ABED, 0x005002FF } },
+	      { { 0x5672D4B3, 0x6542A776, 0xA98AB48D, 0x04137083 } } } } },
+	// (2^64)*B * 3
+	{ { { { { 0xF0350244, 0x27C990FF, 0x857F7525, 0x18A5BC91 } },
+	      { { 0x79997083, 0x6004C035, 0xE0E1B992, 0x1744491A } } } },
+	  { { { { 0x17682DD3, 0x9C8593D7, 0x84AE8661, 0x402364E0 } },
+	      { { 0xB2E2B9F3, 0x20F86314, 0x4D9B1FB5, 0x545AF79A } } } } },
+	// (2^64)*B * 4
+	{ { { { { 0xDDA5DC0B, 0x23CBD429, 0x6A5208C3, 0x27DF09B6 } },
+	      { { 0x8B8FF984, 0x10BCC45E, 0x205DF31F, 0x4D7FE346 } } } },
+	  { { { { 0xC97F02A7, 0x0CB81A89, 0x7D64DBF2, 0x3C1C9D27 } },
+	      { { 0x704354B3, 0xF84A977B, 0x368738E4, 0x2C8704A6 } } } } },
+	// (2^64)*B * 5
+	{ { { { { 0x448B153F, 0x5FBA8828, 0x9A0F0423, 0x01E91ADB } },
+	      { { 0x4BFABFFD, 0x1441B534, 0xA4E2D56F, 0x6D0A611A } } } },
+	  { { { { 0xC6ED13FE, 0x67C71E1C, 0xA6321549, 0x4DEFBBD5 } },
+	      { { 0x5515923F, 0xA187801F, 0xB7921BE3, 0x5FAD2693 } } } } },
+	// (2^64)*B * 6
+	{ { { { { 0x9A07D071, 0xCBD5E245, 0xCE94BD91, 0x578067F7 } },
+	      { { 0x22EBB7B9, 0x393D9B57, 0xF4C2C566, 0x07F1E938 } } } },
+	  { { { { 0x7ACE6FEC, 0xAF27AF4B, 0x2CE0A5CF, 0x6DE1B7A6 } },
+	      { { 0x633B4D64, 0xD0C6FCA2, 0x989F7B92, 0x2813A2EA } } } } },
+	// (2^64)*B * 7
+	{ { { { { 0x41DBB5A8, 0x0A58149A, 0x1073E8F8, 0x106DF92D } },
+	      { { 0x493E86B2, 0x197899FC, 0x2197B358, 0x2E0E05CE } } } },
+	  { { { { 0x709BC381, 0x2D603F9B, 0xA19EED77, 0x26507080 } },
+	      { { 0x1A0926FE, 0x5D86707B, 0x55F08B86, 0x2C55B877 } } } } },
+	// (2^64)*B * 8
+	{ { { { { 0xCD1523B9, 0x43086DD4, 0x4CF14DC9, 0x25B6941E } },
+	      { { 0x40028B29, 0x0C30580B, 0xA4F8EDDF, 0x6B6816FF } } } },
+	  { { { { 0x84749178, 0xB9FFB6EF, 0x8D83172B, 0x16BFA2F7 } },
+	      { { 0x577E2135, 0xCD9F9599, 0xC1FB34BF, 0x0B9E5031 } } } } },
+	// (2^72)*B * 1
+	{ { { { { 0x93B9F703, 0x39D19AB9, 0x457E3885, 0x34659A10 } },
+	      { { 0xCC0C73BF, 0xB725542C, 0xFB53A22D, 0x774B7E1E } } } },
+	  { { { { 0x071FDF9E, 0x1C84063C, 0x4F6D270B, 0x56D9D636 } },
+	      { { 0xCE46A73F, 0xA7C27BEE, 0x8386F845, 0x0D45B9ED } } } } },
+	// (2^72)*B * 2
+	{ { { { { 0x09292774, 0xFA0556E8, 0x27F64592, 0x2AB6A723 } },
+	      { { 0xF42560E0, 0xD53BB33B, 0x600C2365, 0x43CD42C7 } } } },
+	  { { { { 0x6BAAD915, 0xC1806749, 0xACD6FE83, 0x460A7C99 } },
+	      { { 0x76FB0017, 0xE5058EB6, 0x0D5F6EC2, 0x71C4E622 } } } } },
+	// (2^72)*B * 3
+	{ { { { { 0x61243D7E, 0xE1CC5CC7, 0xA0855179, 0x2C48C0B9 } },
+	      { { 0xEE076BE5, 0xDB192B8D, 0x6D184964, 0x23CBEE73 } } } },
+	  { { { { 0x6EADEA75, 0xC4D912D4, 0xF1D8708F, 0x341236DE } },
+	      { { 0x77DC7651, 0xBDF8837F, 0x8B111A29, 0x54DC2116 } } } } },
+	// (2^72)*B * 4
+	{ { { { { 0xCCE9AD73, 0x201C5DA8, 0x8B65A128, 0x3AE14D32 } },
+	      { { 0x0ACCFB85, 0x3A428CCA, 0x5BCE3747, 0x55DF11D0 } } } },
+	  { { { { 0xBBA00008, 0x7B1A9728, 0x012841C3, 0x44520599 } },
+	      { { 0xD8EDEF19, 0xECBD3829, 0xCC7BD63A, 0x591C7C5E } } } } },
+	// (2^72)*B * 5
+	{ { { { { 0xF0194095, 0x2CF74868, 0x7117705D, 0x32E032EA } },
+	      { { 0x58C8F4F7, 0x341B8EF4, 0xF0C77A51, 0x76220BBC } } } },
+	  { { { { 0x126424D3, 0xFA52C450, 0x23591191, 0x64BD5E8A } },
+	      { { 0xC3ADEDA4, 0x4FA01F9C, 0x2FBF0194, 0x764F2E2B } } } } },
+	// (2^72)*B * 6
+	{ { { { { 0xC65F1E7D, 0xE14FD9B6, 0xBDB947BD, 0x340A0A4B } },
+	      { { 0x8AD2D40E, 0x57935792, 0xA67B6BFE, 0x6371C902 } } } },
+	  { { { { 0xD0D59E9A, 0x96DA4E94, 0x86D1EEDA, 0x1E6D2CF7 } },
+	      { { 0x1242D369, 0xE4AA9B72, 0xAE644519, 0x02C79ECA } } } } },
+	// (2^72)*B * 7
+	{ { { { { 0x7A338F38, 0xF7751DD5, 0xAADFC94E, 0x1D6D5D4D } },
+	      { { 0x9622F915, 0x70A44A96, 0x917C482C, 0x7A124595 } } } },
+	  { { { { 0xFFE9E392, 0x1474FC33, 0x99A143FB, 0x07C90F30 } },
+	      { { 0xCD104905, 0x3CDEA154, 0xA4872CF7, 0x738E7EA8 } } } } },
+	// (2^72)*B * 8
+	{ { { { { 0x71332C8B, 0x52F96CBE, 0xC9D85840, 0x5F3DFED8 } },
+	      { { 0x09CB57AE, 0xA5E736D2, 0x664B6CC0, 0x67B1D202 } } } },
+	  { { { { 0xBCC916A8, 0x1016C6EC, 0x104DB052, 0x08D3FE7E } },
+	      { { 0x7D7ADE49, 0xF05C70C1, 0x4DBBCBA1, 0x597AC48D } } } } },
+	// (2^80)*B * 1
+	{ { { { { 0xB55870B7, 0x130A3549, 0x8EE758CD, 0x1A9D5042 } },
+	      { { 0x068F1BE6, 0xD34BB378, 0xC2FBEFAD, 0x0EDED54C } } } },
+	  { { { { 0x5A650012, 0xAD6C8154, 0xC5524209, 0x6322B057 } },
+	      { { 0x3223D5BE, 0x74F024CD, 0x61272535, 0x346E9D86 } } } } },
+	// (2^80)*B * 2
+	{ { { { { 0xAB845819, 0x77619D35, 0xEE212213, 0x6F41B94D } },
+	      { { 0x177BADCC, 0xB2D5E03A, 0x985647A4, 0x37B2D9CB } } } },
+	  { { { { 0xCDF50548, 0x0F9AE058, 0x6D415C28, 0x50943D82 } },
+	      { { 0x51B1B10E, 0x997CEB96, 0x8363D9F4, 0x103AD918 } } } } },
+	// (2^80)*B * 3
+	{ { { { { 0xE01ABBC4, 0xADDD51E3, 0xB2149F0A, 0x4906CBB8 } },
+	      { { 0xB9862DED, 0x3D7C9B8F, 0x0A4E56C0, 0x35B2A175 } } } },
+	  { { { { 0x8A34EF91, 0x2676116E, 0x5FA1CB29, 0x69BE66A5 } },
+	      { { 0x3D60EC50, 0xCAC77717, 0xFAB03C38, 0x4581C45D } } } } },
+	// (2^80)*B * 4
+	{ { { { { 0x731BC743, 0xD7BC7BFC, 0x257AAFC4, 0x4B3CA8E6 } },
+	      { { 0x4D46A027, 0xBE6D0DFA, 0x658DAB78, 0x74EE3DB4 } } } },
+	  { { { { 0xD3792799, 0x3EA84B83, 0x094DE2FE, 0x3EABF450 } },
+	      { { 0x283EFB4F, 0x31948694, 0x6150E80B, 0x300F339F } } } } },
+	// (2^80)*B * 5
+	{ { { { { 0x64E2F323, 0x6BFCD024, 0x600F5805, 0x3786CA40 } },
+	      { { 0xA39FC498, 0x85974B82, 0x2A2DC265, 0x52FC37E2 } } } },
+	  { { { { 0xDC12D51E, 0xA221DADD, 0xBEF98C2F, 0x626A671B } },
+	      { { 0xB84544B0, 0x873150F8, 0x12C75B0B, 0x589CAEAC } } } } },
+	// (2^80)*B * 6
+	{ { { { { 0x2DF1B6A6, 0xAD0555F4, 0x9FB2D766, 0x163F167C } },
+	      { { 0xA47BC35F, 0x28DA9452, 0x31FECB94, 0x67E0A6D6 } } } },
+	  { { { { 0x6FC9D146, 0xED083D74, 0x4A4E33BA, 0x152AA658 } },
+	      { { 0x070DBF74, 0x172D3E25, 0x31146EDF, 0x57F32D4B } } } } },
+	// (2^80)*B * 7
+	{ { { { { 0xE4A2AA0D, 0x73C0C052, 0x3DF89257, 0x2B18FB38 } },
+	      { { 0xDE04B477, 0x8313DDDA, 0x4CBA7147, 0x1FF574B3 } } } },
+	  { { { { 0xE3AFD217, 0xBBEEF1BB, 0x99D9AA71, 0x39C47560 } },
+	      { { 0x36E7A8F7, 0x4D430031, 0xA3983973, 0x343816CA } } } } },
+	// (2^80)*B * 8
+	{ { { { { 0x29D5041A, 0x93166588, 0x9848862A, 0x71A003CB } },
+	      { { 0x0C5CC629, 0xFCFC34E6, 0x1D5869E3, 0x72D844F8 } } } },
+	  { { { { 0xDD308A7D, 0xB51DB6B6, 0xFE07C8D4, 0x4EF9C7E4 } },
+	      { { 0xB82B490D, 0x36F62659, 0x0DC3F62B, 0x266D4317 } } } } },
+	// (2^88)*B * 1
+	{ { { { { 0x182D744A, 0x0636D956, 0x6BA5BDD0, 0x123E1BA7 } },
+	      { { 0x98527D66, 0x512E6035, 0xC6833850, 0x14CE4EAA } } } },
+	  { { { { 0xA981B991, 0xF37E7066, 0xDCDB3C6F, 0x6DABCC10 } },
+	      { { 0x59ABB395, 0x0E221EA0, 0x1C727B22, 0x1BCD763F } } } } },
+	// (2^88)*B * 2
+	{ { { { { 0xDF6C7495, 0x39858939, 0x599EC1E5, 0x7A01DEEE } },
+	      { { 0x22E4B09E, 0x3791AB5B, 0x7A9413F3, 0x539BBC28 } } } },
+	  { { { { 0x4904F9F0, 0xB8917A73, 0x1F232BBD, 0x598BCEB5 } },
+	      { { 0xD6109DEC, 0xC3061712, 0xF3E8BF1D, 0x2D190B4D } } } } },
+	// (2^88)*B * 3
+	{ { { { { 0xC58939ED, 0x17B5BF62, 0x98FD3EE1, 0x62922E22 } },
+	      { { 0x221583D0, 0xDD7C3CFC, 0x5A39282A, 0x79A354A6 } } } },
+	  { { { { 0xAFAD52D4, 0xD76D96B2, 0x2F287B38, 0x5F0622F6 } },
+	      { { 0xD3BD8EE1, 0x8ECA9460, 0x9A9CFE21, 0x516955EA } } } } },
+	// (2^88)*B * 4
+	{ { { { { 0x80AB08DB, 0xA7026EB3, 0x13ACC28C, 0x646AF94C } },
+	      { { 0xEF6F2F38, 0x3BEFA729, 0xFA5BD3ED, 0x7489E22F } } } },
+	  { { { { 0xCF445AB5, 0xE5648E86, 0x6FEE7F78, 0x034F2AEE } },
+	      { { 0x2873C645, 0x2CCEDD0A, 0xD936C5C5, 0x21A37E45 } } } } },
+	// (2^88)*B * 5
+	{ { { { { 0xB82AC1F3, 0x360AE9B7, 0x9DA97A89, 0x405B4BB4 } },
+	      { { 0xB9A410B1, 0xE5B85453, 0x79C15B60, 0x0137511E } } } },
+	  { { { { 0x135A9865, 0x61634075, 0x26468491, 0x17D6EA1D } },
+	      { { 0x03B13C4E, 0x1AE8CD4B, 0xA56351FC, 0x13830D1F } } } } },
+	// (2^88)*B * 6
+	{ { { { { 0x058D06B7, 0x5C7574C8, 0x02F25829, 0x6EF16F53 } },
+	      { { 0x78E5F54B, 0x02492590, 0xA5A0B54B, 0x1D2596F7 } } } },
+	  { { { { 0x7E762985, 0x6B0A14D0, 0xD65FE159, 0x275084FA } },
+	      { { 0xA4131AB9, 0x15CE6F13, 0x05E10052, 0x738BEF6D } } } } },
+	// (2^88)*B * 7
+	{ { { { { 0x5915256D, 0x9A417540, 0xB0FFA8C9, 0x3232FED0 } },
+	      { { 0xC9558672, 0x9D454F8F, 0x990261E7, 0x16E9CA8A } } } },
+	  { { { { 0x8C00FF99, 0xC168554B, 0xD92D22C6, 0x79C3525E } },
+	      { { 0xEC38C700, 0xA6C85F50, 0xD3180A5F, 0x43FF7F8F } } } } },
+	// (2^88)*B * 8
+	{ { { { { 0x5827DA93, 0xA459A95B, 0x93C792F0, 0x7D18BF99 } },
+	      { { 0xC48390DF, 0xE7BD4F80, 0xFFD6DCE5, 0x4BF9F356 } } } },
+	  { { { { 0xA294BC42, 0xD63E808B, 0x68B5E5C3, 0x1C98CB64 } },
+	      { { 0xF4ECA6D9, 0x76CB4FDD, 0x68E0BB13, 0x7E313E8A } } } } },
+	// (2^96)*B * 1
+	{ { { { { 0xDA88E093, 0x653346E6, 0x9CD13872, 0x30002265 } },
+	      { { 0x5F29D20B, 0x65532D39, 0x7CB5DE42, 0x30FE4C5C } } } },
+	  { { { { 0x421D4A31, 0x0D181FE3, 0x94F4D3F7, 0x35F3E726 } },
+	      { { 0xDD3ED40C, 0x0AB661AD, 0x4F2CADE5, 0x542B83C0 } } } } },
+	// (2^96)*B * 2
+	{ { { { { 0xCF11A8C7, 0x5450A803, 0x1DB4620C, 0x1A3EFC52 } },
+	      { { 0xB4D6810F, 0x3FA30220, 0x1BC8AF08, 0x56C04218 } } } },
+	  { { { { 0xFCE09354, 0x97E3B24D, 0xE7E9C001, 0x7B0F3BAF } },
+	      { { 0xBD91FC40, 0x2DD1D729, 0xC21B1AD2, 0x05C74680 } } } } },
+	// (2^96)*B * 3
+	{ { { { { 0x431C5C00, 0x8F7A7F37, 0x22605514, 0x4487CC96 } },
+	      { { 0x955E5D1C, 0x754A0DB2, 0xB8D0072A, 0x6AA1BE4A } } } },
+	  { { { { 0x6B1BFC14, 0xA6D4611F, 0x6B2E8951, 0x00390364 } },
+	      { { 0x0D536882, 0x723A689D, 0x973B29AB, 0x3B33B3BD } } } } },
+	// (2^96)*B * 4
+	{ { { { { 0xF4444850, 0xE2D4EE8A, 0xD2D38B53, 0x7C4CCD23 } },
+	      { { 0xECC474E6, 0x66C8957A, 0x9CF325E5, 0x70291606 } } } },
+	  { { { { 0xE0752CC9, 0x6FEC1E66, 0x3FC42538, 0x3E40F3D7 } },
+	      { { 0x8A03A6D1, 0x5E66D9FE, 0x77C4AEDF, 0x73FDAD68 } } } } },
+	// (2^96)*B * 5
+	{ { { { { 0x4F97E0A6, 0x20505FA3, 0x16909F86, 0x79ACB745 } },
+	      { { 0x82094271, 0xA163A5DC, 0x2F63A6BC, 0x1B6E5456 } } } },
+	  { { { { 0x7E812C96, 0x9EFD3DD1, 0x136FD51D, 0x6901EB6C } },
+	      { { 0xC0488EEA, 0x13157F6F, 0x0270A4C0, 0x67729C40 } } } } },
+	// (2^96)*B * 6
+	{ { { { { 0xE30AA449, 0xDBEAF734, 0xB81EC506, 0x2E1D908E } },
+	      { { 0x61127B0E, 0xF2611727, 0xBA512D9F, 0x2DC2FA82 } } } },
+	  { { { { 0x68E311D9, 0x44172899, 0xD5748EBC, 0x57F6D770 } },
+	      { { 0x99E2D413, 0x97723CD4, 0xCC746EF0, 0x283638AE } } } } },
+	// (2^96)*B * 7
+	{ { { { { 0x8B0BCCC7, 0xE16BBA3D, 0x44C9E28F, 0x29BE1EE4 } },
+	      { { 0x751536A3, 0x6E4A728A, 0x00888F7C, 0x08FD01F0 } } } },
+	  { { { { 0x6105457B, 0x3346C207, 0x67B0008B, 0x290BC8D9 } },
+	      { { 0x8C9C3D6E, 0xCC0E64B7, 0x2E01B797, 0x14197A7C } } } } },
+	// (2^96)*B * 8
+	{ { { { { 0xF4B109E4, 0x891B5765, 0x03AA5B0A, 0x4C341F78 } },
+	      { { 0xB329C9A0, 0x7DF0A0F3, 0x55940920, 0x6E637EAE } } } },
+	  { { { { 0x7624B8A0, 0x81C1B2EF, 0x54F22B55, 0x528F805E } },
+	      { { 0x7A0FFB48, 0x43A540E6, 0x07BE133F, 0x7A79D0B6 } } } } },
+	// (2^104)*B * 1
+	{ { { { { 0x5751128D, 0xF256B0FB, 0x36E58C5F, 0x0D270A57 } },
+	      { { 0x0EF38F50, 0x403767C6, 0xD9A75D1E, 0x657E1565 } } } },
+	  { { { { 0x4E1B4B26, 0x17481570, 0x79B2582A, 0x30D58050 } },
+	      { { 0x938EB3D9, 0x89B9F17B, 0xF63B2A36, 0x78293A94 } } } } },
+	// (2^104)*B * 2
+	{ { { { { 0xB6098C3E, 0x1209D71A, 0x3FA206A9, 0x7221FAFD } },
+	      { { 0xC3FADC4C, 0x7DAD2F83, 0x1C4E0568, 0x77B85260 } } } },
+	  { { { { 0x90F92C65, 0xBC4ACAB0, 0xE22CD01E, 0x5085D1EC } },
+	      { { 0x5C6A2DA7, 0xC36F72A3, 0xCB9FFDBD, 0x2EC76262 } } } } },
+	// (2^104)*B * 3
+	{ { { { { 0xDEA9FE0F, 0xEE06A1A9, 0xCF950823, 0x658ADD27 } },
+	      { { 0xD63FE0BA, 0x3E059205, 0xAD9066E3, 0x27BC5D60 } } } },
+	  { { { { 0x39AB432B, 0x7682CDC2, 0x0848545F, 0x55EC2537 } },
+	      { { 0xE87E488D, 0xF1BF936E, 0xEFE71C73, 0x09F3CB36 } } } } },
+	// (2^104)*B * 4
+	{ { { { { 0x59872354, 0xC76BD640, 0x3B654C40, 0x7A20EE15 } },
+	      { { 0x4FCD2763, 0x1E9FF6DA, 0xB7E124CA, 0x42D214BD } } } },
+	  { { { { 0xAB408E59, 0x67C87788, 0xAAC2F3FB, 0x1E793F23 } },
+	      { { 0xF8E2FEFD, 0x1093116D, 0xB9BBC5F0, 0x76A26EB4 } } } } },
+	// (2^104)*B * 5
+	{ { { { { 0x6A716D02, 0xF17339A1, 0x74AC1A81, 0x6C6DFB6D } },
+	      { { 0x4FA08317, 0xCFC4F7E9, 0xCE20D4A7, 0x7C9589BD } } } },
+	  { { { { 0x16EA55F4, 0x44A69FAC, 0xBE49FB25, 0x6160A833 } },
+	      { { 0x69C04152, 0xE78B185D, 0x0F7D292E, 0x2E255A78 } } } } },
+	// (2^104)*B * 6
+	{ { { { { 0x8C39EC9D, 0x8D5C9D2E, 0xF7293971, 0x7BDA7EB0 } },
+	      { { 0x347C0A95, 0xFF6367B1, 0x6C154CE4, 0x1362C33C } } } },
+	  { { { { 0x31A0AA87, 0x95DA3499, 0x01A29AF9, 0x35373839 } },
+	      { { 0x99545056, 0x9C939B49, 0xBF1953CF, 0x5B9E374A } } } } },
+	// (2^104)*B * 7
+	{ { { { { 0x40C0E471, 0x97A9BBC0, 0x5D0E8CB9, 0x42AA0EE6 } },
+	      { { 0x756EC260, 0x4B882606, 0x3D3A7B40, 0x04A789E1 } } } },
+	  { { { { 0x08CF50B9, 0xE8C4DF92, 0x0A042709, 0x2C180284 } },
+	      { { 0x239699A8, 0x78B3B6C3, 0xEF3A5CCA, 0x591094A9 } } } } },
+	// (2^104)*B * 8
+	{ { { { { 0x5D14248D, 0x2DC37A61, 0xDA1306E0, 0x0EE30CBB } },
+	      { { 0xF4A2B807, 0x260FD09A, 0x3330AE6A, 0x4C619B79 } } } },
+	  { { { { 0x1BBFE847, 0x39597A90, 0x9844AC39, 0x59D2C588 } },
+	      { { 0x80EF4955, 0x133024D3, 0x313656BD, 0x76EA18BF } } } } },
+	// (2^112)*B * 1
+	{ { { { { 0xD66BA56A, 0xC1F4C633, 0x32533CB0, 0x7D9B1E41 } },
+	      { { 0x7A815900, 0xA8F063FC, 0x90C430AB, 0x2AE42303 } } } },
+	  { { { { 0x418C5E31, 0x9C88AFA1, 0x61408152, 0x7C5EAC42 } },
+	      { { 0x9A33D05D, 0xB59EEFF3, 0x36288A15, 0x2A922A97 } } } } },
+	// (2^112)*B * 2
+	{ { { { { 0xB8DB9C6D, 0x931C8419, 0xD2EF0F7E, 0x4A5AC93A } },
+	      { { 0xD9AEF481, 0xB9E9521C, 0xA16E3943, 0x09666931 } } } },
+	  { { { { 0xBC4DABF3, 0x278865AF, 0x6999A78A, 0x60C0EF4C } },
+	      { { 0x67A2D56F, 0x4C0D0DAC, 0xD04AF633, 0x0A00AB0C } } } } },
+	// (2^112)*B * 3
+	{ { { { { 0xB8EEFD6F, 0xDDDFC57C, 0xABC65840, 0x49A078F7 } },
+	      { { 0x9A0F9FB0, 0xA1F8ED39, 0x1F17E1B4, 0x02AC378C } } } },
+	  { { { { 0x24069D94, 0x18AFB5E3, 0x8D7C904F, 0x419ABF98 } },
+	      { { 0x56779F66, 0x8918CAA7, 0xFF58D5FC, 0x3082A874 } } } } },
+	// (2^112)*B * 4
+	{ { { { { 0x8983088E, 0x66788093, 0x81DEDA98, 0x120E42C2 } },
+	      { { 0xC3F75791, 0x89B9BDB3, 0x7CF831FE, 0x4FD7CC58 } } } },
+	  { { { { 0xEB6DFEF1, 0x14E7BF07, 0x8837D49E, 0x51654F7E } },
+	      { { 0x160EF58E, 0xFE34DDFA, 0x4B6E4E9E, 0x0FA0A648 } } } } },
+	// (2^112)*B * 5
+	{ { { { { 0xE56B95E0, 0x9F07368D, 0x5692A8FD, 0x5F3BF106 } },
+	      { { 0x7E35A689, 0x8B98E41E, 0x49CB6756, 0x221B29D9 } } } },
+	  { { { { 0x49E44F7D, 0x22E6C2AD, 0xF9256E10, 0x48E6BCAC } },
+	      { { 0xA7AE3CB9, 0x167749EE, 0xA8452C87, 0x20307DAC } } } } },
+	// (2^112)*B * 6
+	{ { { { { 0x314930A8, 0xA729913B, 0x2D9351C1, 0x09818428 } },
+	      { { 0xB38B95A1, 0x8E4EE183, 0x89DD53C4, 0x09325D13 } } } },
+	  { { { { 0x45BC16A0, 0x0921260C, 0xCC6F38C8, 0x2FAC10BC } },
+	      { { 0xE27A51BE, 0xE0021878, 0xEC80E8A2, 0x2329C0C1 } } } } },
+	// (2^112)*B * 7
+	{ { { { { 0x2C64FE7D, 0x8CB11D82, 0x437DB362, 0x5C7396E2 } },
+	      { { 0x4C582F34, 0x901EA0EF, 0x53FD55DB, 0x30FFA58F } } } },
+	  { { { { 0x55536293, 0x7814C638, 0x378CBC90, 0x46F5D442 } },
+	      { { 0x3917C055, 0xF06C8D81, 0x6ACE7778, 0x78369F1A } } } } },
+	// (2^112)*B * 8
+	{ { { { { 0xD241D1DA, 0xC1A67FDC, 0x1EBB2337, 0x4922C3E5 } },
+	      { { 0xBC8F3100, 0x586723B1, 0xE06B02BD, 0x338E8FEE } } } },
+	  { { { { 0x8E962BC6, 0x7CEB5378, 0xE5BC30BA, 0x5A84135F } },
+	      { { 0x5DB09F90, 0x0DDC2083, 0x366F4DB8, 0x21324171 } } } } },
+	// (2^120)*B * 1
+	{ { { { { 0x98C17BB5, 0x499F2633, 0xD3E18598, 0x7C7C0298 } },
+	      { { 0x0674C6A6, 0x8BB70B90, 0x428D6117, 0x6D1F2DE1 } } } },
+	  { { { { 0xA527F66C, 0x07A87FCC, 0x78BFC8C7, 0x2135E07B } },
+	      { { 0x8E9F71D7, 0x0D8847A9, 0xD8DC2D79, 0x660940FA } } } } },
+	// (2^120)*B * 2
+	{ { { { { 0x09F68D29, 0x343524BD, 0x47B87035, 0x1FE841B5 } },
+	      { { 0xFC8B22BE, 0x45C225BE, 0x4F067580, 0x5731E267 } } } },
+	  { { { { 0x33433E77, 0x28937212, 0xC87E04EC, 0x7AA2C439 } },
+	      { { 0xDC97A8A1, 0x4DE0C4FB, 0x4F507708, 0x60E6B9D7 } } } } },
+	// (2^120)*B * 3
+	{ { { { { 0xD9BF2909, 0x6DB1F987, 0x813E8F50, 0x59016D48 } },
+	      { { 0xD9BB8DDD, 0x2254199E, 0xCAE363C2, 0x52F0FD1F } } } },
+	  { { { { 0xE1B80A37, 0xC156EE45, 0x905B399A, 0x7275341F } },
+	      { { 0x95E2773E, 0x90E19F15, 0x02910DFC, 0x32206996 } } } } },
+	// (2^120)*B * 4
+	{ { { { { 0x9D76EB27, 0x11E48E65, 0x956D925A, 0x111216D5 } },
+	      { { 0x8E219A9B, 0x99D18C7F, 0x1B66783A, 0x211436FD } } } },
+	  { { { { 0x48549B22, 0x37D6463F, 0xDF439ECB, 0x13B3E846 } },
+	      { { 0x044408BA, 0x23643B5D, 0x073A151C, 0x396803F2 } } } } },
+	// (2^120)*B * 5
+	{ { { { { 0xC96C07F3, 0x8D713102, 0x5C6AD7DA, 0x4A2E7AE1 } },
+	      { { 0x197E0351, 0x33AE40B1, 0xD38EB5FE, 0x1AC5AC1E } } } },
+	  { { { { 0xEC633DDA, 0xF73AECB0, 0x22634783, 0x64731652 } },
+	      { { 0x133EDE87, 0x03AF74B5, 0x1D0126DA, 0x5E9FBC7C } } } } },
+	// (2^120)*B * 6
+	{ { { { { 0xEC1E2702, 0x97365172, 0x4F90CD81, 0x5C930B87 } },
+	      { { 0x9E6DBBE0, 0xD9ED2161, 0x550A1A1C, 0x7CE20FE2 } } } },
+	  { { { { 0x5C874B8D, 0xBFF5A7C4, 0xA212C253, 0x1FC0A246 } },
+	      { { 0x3266561E, 0x4BA07D8C, 0xD5308C86, 0x49F93F91 } } } } },
+	// (2^120)*B * 7
+	{ { { { { 0x7F4F2F86, 0x48D0112A, 0xFF2B7ABC, 0x044AE796 } },
+	      { { 0x6556D3C7, 0x05CEA3D7, 0xE3304289, 0x462CB99D } } } },
+	  { { { { 0x753357EE, 0xFAC0A869, 0x3F7CB20F, 0x1C71750E } },
+	      { { 0x18253489, 0xC3D01D8C, 0x636AF2B6, 0x731E9E2F } } } } },
+	// (2^120)*B * 8
+	{ { { { { 0x9868658F, 0x2911FD68, 0xC3138C98, 0x336CCB57 } },
+	      { { 0xC5E26776, 0xB5AD27AD, 0x17255669, 0x68D2B76B } } } },
+	  { { { { 0xAFF81F68, 0xAFB5F906, 0xD78EC7B2, 0x4595701E } },
+	      { { 0xB0C34528, 0xD4E54EA8, 0x8996527A, 0x7105AADC } } } } },
+#elif GLS254_MULGEN_TABLES == 32
+	// B * 1
+	{ { { { { 0x326B8675, 0xB6412F20, 0x9AE29894, 0x657CB9F7 } },
+	      { { 0xF66DD010, 0x3932450F, 0xB2E3915E, 0x14C6F62C } } } },
+	  { { { { 0x023DC896, 0x5FADCA04, 0xA04300F1, 0x763522AD } },
+	      { { 0x9E07345A, 0x206E4C1E, 0x2381CA6D, 0x4F69A66A } } } } },
+	// B * 2
+	{ { { { { 0xD693FA8F, 0x415A7930, 0xDF2F1CA6, 0x1D78874E } },
+	      { { 0xDAE036F7, 0xF61DEA7C, 0xE5F279EA, 0x4B30C0F5 } } } },
+	  { { { { 0xFBD6BE01, 0xC19ED043, 0x6ABE9465, 0x693D8F2F } },
+	      { { 0xD452AB50, 0x0F2F0D9C, 0x0A6EE21C, 0x19720E49 } } } } },
+	// B * 3
+	{ { { { { 0x1889FE19, 0x0BC57355, 0x1393238B, 0x665C451B } },
+	      { { 0x27CA6F4D, 0xE053B1D0, 0x34043EA7, 0x5C27A07D } } } },
+	  { { { { 0xA1F56BB6, 0xFE1E7723, 0x7D15931D, 0x7B780510 } },
+	      { { 0xE184E5DF, 0xAE7D87EF, 0xF11925D5, 0x0F6F5F4E } } } } },
+	// B * 4
+	{ { { { { 0x06C9A0C8, 0xA11DB5F2, 0xC72A3AB3, 0x061309D0 } },
+	      { { 0xEED4F57B, 0x91999BBE, 0xC3C0D1DA, 0x77F10DBD } } } },
+	  { { { { 0x812A13C2, 0x38EE9EC6, 0x9DCA6BB5, 0x77FBC24A } },
+	      { { 0xC034074B, 0x181DB8C3, 0xA8E44BBD, 0x6D296D30 } } } } },
+	// B * 5
+	{ { { { { 0xCF1FAB5F, 0xC715B038, 0x610AD947, 0x0DA235C1 } },
+	      { { 0x7E52B936, 0xD3AC0FF5, 0x42EA1434, 0x7094DAC3 } } } },
+	  { { { { 0x32462848, 0x06A589BB, 0x1566BBAF, 0x0F876725 } },
+	      { { 0x17C2DAAB, 0x9F808AC9, 0x55FE4D2C, 0x32B14A68 } } } } },
+	// B * 6
+	{ { { { { 0x2FEA71F8, 0xB210B545, 0x921194F5, 0x14D11ED1 } },
+	      { { 0x4E3E4518, 0x476FF44B, 0x007A5A24, 0x6F68AAC2 } } } },
+	  { { { { 0x43C891FA, 0x57BE3BF0, 0x548C5D6C, 0x4F28EEAF } },
+	      { { 0xE898732D, 0x72895485, 0xB3EB369B, 0x5683B98C } } } } },
+	// B * 7
+	{ { { { { 0xA16EAC69, 0x1F6121CE, 0xBC02778C, 0x19EB28FD } },
+	      { { 0xB2803207, 0x0E86728B, 0xD9893789, 0x03E9B9FC } } } },
+	  { { { { 0x7604ABE1, 0x13DE2DAE, 0xA6611933, 0x5121D6B7 } },
+	      { { 0x9644C754, 0xAFC835F3, 0xE19E6CB3, 0x0A1F6E2D } } } } },
+	// B * 8
+	{ { { { { 0xF80BD001, 0xCDCB2821, 0xC02477B7, 0x4D1FCC11 } },
+	      { { 0x237C442C, 0x2A6A17AF, 0xD4D6114C, 0x1301DB82 } } } },
+	  { { { { 0x44C7077A, 0x83CF1AA2, 0xBC942DCB, 0x327AC316 } },
+	      { { 0x8D0BBFA4, 0xAA4C2E84, 0x2A0788B2, 0x235DF1F9 } } } } },
+	// (2^4)*B * 1
+	{ { { { { 0x542502B7, 0xB7DB2F25, 0x4A5A33BA, 0x7FA2C641 } },
+	      { { 0xA653DD5F, 0x94A863D4, 0x221F8FD2, 0x7B4E3179 } } } },
+	  { { { { 0x3787F6B7, 0xAF32E1F8, 0x5AE7A619, 0x0BFC7AE5 } },
+	      { { 0x9EE9B5CC, 0x733C0817, 0x9B0A6F2C, 0x48249E0F } } } } },
+	// (2^4)*B * 2
+	{ { { { { 0x0896162E, 0xD063E2DD, 0xF857EA3F, 0x43616222 } },
+	      { { 0x1B5DC9B7, 0x44A2369C, 0x82C996FA, 0x5CB3A591 } } } },
+	  { { { { 0x7BEC0718, 0xC0BF406F, 0x99CB7B08, 0x2EE79296 } },
+	      { { 0x0C2CA0E1, 0x0840C69D, 0xC865621C, 0x0DEF35D6 } } } } },
+	// (2^4)*B * 3
+	{ { { { { 0x87D07DF6, 0xAEA6C8BC, 0x7FF89C8D, 0x1AEBF336 } },
+	      { { 0x00721A19, 0x01607BC3, 0xCF161092, 0x10C72D98 } } } },
+	  { { { { 0x383352FF, 0x6AF5B861, 0x0C53955A, 0x3AEBC98E } },
+	      { { 0xAD02082D, 0x60C2D5F2, 0x153121A4, 0x6A21DA46 } } } } },
+	// (2^4)*B * 4
+	{ { { { { 0x847E4452, 0x9FDC8742, 0xAF5094CB, 0x116A5D13 } },
+	      { { 0x6349DFBB, 0xBDD2C498, 0x02D10184, 0x47026014 } } } },
+	  { { { { 0x994E99B8, 0x783319C1, 0x0952C18A, 0x16F5134B } },
+	      { { 0x487D6A0A, 0x4D447FE9, 0xBB131E44, 0x789BBF64 } } } } },
+	// (2^4)*B * 5
+	{ { { { { 0x74D4FC6F, 0xEFA440D7, 0x477C7386, 0x1FEB4BF2 } },
+	      { { 0x9E03F5BA, 0x78D9440D, 0xC24CE929, 0x6C0FBC60 } } } },
+	  { { { { 0x527BC577, 0x3076EA8B, 0xB616D1D8, 0x51EAABCD } },
+	      { { 0x178C9D4F, 0xDD77D901, 0x3B8D8FB9, 0x0A073C41 } } } } },
+	// (2^4)*B * 6
+	{ { { { { 0x58DBFE5B, 0x04F3F5F4, 0x8F6BCA8B, 0x48508CF3 } },
+	      { { 0xAFCA6EA3, 0x1F19B3EB, 0x970B1E52, 0x79A27C59 } } } },
+	  { { { { 0x892BDF46, 0x8893CD1D, 0x0B0C3C8A, 0x65155B5E } },
+	      { { 0x40E66F24, 0x97A4E046, 0x24232581, 0x596906CB } } } } },
+	// (2^4)*B * 7
+	{ { { { { 0xEF268E68, 0xF7EB5948, 0xFDD57B0A, 0x65F332B4 } },
+	      { { 0xBA27967F, 0x6ECCDA42, 0x0C3F0F23, 0x74A70A91 } } } },
+	  { { { { 0x8689B19E, 0x785FA95D, 0x397CAE78, 0x619A0062 } },
+	      { { 0xD0CA14E1, 0x27134A7A, 0xB5096F86, 0x37CE4819 } } } } },
+	// (2^4)*B * 8
+	{ { { { { 0x79DD58B9, 0xEDF50C35, 0x989377DD, 0x297DB761 } },
+	      { { 0x0009E96A, 0xC20647E1, 0x0CE68D4D, 0x65BC6F85 } } } },
+	  { { { { 0x671EB45C, 0x0EB46774, 0x1041D50A, 0x4F57ED08 } },
+	      { { 0xD21336F1, 0x7E5F11E0, 0xC95301B9, 0x3E466E8F } } } } },
+	// (2^8)*B * 1
+	{ { { { { 0x6953A016, 0xB88E4005, 0xD2232083, 0x43C6EC23 } },
+	      { { 0xB6390D73, 0x7130F7CF, 0xD66B8688, 0x6FF555B5 } } } },
+	  { { { { 0xBACF5878, 0x54804FF8, 0x286472DF, 0x26BF6872 } },
+	      { { 0xA425F62A, 0x7D9D7BA0, 0x5B2DC304, 0x10017F16 } } } } },
+	// (2^8)*B * 2
+	{ { { { { 0xFF87F125, 0x52A4FE43, 0xA45C0B27, 0x66237AC8 } },
+	      { { 0x39946CF7, 0xD79B0362, 0x6DE58B5F, 0x2760FC7D } } } },
+	  { { { { 0xA98B9845, 0x28C080D5, 0x20A6AA23, 0x4E4C4AB4 } },
+	      { { 0xEE7867A0, 0xC0135113, 0xBA95E062, 0x48A5C489 } } } } },
+	// (2^8)*B * 3
+	{ { { { { 0xB955E645, 0xE98DE4CB, 0xE09AFE8C, 0x562613F0 } },
+	      { { 0xEFFBDF05, 0x7E7798C0, 0x9B9E32A2, 0x35B42FBA } } } },
+	  { { { { 0x3E9C1619, 0x8D927400, 0x2EF1D683, 0x7A48F929 } },
+	      { { 0xB5D563FD, 0xB064BAFD, 0xA59D35E2, 0x2B92B12B } } } } },
+	// (2^8)*B * 4
+	{ { { { { 0x8DDE1AA2, 0xCCB5397F, 0xD5F36CB6, 0x11017048 } },
+	      { { 0x260E0C2A, 0xBFD1A530, 0x68B9C414, 0x14145662 } } } },
+	  { { { { 0xF2A1DE94, 0xC3843766, 0x28E00569, 0x3F9836B4 } },
+	      { { 0x4EB29C21, 0x077D8592, 0xF6E1D9D5, 0x6079EC32 } } } } },
+	// (2^8)*B * 5
+	{ { { { { 0x4BBAE75B, 0x703D8343, 0x057C0743, 0x40AEF57D } },
+	      { { 0x95C2505B, 0x212BDAB1, 0x33A28F9C, 0x38D7319C } } } },
+	  { { { { 0xD1E65551, 0x6DCDD2FA, 0x447FB32E, 0x23357609 } },
+	      { { 0x0855FF0E, 0x758726CA, 0x1CD4DD96, 0x770BC2D3 } } } } },
+	// (2^8)*B * 6
+	{ { { { { 0x54B8D340, 0xE994DFC8, 0x5D489537, 0x2B46C955 } },
+	      { { 0x90F63A63, 0xAC6BB1F4, 0x7AE688C3, 0x55E98C5B } } } },
+	  { { { { 0xF59C23E9, 0x7DFF4405, 0x8D9AFA62, 0x4530367E } },
+	      { { 0xD8D9A92F, 0xBCA617E2, 0xFC2E6797, 0x0F21AD71 } } } } },
+	// (2^8)*B * 7
+	{ { { { { 0xCFFCE8E3, 0x01430A3B, 0xD0EE65C0, 0x48CEA748 } },
+	      { { 0x660F497D, 0xE0733F23, 0xA613BDC6, 0x7CBB6979 } } } },
+	  { { { { 0x04DAEBB3, 0x17179A3F, 0x04F4B380, 0x53B3A6BF } },
+	      { { 0x502DFD17, 0xEA07BEFD, 0x16F7195A, 0x0EB5908F } } } } },
+	// (2^8)*B * 8
+	{ { { { { 0x50632F2C, 0x61C2769C, 0x9501A8A8, 0x400763A6 } },
+	      { { 0xECD7CAE0, 0x6DD5EE37, 0x059E1A95, 0x64361800 } } } },
+	  { { { { 0x3F1DE8D4, 0xB31B0BBD, 0x76D5D25E, 0x7C80A27D } },
+	      { { 0xFAFFEF01, 0xFAD4105D, 0x063792CF, 0x299E0F6A } } } } },
+	// (2^12)*B * 1
+	{ { { { { 0xBB07BB45, 0xD0D4FF73, 0x085F922F, 0x2B74BA1A } },
+	      { { 0x6A3F7506, 0x27A146F4, 0xD18C1A06, 0x5600CF49 } } } },
+	  { { { { 0x4EDF39EB, 0x29EE51A8, 0xD814BE9E, 0x006414BC } },
+	      { { 0x58CF9AB5, 0x1DA37C2C, 0x6BA2F676, 0x107C6FB8 } } } } },
+	// (2^12)*B * 2
+	{ { { { { 0x769444B6, 0x32D8C302, 0x404D8556, 0x33BEBC16 } },
+	      { { 0x1409B451, 0xAA511347, 0x7037D6B9, 0x5ECD3031 } } } },
+	  { { { { 0x06F5B4F9, 0x564FE6FB, 0x5F6C2491, 0x25B4C860 } },
+	      { { 0xB3B3A2D8, 0xCD7C6A99, 0xED70C4F1, 0x4AB8EAA9 } } } } },
+	// (2^12)*B * 3
+	{ { { { { 0xA5E0B2BA, 0x862528D3, 0x972DA273, 0x79ADCA4A } },
+	      { { 0x33520C36, 0xA7BA3771, 0xAD37A4EB, 0x1C42B44C } } } },
+	  { { { { 0xF47C5B85, 0x87E32D7B, 0x702588F4, 0x015D75D4 } },
+	      { { 0xDEB532FB, 0xC2219231, 0xA4C6187C, 0x15F4D95D } } } } },
+	// (2^12)*B * 4
+	{ { { { { 0x1480125B, 0x6EC831E8, 0x6C125F9F, 0x0C091D23 } },
+	      { { 0xBB9AA992, 0x659DFF70, 0xF6A084F1, 0x079952CE } } } },
+	  { { { { 0x5324E8E1, 0xCA0804A4, 0x241FAB7E, 0x3756D950 } },
+	      { { 0x8FB27DC4, 0x5BCF412F, 0xA470304D, 0x552C4702 } } } } },
+	// (2^12)*B * 5
+	{ { { { { 0x2B0E941C, 0xECC21B7F, 0xD4074ECB, 0x3AAD96CD } },
+	      { { 0xFBA794A4, 0xAC2CCC2F, 0xD8955211, 0x3023AD45 } } } },
+	  { { { { 0x8AB7BCFE, 0x975D1A5A, 0x9A437DFA, 0x736555F6 } },
+	      { { 0x57341D15, 0xD7933ED4, 0x5D98D905, 0x734D98F4 } } } } },
+	// (2^12)*B * 6
+	{ { { { { 0xDA15C61D, 0xCBE2394D, 0xE5E37FFB, 0x1E70B99C } },
+	      { { 0xD33C7B9E, 0x54CBBC09, 0x711823B0, 0x361FD862 } } } },
+	  { { { { 0x0DC6EB47, 0x5A5F56EF, 0x68BB42BF, 0x52FA19E2 } },
+	      { { 0x885C8CE2, 0x86B2D5C6, 0x3FAA28D3, 0x275A96EB } } } } },
+	// (2^12)*B * 7
+	{ { { { { 0xCE4FD442, 0x4862AA59, 0xDE0E05A2, 0x373F88AD } },
+	      { { 0x8645B96B, 0x6B6E13E1, 0xA3D96982, 0x2FF4BB51 } } } },
+	  { { { { 0x6D352851, 0x628288BB, 0x0B53748C, 0x136C7FB6 } },
+	      { { 0xE677E931, 0xCBB5A86C, 0x0ADCCDA2, 0x529CD26F } } } } },
+	// (2^12)*B * 8
+	{ { { { { 0x18857951, 0x1CF7EC02, 0x1AF65098, 0x61539960 } },
+	      { { 0xA6AE3A3C, 0xC1F1C80E, 0x86B71356, 0x094CCBA5 } } } },
+	  { { { { 0x6FBDA203, 0xB2641EA1, 0x9AC6622E, 0x62A2225F } },
+	      { { 0xE5F8DDFB, 0xFE1DE3B2, 0x9A0CB521, 0x5FBE8F9D } } } } },
+	// (2^16)*B * 1
+	{ { { { { 0x5603B9BF, 0xBB5FBF2F, 0x98B576B4, 0x4116A532 } },
+	      { { 0x2B5C4B00, 0x151A4CBB, 0x19F67653, 0x65FD95A1 } } } },
+	  { { { { 0x8588F5A0, 0x1E4D4153, 0xBFFBAFE0, 0x1697B728 } },
+	      { { 0xEDBFA37E, 0x7D8DD3DB, 0x5A7EA4CE, 0x17E9C5DE } } } } },
+	// (2^16)*B * 2
+	{ { { { { 0x316A1FE5, 0xEDC20D38, 0x1D7C64EF, 0x595F5371 } },
+	      { { 0x01B258D5, 0x6FC95B1B, 0x4C38D3D2, 0x173847B4 } } } },
+	  { { { { 0x66A97939, 0x797A38EC, 0xAB628228, 0x7B09419A } },
+	      { { 0x199028FB, 0xF5121543, 0xB35928B9, 0x147C6217 } } } } },
+	// (2^16)*B * 3
+	{ { { { { 0x62D75E04, 0x79903D39, 0x16C9A092, 0x22CE4276 } },
+	      { { 0xE844BC78, 0x3526ED89, 0xD5E30BF4, 0x19F5ECEB } } } },
+	  { { { { 0x650A795E, 0x5E4C510E, 0x6145497F, 0x7620ED2A } },
+	      { { 0x7FFA8242, 0x3ED9F0CE, 0x3D2AD607, 0x6F532914 } } } } },
+	// (2^16)*B * 4
+	{ { { { { 0xD464A400, 0xFFD584D5, 0x2C24699F, 0x05DBD05C } },
+	      { { 0xC3075493, 0x2D270E5D, 0xC0B4F6DA, 0x3378365C } } } },
+	  { { { { 0x840E8BA4, 0xEA43590A, 0x123EF605, 0x6764FEEF } },
+	      { { 0x9663D2F6, 0x99B02919, 0xF2838856, 0x4CAC6706 } } } } },
+	// (2^16)*B * 5
+	{ { { { { 0x489FBA63, 0xBC673A32, 0x6357ABE4, 0x043A2500 } },
+	      { { 0xDFC01C42, 0x22499F73, 0xA879C25F, 0x1D5D2409 } } } },
+	  { { { { 0x00E9ACB3, 0xE7A4E5B4, 0xC776ABEC, 0x79326BFA } },
+	      { { 0x3BE08F4F, 0x731C33D2, 0x307A172D, 0x7463FA2F } } } } },
+	// (2^16)*B * 6
+	{ { { { { 0x0E4C1365, 0x30125CEE, 0x01BA0CCD, 0x506449C8 } },
+	      { { 0xADDF20DF, 0x2111819E, 0x40FCD6E3, 0x16DDD39C } } } },
+	  { { { { 0x60A9B5D4, 0x2F40CBCE, 0x9AA2C074, 0x3C5EE79B } },
+	      { { 0x2F706D29, 0xC44E87AF, 0x33D996E4, 0x4D13143D } } } } },
+	// (2^16)*B * 7
+	{ { { { { 0x85EF0180, 0x9B65ECE6, 0x940B104D, 0x49B98D5B } },
+	      { { 0x25FD1B43, 0x55676A13, 0x66258A97, 0x14D2B13A } } } },
+	  { { { { 0xB4971DB9, 0x9295DAE3, 0x38BD98F3, 0x1228F6F9 } },
+	      { { 0x6E5580B5, 0x98F7656B, 0x10CD0138, 0x79EB218D } } } } },
+	// (2^16)*B * 8
+	{ { { { { 0x28DFBBF3, 0xDC55A228, 0x0216C316, 0x42758EC7 } },
+	      { { 0x03EBB993, 0xB1D5008C, 0x8B02959D, 0x5DA6A610 } } } },
+	  { { { { 0x32AF273B, 0x22653BF6, 0x7863B996, 0x297725D5 } },
+	      { { 0x3CF58605, 0x4A3B79EF, 0x55FDF51E, 0x24DBA95D } } } } },
+	// (2^20)*B * 1
+	{ { { { { 0x34CBA015, 0xCB5A01F7, 0xE577D870, 0x54FC43DF } },
+	      { { 0x5A8E9543, 0x541670DD, 0x8B3D333F, 0x00EDC271 } } } },
+	  { { { { 0x47B438E9, 0xD04BF8E7, 0x7032369B, 0x22421860 } },
+	      { { 0xE5A5ED56, 0x6305B273, 0xD9372F68, 0x723E821F } } } } },
+	// (2^20)*B * 2
+	{ { { { { 0x906929FF, 0x558DB231, 0xBF37D99D, 0x10CDE4C9 } },
+	      { { 0x932755E8, 0x37632EEE, 0x6C0268BF, 0x5D3AFCAB } } } },
+	  { { { { 0x9AC3107D, 0xCA3F9FAA, 0xE171FD74, 0x4827918F } },
+	      { { 0x7F619833, 0x4514A6FA, 0xD8237085, 0x6153A4FB } } } } },
+	// (2^20)*B * 3
+	{ { { { { 0xF957909D, 0xE09BADD8, 0xA88F692F, 0x304281B1 } },
+	      { { 0x0DA33A68, 0x9BC426AB, 0xB27F1AAC, 0x5F605262 } } } },
+	  { { { { 0x3C1E0587, 0x792FEDB1, 0xF1D0F53B, 0x688EB4B4 } },
+	      { { 0xC02BBC76, 0x5834F60D, 0x40B4BC0F, 0x315D85EF } } } } },
+	// (2^20)*B * 4
+	{ { { { { 0x34DD1744, 0x23C56C6C, 0xB2B1F0A2, 0x0DF2328E } },
+	      { { 0x9D970F93, 0x556418D1, 0x331C87D8, 0x5ECD6B35 } } } },
+	  { { { { 0xDF2CDD5B, 0xCC97300E, 0x85CD1C88, 0x0CE47072 } },
+	      { { 0x8F745B86, 0x4F6F3960, 0xE94BD941, 0x7E273900 } } } } },
+	// (2^20)*B * 5
+	{ { { { { 0x412DFF22, 0x53F416DB, 0x8A220DDC, 0x4EFF0A8D } },
+	      { { 0x639D03C5, 0xDE1F523B, 0x973973AA, 0x3227CBB6 } } } },
+	  { { { { 0xB1F7A217, 0xF6D6826C, 0x2B883BF0, 0x38473024 } },
+	      { { 0x5080B901, 0x988C60DC, 0xC8FEA9D3, 0x4B7BB2E8 } } } } },
+	// (2^20)*B * 6
+	{ { { { { 0x412A3A4B, 0xC40184CB, 0x3BDFBD85, 0x5DB4E1C0 } },
+	      { { 0xACF0682A, 0x8C390B34, 0x64E74263, 0x1E1D6BEA } } } },
+	  { { { { 0x0B36F317, 0x7F91C6D9, 0x0E183C84, 0x018D0755 } },
+	      { { 0x2CCFBF6B, 0xB9762F0F, 0xA25C3CC4, 0x66A20B76 } } } } },
+	// (2^20)*B * 7
+	{ { { { { 0x6A819661, 0xE02631EE, 0x19640B5B, 0x654AB0C8 } },
+	      { { 0xDD6FB56B, 0x724CE787, 0x40469147, 0x3B290092 } } } },
+	  { { { { 0x2B360F07, 0x73830FA7, 0x9AD970A8, 0x4A3D3C98 } },
+	      { { 0x7340B688, 0x9DE9B356, 0x0A76D13F, 0x218AE7E3 } } } } },
+	// (2^20)*B * 8
+	{ { { { { 0x440631F8, 0xCD27D8B1, 0x47F60E65, 0x51B5C38D } },
+	      { { 0x4CBB006F, 0x0E747395, 0xB1DA0528, 0x4C9AB69B } } } },
+	  { { { { 0xB51972DD, 0x8EC31E77, 0x65088442, 0x48675D18 } },
+	      { { 0xE7473A3B, 0x461FEA28, 0x59B3B747, 0x110CD4AA } } } } },
+	// (2^24)*B * 1
+	{ { { { { 0x9C0C4E5F, 0xCA49E7C9, 0x75237779, 0x028BFE50 } },
+	      { { 0x45764454, 0x00795FC4, 0x508B2CEF, 0x4C21F485 } } } },
+	  { { { { 0x90F91C1D, 0x615A0EBB, 0x77756434, 0x1C3FF3C3 } },
+	      { { 0x1B4BA454, 0x2B9A39B2, 0xF766F4D0, 0x787F9682 } } } } },
+	// (2^24)*B * 2
+	{ { { { { 0x9389B8BE, 0x34134588, 0x8685FC25, 0x4BD8E04E } },
+	      { { 0x29E7DBE2, 0xB20A6247, 0x0F120AD1, 0x3DC5F5ED } } } },
+	  { { { { 0x3C40213C, 0xE88EF81E, 0x0F559C20, 0x1D614460 } },
+	      { { 0x21ABA386, 0xA71FEE8B, 0xBDE605CB, 0x09DA1923 } } } } },
+	// (2^24)*B * 3
+	{ { { { { 0xFA670F19, 0xBFFBE89E, 0x12ED7341, 0x4B5AF012 } },
+	      { { 0x938C8053, 0x5CD21BDD, 0xCD098026, 0x6C43C877 } } } },
+	  { { { { 0x020F0D5C, 0x21183145, 0xE5215464, 0x21825669 } },
+	      { { 0x729791FE, 0xB88D758C, 0x49205236, 0x763560E2 } } } } },
+	// (2^24)*B * 4
+	{ { { { { 0x037C7FCA, 0x94BD10E3, 0xD9CEF811, 0x656298EF } },
+	      { { 0xD7F43679, 0xF692F72B, 0x7139A07D, 0x6D56B9D3 } } } },
+	  { { { { 0x024D0D40, 0x295C9EA9, 0xD6F0CB79, 0x0DAA9646 } },
+	      { { 0x11DB6045, 0x0F0BBC20, 0xCEBA94CE, 0x0C7C0B6A } } } } },
+	// (2^24)*B * 5
+	{ { { { { 0xB295AFC6, 0x9A85183C, 0x371C8094, 0x66EE8407 } },
+	      { { 0x1E75BB2B, 0x5FEC9B1D, 0xE573A31B, 0x19179478 } } } },
+	  { { { { 0x459F9520, 0x38BFA8DB, 0xCE4D3A65, 0x784A537D } },
+	      { { 0x517EE5C5, 0x158B2135, 0xA3047383, 0x2D807A19 } } } } },
+	// (2^24)*B * 6
+	{ { { { { 0xAA6340B3, 0x129E3609, 0x2F65E9DB, 0x0FEFC186 } },
+	      { { 0xBDBDF97C, 0x61F15BB3, 0x20F5BD0E, 0x7AA153A0 } } } },
+	  { { { { 0xB5C8CFD9, 0x8C58679F, 0xCAF35DB9, 0x343B18EA } },
+	      { { 0x3F652AFB, 0x326B0CFA, 0x767A141F, 0x71176994 } } } } },
+	// (2^24)*B * 7
+	{ { { { { 0x90A4BD9B, 0x7B001336, 0x88C0BDE7, 0x7B1D05AF } },
+	      { { 0x65420BC7, 0x8007B2F2, 0x9B162CFA, 0x39F1521A } } } },
+	  { { { { 0xFD80C443, 0x59BCCC03, 0x2CDF68C2, 0x0477293F } },
+	      { { 0xF37FBD3F, 0x59DAB929, 0xD891392F, 0x12D43753 } } } } },
+	// (2^24)*B * 8
+	{ { { { { 0xAE935B30, 0x77E9C3C7, 0x4036CF04, 0x6DFEE1E9 } },
+	      { { 0x8E1F6B72, 0xDD55FC93, 0x83EB6FF4, 0x0F6C018F } } } },
+	  { { { { 0x452E0A89, 0x6BF9B617, 0xE79F8BBE, 0x2F6EEB42 } },
+	      { { 0x528346EB, 0x30233678, 0x5AD5F2F4, 0x704CFF32 } } } } },
+	// (2^28)*B * 1
+	{ { { { { 0x79EE65FC, 0xC2F89820, 0xCB92F9FC, 0x79E6B0D8 } },
+	      { { 0xABF7A64C, 0x795770CD, 0xD55DFD28, 0x78E88C0B } } } },
+	  { { { { 0x3B8212E1, 0xB8EB068D, 0xE2E7E748, 0x7ED61FE3 } },
+	      { { 0x4BD295BE, 0x4063BE4C, 0xF1C36466, 0x4AE5C614 } } } } },
+	// (2^28)*B * 2
+	{ { { { { 0x5CFF0045, 0x8FDD64F5, 0x6C19DCF3, 0x1F0358F3 } },
+	      { { 0x8C445A45, 0x69661260, 0xC9BA2F5D, 0x1302495A } } } },
+	  { { { { 0x383CF853, 0xF3134595, 0x7F81E8F8, 0x5654569B } },
+	      { { 0xDBDF4CE7, 0xD661EFA8, 0x025F096D, 0x73FF9455 } } } } },
+	// (2^28)*B * 3
+	{ { { { { 0x0A47F0BD, 0xB955DAF5, 0xBB20D234, 0x74921F8D } },
+	      { { 0x81F87876, 0x68E4B329, 0x6842933F, 0x25217020 } } } },
+	  { { { { 0xDB9CF2A0, 0x4ED2D24E, 0x101E7951, 0x76FB6738 } },
+	      { { 0x65BC04CD, 0x6E32BD58, 0x9255000D, 0x23861979 } } } } },
+	// (2^28)*B * 4
+	{ { { { { 0x0A13763D, 0x7A56D221, 0x5D47C05A, 0x1E542B0E } },
+	      { { 0x73A50D88, 0x3168E885, 0x3FEE0180, 0x62F6BCC4 } } } },
+	  { { { { 0x5801B50C, 0xC444141E, 0x88014C52, 0x780B51CC } },
+	      { { 0x593032C9, 0xA4AAC5E3, 0x6796915C, 0x6060B45F } } } } },
+	// (2^28)*B * 5
+	{ { { { { 0x2AB81E47, 0x52724BF5, 0x7A837B5A, 0x02A971B2 } },
+	      { { 0xDFCE7818, 0xE9C0A70E, 0x2AA481A1, 0x0358E48E } } } },
+	  { { { { 0xC0B8806B, 0x63935854, 0xAE08ACE5, 0x5468A040 } },
+	      { { 0x2042DFF9, 0xC676FB7C, 0x4575997E, 0x60BFF52C } } } } },
+	// (2^28)*B * 6
+	{ { { { { 0x8742F641, 0xC11CF473, 0xC1F35463, 0x78CAAB0E } },
+	      { { 0x5F3F8CBD, 0x2D6E3769, 0x0C1CFFC3, 0x0894BB3D } } } },
+	  { { { { 0xDF8E24AE, 0x89A21201, 0xC84F5BC1, 0x492E1925 } },
+	      { { 0x23F7A27A, 0xA1D677A7, 0x94FCE915, 0x771BAE3C } } } } },
+	// (2^28)*B * 7
+	{ { { { { 0x78EC056B, 0x48D2D6D9, 0x2C299148, 0x6663C55D } },
+	      { { 0xF2A220DF, 0x2BE81244, 0x4F60845A, 0x3B8F5DD5 } } } },
+	  { { { { 0x3AD72AE9, 0xDBB8CD88, 0xC321FED8, 0x01E218A3 } },
+	      { { 0xBBB1FFC5, 0xA825D997, 0x4AFA5DE3, 0x47362336 } } } } },
+	// (2^28)*B * 8
+	{ { { { { 0x361C5516, 0xED7F66A6, 0xD69B0740, 0x69DEF675 } },
+	      { { 0x69C20D5E, 0x682F4F30, 0x3185576E, 0x79A3F98A } } } },
+	  { { { { 0x2835C186, 0x283E6899, 0x0AB5CE8D, 0x162A3E63 } },
+	      { { 0x2FB10C29, 0x8037A08B, 0x8EC75716, 0x700F0643 } } } } },
+	// (2^32)*B * 1
+	{ { { { { 0x4DDB30B8, 0x63557581, 0x5030FA03, 0x5B61982B } },
+	      { { 0x22FC0A21, 0x11DFBA3C, 0x0F317C69, 0x59B8AAF2 } } } },
+	  { { { { 0x4BA656F7, 0x24CCD3E5, 0x8F12A690, 0x75E44943 } },
+	      { { 0x83593FAD, 0x35A7574A, 0xD281984B, 0x605B7617 } } } } },
+	// (2^32)*B * 2
+	{ { { { { 0x63E928F5, 0x90CF4E35, 0x5223D2E7, 0x50074E81 } },
+	      { { 0x354B113C, 0x5C404A45, 0xC8167241, 0x0FA6E6AE } } } },
+	  { { { { 0x6DA726AA, 0xA1301F5B, 0x36FADE6F, 0x417E796A } },
+	      { { 0xA030F951, 0x132B507C, 0x27837BD6, 0x1B059582 } } } } },
+	// (2^32)*B * 3
+	{ { { { { 0xBD1848ED, 0x3EB8194B, 0xA973E23F, 0x49233033 } },
+	      { { 0x9659B3C6, 0x162E3AC5, 0xCF1B0A47, 0x55D7E164 } } } },
+	  { { { { 0x50D0746F, 0x8408AE6F, 0xDA5B5D8C, 0x54B1EF88 } },
+	      { { 0xE0266218, 0xBEEF1BC0, 0x31BD68F4, 0x47AEBA16 } } } } },
+	// (2^32)*B * 4
+	{ { { { { 0xFEBCA318, 0xACDCDE13, 0x6F23CA1C, 0x2054A068 } },
+	      { { 0x9A944830, 0x4FC664CE, 0x5CC70929, 0x0EE62762 } } } },
+	  { { { { 0xF712C3D2, 0x10FFCF13, 0x378DADCF, 0x7AEF8651 } },
+	      { { 0x3A88BB41, 0x83BF078A, 0xED94CCB7, 0x6540AA59 } } } } },
+	// (2^32)*B * 5
+	{ { { { { 0x548A5B5C, 0xC3A9CDF7, 0x09251988, 0x7CC55823 } },
+	      { { 0x1D8FB1B6, 0x359CFD6F, 0xAEBB6DFE, 0x16617EA6 } } } },
+	  { { { { 0x3B570A8D, 0x5402D084, 0xDDCA45AF, 0x72E1B8FC } },
+	      { { 0x6A5F05AF, 0x8E894715, 0x4943A009, 0x47E972B5 } } } } },
+	// (2^32)*B * 6
+	{ { { { { 0x9D224CE8, 0x21ED4996, 0xF0314FFD, 0x502BF009 } },
+	      { { 0x29EDEB9F, 0x378AD19D, 0x0F08EA14, 0x217F953E } } } },
+	  { { { { 0x58AA005F, 0xFBEACAA8, 0xB084D2E9, 0x5C3956EA } },
+	      { { 0x9C0AF3DD, 0x02FFF925, 0x4DA7B8F3, 0x2E6C4558 } } } } },
+	// (2^32)*B * 7
+	{ { { { { 0xA435418E, 0xEFE3D1C9, 0x78B4B863, 0x29220A41 } },
+	      { { 0xAB5842A9, 0xF43A2709, 0x40A92711, 0x0C7C4F15 } } } },
+	  { { { { 0x7D638424, 0x1C6B7791, 0x16ED213B, 0x611353A7 } },
+	      { { 0x4BC271D7, 0x64291F07, 0x1D26E566, 0x65DD7EC4 } } } } },
+	// (2^32)*B * 8
+	{ { { { { 0xC194ECC9, 0x9B4DA61D, 0xCA8836CF, 0x7CB707BD } },
+	      { { 0xD4BFFDF2, 0x77ACDF95, 0xD3A61F80, 0x36586184 } } } },
+	  { { { { 0xC2CE8B3D, 0xCDAA62F1, 0x824B839B, 0x10B26E50 } },
+	      { { 0x667C1F45, 0xFC7E3B92, 0x267FACD9, 0x27F128AB } } } } },
+	// (2^36)*B * 1
+	{ { { { { 0xA0B88741, 0x54106C08, 0x813C0528, 0x4349B685 } },
+	      { { 0x72100463, 0xB0DBBEAE, 0x6EA72D98, 0x76A5993B } } } },
+	  { { { { 0x16A76C7B, 0x0C76434F, 0x93370108, 0x1C618BC7 } },
+	      { { 0x83BFB0FD, 0xCF0D78BC, 0x4E58944A, 0x40C58F5D } } } } },
+	// (2^36)*B * 2
+	{ { { { { 0xC68EC950, 0x128D54F3, 0xDEABB698, 0x4D3923FB } },
+	      { { 0xB055D84D, 0x8AAF3DDA, 0x2F939D87, 0x08930BB4 } } } },
+	  { { { { 0xD00EAD37, 0xA3365B50, 0x1BAB6649, 0x5CFCD8D8 } },
+	      { { 0x3F92731C, 0xEF6CB292, 0xFA5DF651, 0x6F103E07 } } } } },
+	// (2^36)*B * 3
+	{ { { { { 0xF272FDB1, 0xA988C2CA, 0x33CC0F45, 0x5264BC6E } },
+	      { { 0x75D5391C, 0x54BE5031, 0x72577171, 0x1267514F } } } },
+	  { { { { 0x9FA5483F, 0x95611837, 0x7BA9F5FC, 0x51048FCA } },
+	      { { 0xCD78993C, 0x342BFD77, 0x85936738, 0x62CC5C57 } } } } },
+	// (2^36)*B * 4
+	{ { { { { 0x6CFCF04B, 0x257D8E13, 0x97A65AD1, 0x07898341 } },
+	      { { 0x640FE345, 0x5F1AA4D5, 0x67A1C79D, 0x6A66AEF9 } } } },
+	  { { { { 0xC3AD91F5, 0x75DDEEB8, 0x80FD78EB, 0x0F6610CE } },
+	      { { 0xA734B0D5, 0xB6AED1CF, 0x9D55E9DE, 0x149AC420 } } } } },
+	// (2^36)*B * 5
+	{ { { { { 0xCB727BA0, 0x758B3758, 0xD246E654, 0x7671E4A8 } },
+	      { { 0xC14F657E, 0x69658D48, 0xB29B5795, 0x310759A8 } } } },
+	  { { { { 0x54DA1660, 0x7012CBD1, 0x9A1B44EE, 0x551B0874 } },
+	      { { 0xDEFBFFBF, 0x122DC7F8, 0x92DD2BE3, 0x0A31DA67 } } } } },
+	// (2^36)*B * 6
+	{ { { { { 0xF3B28566, 0x3F985E70, 0x66336363, 0x1F8560DA } },
+	      { { 0xF8DE9C32, 0xC41F7A48, 0x78CBD5FC, 0x085E8627 } } } },
+	  { { { { 0x147717E0, 0x1FC4502D, 0x2DAE5203, 0x410C0F60 } },
+	      { { 0xDEF71C7B, 0xAD452FFA, 0x4AAF1128, 0x17DA7DAC } } } } },
+	// (2^36)*B * 7
+	{ { { { { 0x3C4A202B, 0x96CFD053, 0x4B817841, 0x57184DE6 } },
+	      { { 0x67191843, 0x0ED16AF3, 0xB5F51BD3, 0x7CCF8C9E } } } },
+	  { { { { 0x662307F6, 0x8F62F788, 0x100AE8F5, 0x72BD8FBB } },
+	      { { 0xECBFD877, 0x9AB96D2C, 0xD120E3F8, 0x3DC21989 } } } } },
+	// (2^36)*B * 8
+	{ { { { { 0x5BABF5C8, 0x70C24FCB, 0x02435F64, 0x34B5F709 } },
+	      { { 0x34F282A5, 0x663B69AE, 0x1E2B7E05, 0x6FE71618 } } } },
+	  { { { { 0x22B5709C, 0x46F51142, 0xF504A607, 0x7579FEC3 } },
+	      { { 0xBF0F604B, 0xD0B272C9, 0x1B184321, 0x7EBC4639 } } } } },
+	// (2^40)*B * 1
+	{ { { { { 0x75760DFC, 0xEDFF5AD3, 0xEA88F1A6, 0x6A8FB85A } },
+	      { { 0x166624A2, 0xDDC1F53A, 0x15ECD8EE, 0x337D092F } } } },
+	  { { { { 0x0AB84457, 0x5CA20C12, 0x209234EA, 0x053C636C } },
+	      { { 0x2C298BFE, 0x798BFE45, 0xBBC0A11A, 0x678C7377 } } } } },
+	// (2^40)*B * 2
+	{ { { { { 0xBDE1B2A6, 0xF1365955, 0xFE899242, 0x6A7776DE } },
+	      { { 0xACF8B816, 0xAE2FD6AC, 0xBFBF0DC5, 0x41BF72A8 } } } },
+	  { { { { 0x2398B49A, 0x685CEC29, 0x3AC3B9D5, 0x444CC3D8 } },
+	      { { 0x53AF6262, 0x133F714D, 0xA1146992, 0x54C831A1 } } } } },
+	// (2^40)*B * 3
+	{ { { { { 0x4EAD54CB, 0xD821D317, 0xE769069B, 0x4A30EC22 } },
+	      { { 0x33D9AAA6, 0xF9DF4AAE, 0xB54063B0, 0x071801CD } } } },
+	  { { { { 0x73F255E9, 0x7CEB3A5B, 0x14461116, 0x1D3D1D47 } },
+	      { { 0xDA05B9AA, 0x6AB21CE1, 0xDB3733B7, 0x3A068543 } } } } },
+	// (2^40)*B * 4
+	{ { { { { 0xEA7C93A2, 0xBDC1BAAB, 0x06478B5E, 0x2CEC2814 } },
+	      { { 0x6FC648BD, 0x5C6E3CCB, 0x0BD965E6, 0x6DA83813 } } } },
+	  { { { { 0xD66E71D1, 0xFF82ED0F, 0x3BD197D8, 0x7A5FC66A } },
+	      { { 0xD4041676, 0x077B0697, 0xE27A99A3, 0x1BAE9AC1 } } } } },
+	// (2^40)*B * 5
+	{ { { { { 0x1F662154, 0x7426F8B3, 0xB68F5DBE, 0x646D7960 } },
+	      { { 0x6DA0AE97, 0x96EC60DD, 0x94075DC8, 0x0F76B97C } } } },
+	  { { { { 0xF082F242, 0xB55590FF, 0xCE849171, 0x18EBAEAD } },
+	      { { 0x402D717D, 0x8D036AF7, 0x57D21231, 0x686ADF63 } } } } },
+	// (2^40)*B * 6
+	{ { { { { 0x98F74BD1, 0x5C995052, 0x3DC14353, 0x558A44CC } },
+	      { { 0xF15A5E09, 0x3B2734CC, 0x6EF3E29F, 0x0895F4B8 } } } },
+	  { { { { 0x4A0E45F0, 0x84874B57, 0xC01D1AF9, 0x3029D4EC } },
+	      { { 0xA1A4B7DA, 0x6B438085, 0x19EBCECF, 0x18010294 } } } } },
+	// (2^40)*B * 7
+	{ { { { { 0x1C78F6B3, 0xB14238FF, 0xAC9280B9, 0x74EEB8E7 } },
+	      { { 0x787D2049, 0x279878E8, 0x466C760E, 0x4BCB1A3F } } } },
+	  { { { { 0xF0006F7D, 0x2696BA9E, 0xA6631A3F, 0x129B3A2B } },
+	      { { 0x04E061A9, 0x6A11B665, 0x05CE0E58, 0x200CF453 } } } } },
+	// (2^40)*B * 8
+	{ { { { { 0xDE9BB16E, 0x648C077A, 0x1D120176, 0x09235364 } },
+	      { { 0x2CFD6885, 0x59FD693E, 0x5059EBDC, 0x648B40D9 } } } },
+	  { { { { 0x08869942, 0x28726BB3, 0xCA947C45, 0x4E1D0590 } },
+	      { { 0xFED01B9F, 0x3B63FEEC, 0x5D05C354, 0x7430E410 } } } } },
+	// (2^44)*B * 1
+	{ { { { { 0x4A63B9E6, 0xEC5A6A7C, 0x5F4A2ACB, 0x6B3329BC } },
+	      { { 0xBBA050AA, 0x19AB7601, 0xD22621D8, 0x2A09FC67 } } } },
+	  { { { { 0xE1A91701, 0x685CF42B, 0x2DCC10A6, 0x3747E23D } },
+	      { { 0x6B9F0080, 0x7C6A0595, 0x3CBE586A, 0x391CB114 } } } } },
+	// (2^44)*B * 2
+	{ { { { { 0xFC3439B5, 0x62331F52, 0x4D507C0C, 0x4A154AFF } },
+	      { { 0x3347E991, 0xC7DA685E, 0x09554E89, 0x083FE5B3 } } } },
+	  { { { { 0x01870DCB, 0x47AEC992, 0x0329197D, 0x4E36A37F } },
+	      { { 0x391D5082, 0xD6E86845, 0x2D70DE46, 0x4DAE2F8E } } } } },
+	// (2^44)*B * 3
+	{ { { { { 0xED89A120, 0xAF77ED9C, 0xDC774AB7, 0x3A0DD8ED } },
+	      { { 0xBF74B629, 0xE4C2BD3C, 0xC01BD022, 0x78DFC554 } } } },
+	  { { { { 0xFCD39CEF, 0xCC564A8A, 0xAF09632B, 0x686F2DDF } },
+	      { { 0xF620C4B6, 0x381B0839, 0x4BCCF95A, 0x140259F2 } } } } },
+	// (2^44)*B * 4
+	{ { { { { 0x885BC579, 0x4C3465AD, 0xC6E46E79, 0x6E4C4915 } },
+	      { { 0xE90AADEE, 0xFB95060C, 0xCA8C3ACC, 0x0EF3EAA6 } } } },
+	  { { { { 0x62EA0978, 0x47B05DFD, 0x6EB82490, 0x16D343BF } },
+	      { { 0xB0D5EF85, 0x207517EF, 0x7F96B110, 0x09A6ED7B } } } } },
+	// (2^44)*B * 5
+	{ { { { { 0x23420A31, 0xAF40F36E, 0xB84A810C, 0x75D69F2A } },
+	      { { 0x069AB87C, 0x7102758B, 0xC9D457C6, 0x4EEECFE8 } } } },
+	  { { { { 0xC329FB43, 0xA2549767, 0x04332C89, 0x3CC1463F } },
+	      { { 0x0CCE7C42, 0x2955DF1E, 0xAD5B7A86, 0x481F091C } } } } },
+	// (2^44)*B * 6
+	{ { { { { 0xC2076740, 0x59EF24ED, 0x2FBE75FD, 0x0F70F06F } },
+	      { { 0x6D3573CF, 0xB66EB72C, 0x57FC5637, 0x58A71516 } } } },
+	  { { { { 0x5B11DE7D, 0x37677A7F, 0x3AE5E813, 0x66D20035 } },
+	      { { 0x8AF7961C, 0x8AD1D169, 0xBB353022, 0x47F5B6E3 } } } } },
+	// (2^44)*B * 7
+	{ { { { { 0x78F26943, 0xF0B4853C, 0x359B5CF8, 0x37161116 } },
+	      { { 0x6594F38B, 0x3A2920F4, 0xBBEE0FA3, 0x4898AD5C } } } },
+	  { { { { 0x2EDDFF32, 0x80B4F079, 0x4EB187EE, 0x7262483E } },
+	      { { 0x33F0A804, 0xF513F55B, 0xBB237011, 0x5B5A12B1 } } } } },
+	// (2^44)*B * 8
+	{ { { { { 0x49768EA3, 0x5725BBF6, 0x7B66A790, 0x498C9FD7 } },
+	      { { 0x65FCF1FE, 0x318616A6, 0xCE92CBAD, 0x7C65D8A0 } } } },
+	  { { { { 0x68D5D6F8, 0x6585C759, 0x78B1D856, 0x52D8A866 } },
+	      { { 0x0F176A24, 0xB9DFED13, 0xA4B5DB6F, 0x40EF84C0 } } } } },
+	// (2^48)*B * 1
+	{ { { { { 0xE7D22B99, 0x29B675E3, 0x32C67197, 0x022B6694 } },
+	      { { 0x4ED2A423, 0x179E4E91, 0x234B6400, 0x63D86CB0 } } } },
+	  { { { { 0x6BBF8F32, 0xD0C3495D, 0x54459C23, 0x17B7FE06 } },
+	      { { 0x80DD8210, 0xE54B5E95, 0x94DACCD3, 0x657CF971 } } } } },
+	// (2^48)*B * 2
+	{ { { { { 0x1F583AA7, 0xC9B73227, 0xC831B657, 0x48EBE938 } },
+	      { { 0x3DD239B2, 0x08882673, 0xE2795C0F, 0x5A1B83A7 } } } },
+	  { { { { 0x663CADC2, 0x55B90869, 0xA293D68D, 0x558747CE } },
+	      { { 0xEC04D71B, 0xC0D11B5F, 0x4B7DD481, 0x1F359981 } } } } },
+	// (2^48)*B * 3
+	{ { { { { 0xC74CA692, 0x88257C77, 0xFE2543D0, 0x083CA721 } },
+	      { { 0x545B6075, 0xD35CC1F8, 0x937BD410, 0x25517FD0 } } } },
+	  { { { { 0xF4A229B3, 0x95728815, 0x69C8BDF6, 0x4EEBAF37 } },
+	      { { 0x52ECC702, 0x4058035A, 0xBBDED186, 0x1CCFEC1A } } } } },
+	// (2^48)*B * 4
+	{ { { { { 0xAD87370F, 0xFFFC3AB1, 0x49F6C0D6, 0x4FBD707B } },
+	      { { 0xB244138F, 0x0735E39B, 0xC6AC4AD7, 0x35FBF7D1 } } } },
+	  { { { { 0x415340D7, 0xC63ADBF0, 0xA74232B1, 0x5C7B01DD } },
+	      { { 0xF7343964, 0xD040A472, 0x7AABE0B4, 0x53547D50 } } } } },
+	// (2^48)*B * 5
+	{ { { { { 0xFB42D19F, 0x3DD7A80D, 0xDAD45900, 0x2B3B54FB } },
+	      { { 0x76356340, 0x2C8286E5, 0xC04E2063, 0x2688738A } } } },
+	  { { { { 0xB773591E, 0xE6411CD8, 0xA0D53C14, 0x46E22C91 } },
+	      { { 0x2385D850, 0x976674A0, 0x59FE3A9B, 0x0256E9EC } } } } },
+	// (2^48)*B * 6
+	{ { { { { 0x3A9CD59F, 0x684C0A06, 0xA8717000, 0x625B8BD7 } },
+	      { { 0xBF606FD2, 0x30299878, 0x5B348ACB, 0x58C023C4 } } } },
+	  { { { { 0x2918F1E4, 0xCED7EE9C, 0xCC457719, 0x0B1D80FC } },
+	      { { 0xB19404A3, 0xD2930402, 0x2F29363A, 0x2F0E7637 } } } } },
+	// (2^48)*B * 7
+	{ { { { { 0x374870D5, 0xE0D62664, 0x4A3B6122, 0x481C9821 } },
+	      { { 0x8B01FD1E, 0xAB158BB2, 0x14E9DCF7, 0x11F514A3 } } } },
+	  { { { { 0x78696395, 0x5514EFE5, 0xA656D2E7, 0x7FCBA955 } },
+	      { { 0x5DDB9E5B, 0x7C323607, 0xE68E6A8C, 0x2BB4DA27 } } } } },
+	// (2^48)*B * 8
+	{ { { { { 0xC1EEDEAA, 0x910E755E, 0x986379C5, 0x54CB83C9 } },
+	      { { 0xBF8A2419, 0x6198DBEA, 0xA7877EA2, 0x329700D0 } } } },
+	  { { { { 0x0E39DD4A, 0x7EECDE99, 0x560E7792, 0x76DA79D1 } },
+	      { { 0xB55A0C2B, 0x166369EB, 0x475BC922, 0x4357A81C } } } } },
+	// (2^52)*B * 1
+	{ { { { { 0x9C8AA895, 0x690F659F, 0x6D8F870F, 0x152F687C } },
+	      { { 0x1FB946A6, 0x573F464C, 0xAEE1A756, 0x46B3862C } } } },
+	  { { { { 0xEAB6D9BE, 0x89DCA9E5, 0x9EB05A00, 0x3400478F } },
+	      { { 0x56F5EA5A, 0xD8BACE6A, 0x6BBFEFA8, 0x0AF0F4AB } } } } },
+	// (2^52)*B * 2
+	{ { { { { 0x8192B14E, 0xE788B49A, 0x4CC96725, 0x0E5ECF09 } },
+	      { { 0x5C7A2C1A, 0x98B01BE0, 0xBBBDA6B3, 0x751BAB02 } } } },
+	  { { { { 0x1FE0FEAE, 0xDD175F42, 0x65D2079A, 0x22309DB2 } },
+	      { { 0xCDF3EA3D, 0xAB604F14, 0x06610AA0, 0x4608A076 } } } } },
+	// (2^52)*B * 3
+	{ { { { { 0x04EF54DD, 0x29F99922, 0x7274E025, 0x07E6BEFC } },
+	      { { 0x43DAEB83, 0xE74498B0, 0x24FB15CA, 0x2FFA3531 } } } },
+	  { { { { 0xCA5B14B9, 0xE8544AD1, 0xF62EDE7B, 0x509AD593 } },
+	      { { 0xAC894B93, 0x4CC5E3C2, 0x9BF259FE, 0x62C7307C } } } } },
+	// (2^52)*B * 4
+	{ { { { { 0xC9C2B157, 0x1F962D87, 0xD5FF2991, 0x7E1531E5 } },
+	      { { 0xE9B1A940, 0xE8508017, 0x0C525FA1, 0x7F8F9683 } } } },
+	  { { { { 0xBF651708, 0x09D1D873, 0x6D81D467, 0x672B1615 } },
+	      { { 0x440C0821, 0x4AD8E9DF, 0xC40F83C6, 0x0B25EC99 } } } } },
+	// (2^52)*B * 5
+	{ { { { { 0xA2416B40, 0x8E612332, 0xE51B3A17, 0x710C9DE1 } },
+	      { { 0xDA9DA040, 0x9097F64E, 0xDD661E9F, 0x00E2DA67 } } } },
+	  { { { { 0x7A980010, 0x5EB88259, 0xD7DADFF7, 0x5B2F5840 } },
+	      { { 0x4F57F258, 0xE9C605F4, 0x20843737, 0x542A60C3 } } } } },
+	// (2^52)*B * 6
+	{ { { { { 0x117C9FD1, 0xC144E4EF, 0x92B997CC, 0x0A950CA7 } },
+	      { { 0xDD9CDA19, 0x815DD2EC, 0x3173435A, 0x36404D39 } } } },
+	  { { { { 0xF04F27E6, 0xBD32777D, 0x8C96545B, 0x66630C80 } },
+	      { { 0xE9926297, 0x82FF68EB, 0x1D9F6BF0, 0x234C5D83 } } } } },
+	// (2^52)*B * 7
+	{ { { { { 0x7A4EFA9E, 0xFE2CD77C, 0xAE4A34BF, 0x7A742285 } },
+	      { { 0xACFB4E9E, 0x49325D9C, 0x3FE59503, 0x1707A788 } } } },
+	  { { { { 0x3B2BBFDF, 0x608CDBA8, 0x0F5214C8, 0x0D4C53F6 } },
+	      { { 0x7258FDEE, 0x28D64923, 0xA7CF555E, 0x108B18C5 } } } } },
+	// (2^52)*B * 8
+	{ { { { { 0x97D38312, 0xC3ADB128, 0xA41B1419, 0x27211802 } },
+	      { { 0x08E3BF8F, 0x74205AF2, 0x74A12B16, 0x525E1611 } } } },
+	  { { { { 0x07DEE65E, 0x256CC1FF, 0xC1EE0E0A, 0x40C15AF1 } },
+	      { { 0x06C38788, 0xA130C657, 0x5F379EB6, 0x4222C6C0 } } } } },
+	// (2^56)*B * 1
+	{ { { { { 0x57D63CFA, 0x53C7C5D4, 0x99C5B1D6, 0x413E4B40 } },
+	      { { 0xC3EEA1FE, 0x7BCA9A15, 0x35EF47AC, 0x470EB1EF } } } },
+	  { { { { 0xD8C6A83F, 0xC30F6FE3, 0xAF9D3D59, 0x04E0C73B } },
+	      { { 0x529F2617, 0x54856738, 0x8DA892F0, 0x4D053D02 } } } } },
+	// (2^56)*B * 2
+	{ { { { { 0x197CC107, 0x3A191357, 0x071029FE, 0x012B8E01 } },
+	      { { 0x7EB9E318, 0x0502BEC1, 0x117363D5, 0x22E62664 } } } },
+	  { { { { 0xF3F9669E, 0x76E614DA, 0xDCF9702C, 0x75CED114 } },
+	      { { 0x0058E5D9, 0x1D7B9761, 0xD512215E, 0x7DB962C4 } } } } },
+	// (2^56)*B * 3
+	{ { { { { 0xB260DB37, 0x8667D543, 0x0C98338E, 0x59289B6C } },
+	      { { 0x7A195D24, 0x77C25177, 0x9102E92A, 0x09A3CB68 } } } },
+	  { { { { 0xBF4B7C30, 0x7B637619, 0x0F9E7D3B, 0x3D8F2457 } },
+	      { { 0x12E84F53, 0x2A4C9EF6, 0xC13E2058, 0x2B41DDE5 } } } } },
+	// (2^56)*B * 4
+	{ { { { { 0x57120AA3, 0xA0F48D18, 0xDE29EA72, 0x5A8ABBE8 } },
+	      { { 0xDC4A975D, 0x7ACC9FF9, 0xADFC1C26, 0x7E6C12B1 } } } },
+	  { { { { 0x1249C479, 0x221B9110, 0x5609CD76, 0x7E561CE1 } },
+	      { { 0x83E528E7, 0x21406D15, 0xA93DDB8A, 0x0595813A } } } } },
+	// (2^56)*B * 5
+	{ { { { { 0xF52705C8, 0x7752C56C, 0xBD08F268, 0x5AA0B329 } },
+	      { { 0x9013E4C4, 0x0B3B1528, 0x08026BC8, 0x6133012F } } } },
+	  { { { { 0x85F3394D, 0x2ACC58C2, 0x74FBD9FF, 0x728B9032 } },
+	      { { 0x72DA7295, 0x629C48BE, 0x7D989DBB, 0x13157B6D } } } } },
+	// (2^56)*B * 6
+	{ { { { { 0x3497B2E4, 0x616218CA, 0x6FE1A23F, 0x5F62FB27 } },
+	      { { 0x847F9F28, 0x40DA9D98, 0x5B3A3E00, 0x3DB26CAB } } } },
+	  { { { { 0x521D389C, 0x8ED16541, 0x47511BCB, 0x3DAB2174 } },
+	      { { 0x32A2A693, 0x5762A182, 0xEA98EF8C, 0x5282875A } } } } },
+	// (2^56)*B * 7
+	{ { { { { 0x5BFF24B9, 0xDC99B15D, 0xB413FA5F, 0x39D9FBF7 } },
+	      { { 0x82D6E2C8, 0xF6E363C2, 0xE9198811, 0x22B3C787 } } } },
+	  { { { { 0xA2B6E8BD, 0xED28F02B, 0x4FAC4F70, 0x3733AF83 } },
+	      { { 0x7337DFE4, 0x9264B3A7, 0x74D0D42D, 0x022283D1 } } } } },
+	// (2^56)*B * 8
+	{ { { { { 0x8FE0EBD2, 0xB856F04D, 0x034244BE, 0x7CDB5B51 } },
+	      { { 0x426EB0E0, 0x42EC57A5, 0x907268AE, 0x5EB7AA0D } } } },
+	  { { { { 0x4D9E8260, 0xE3B34E8A, 0x99E942E5, 0x3117F052 } },
+	      { { 0xC8E4AC09, 0xEF61CA84, 0x5AD11E46, 0x5BF2AE6B } } } } },
+	// (2^60)*B * 1
+	{ { { { { 0x3AA32E7F, 0x64EE5E01, 0x4B84B052, 0x13541B89 } },
+	      { { 0xE9663C76, 0x61ADD71A, 0xCF6CA6DC, 0x1A565C63 } } } },
+	  { { { { 0xB68C5CC5, 0xB57CB213, 0x931541A1, 0x53161DBE } },
+	      { { 0x3DEAED06, 0xE974504A, 0x5ADD6D90, 0x28FA11AC } } } } },
+	// (2^60)*B * 2
+	{ { { { { 0x14FF19BC, 0xD933DDDE, 0x8580A5B5, 0x3F840CBB } },
+	      { { 0x72265298, 0xA778A6C7, 0x2229B1F3, 0x5D4E73A0 } } } },
+	  { { { { 0x2E70B0D5, 0x33AC848D, 0xCB97B7B0, 0x57700BF3 } },
+	      { { 0x9675C74D, 0xAA6CDFF3, 0x986F085A, 0x58099B22 } } } } },
+	// (2^60)*B * 3
+	{ { { { { 0x504F6599, 0x9262DF85, 0x9E3EC66F, 0x11BE414F } },
+	      { { 0xDD124C8F, 0x7D5E38D1, 0x2B4D3C04, 0x29EB90F4 } } } },
+	  { { { { 0xE67827D1, 0x6E87FE61, 0xE1B39624, 0x47819360 } },
+	      { { 0x32E747DA, 0x27DD2A2F, 0x47624368, 0x0ED215F5 } } } } },
+	// (2^60)*B * 4
+	{ { { { { 0x410B0416, 0x7CD64528, 0x75672579, 0x57BFEB7A } },
+	      { { 0x3DE1410A, 0x65E46119, 0x91FC2415, 0x3A549C8B } } } },
+	  { { { { 0x4D04A14A, 0xD812AD00, 0x7368EAAB, 0x699EED1D } },
+	      { { 0x046C1615, 0x0D1DB559, 0x0355558B, 0x70D7EE4E } } } } },
+	// (2^60)*B * 5
+	{ { { { { 0x1878677B, 0x466DC3DC, 0x7CB21DB4, 0x7BB4DFDA } },
+	      { { 0x6DB356C9, 0x7790B0A5, 0x22A6E2DC, 0x46F9BCBB } } } },
+	  { { { { 0xAAF2BC23, 0x6D0FC14C, 0x683F79AF, 0x352AA9E9 } },
+	      { { 0xBD0292CE, 0xF0781CE8, 0x49B859C0, 0x3FC2A7D8 } } } } },
+	// (2^60)*B * 6
+	{ { { { { 0xA912151E, 0xE03601B1, 0xBEF4733B, 0x5F0C2A0D } },
+	      { { 0x43BC33C3, 0xFE3D5FF4, 0x7079C480, 0x49DE3D77 } } } },
+	  { { { { 0xC2517AA1, 0x4553202E, 0x22C3B7EB, 0x51BD4744 } },
+	      { { 0x626D4B73, 0x457767DB, 0x7EE85966, 0x76A980A2 } } } } },
+	// (2^60)*B * 7
+	{ { { { { 0x5A871FCE, 0xD555D4B7, 0x6D12CEF3, 0x6E7EE1A5 } },
+	      { { 0xF62AF6EA, 0xE35F8DCD, 0xDB590FC4, 0x42A52185 } } } },
+	  { { { { 0x06BC46A9, 0x56E8143D, 0x481EC204, 0x49927067 } },
+	      { { 0x05680B5F, 0x94AA5E46, 0xC9C68515, 0x290F7A39 } } } } },
+	// (2^60)*B * 8
+	{ { { { { 0x762D8E46, 0x7FF3AD8F, 0xBD3E54C3, 0x68B779DF } },
+	      { { 0xFC67B813, 0x8DC1235B, 0xE7C1F0A6, 0x1F5F279C } } } },
+	  { { { { 0x8F4D7570, 0xA19B8804, 0xE97CB5AA, 0x102D8FBC } },
+	      { { 0xC9223D25, 0xC2E32BE1, 0x74C51F3F, 0x1B2F0B77 } } } } },
+	// (2^64)*B * 1
+	{ { { { { 0x4D3AE7AC, 0x26123159, 0x28CEB8AD, 0x082A5BBF } },
+	      { { 0x83030F30, 0xD959B911, 0x5AF1898E, 0x4447B9E0 } } } },
+	  { { { { 0x4D3DE629, 0x2C7A5450, 0xA6F9484C, 0x431796A3 } },
+	      { { 0xE5D3C8CD, 0x357D7D22, 0xE5323C2E, 0x147CCFFB } } } } },
+	// (2^64)*B * 2
+	{ { { { { 0xF207FAC6, 0x05704BF4, 0x161BD3A2, 0x0F16C7B1 } },
+	      { { 0x870DEC6E, 0x1AD76AF2, 0xD0BF2740, 0x4FB614A7 } } } },
+	  { { { { 0x28566D8A, 0x45D7C01C, 0x4077ABED, 0x005002FF } },
+	      { { 0x5672D4B3, 0x6542A776, 0xA98AB48D, 0x04137083 } } } } },
+	// (2^64)*B * 3
+	{ { { { { 0xF0350244, 0x27C990FF, 0x857F7525, 0x18A5BC91 } },
+	      { { 0x79997083, 0x6004C035, 0xE0E1B992, 0x1744491A } } } },
+	  { { { { 0x17682DD3, 0x9C8593D7, 0x84AE8661, 0x402364E0 } },
+	      { { 0xB2E2B9F3, 0x20F86314, 0x4D9B1FB5, 0x545AF79A } } } } },
+	// (2^64)*B * 4
+	{ { { { { 0xDDA5DC0B, 0x23CBD429, 0x6A5208C3, 0x27DF09B6 } },
+	      { { 0x8B8FF984, 0x10BCC45E, 0x205DF31F, 0x4D7FE346 } } } },
+	  { { { { 0xC97F02A7, 0x0CB81A89, 0x7D64DBF2, 0x3C1C9D27 } },
+	      { { 0x704354B3, 0xF84A977B, 0x368738E4, 0x2C8704A6 } } } } },
+	// (2^64)*B * 5
+	{ { { { { 0x448B153F, 0x5FBA8828, 0x9A0F0423, 0x01E91ADB } },
+	      { { 0x4BFABFFD, 0x1441B534, 0xA4E2D56F, 0x6D0A611A } } } },
+	  { { { { 0xC6ED13FE, 0x67C71E1C, 0xA6321549, 0x4DEFBBD5 } },
+	      { { 0x5515923F, 0xA187801F, 0xB7921BE3, 0x5FAD2693 } } } } },
+	// (2^64)*B * 6
+	{ { { { { 0x9A07D071, 0xCBD5E245, 0xCE94BD91, 0x578067F7 } },
+	      { { 0x22EBB7B9, 0x393D9B57, 0xF4C2C566, 0x07F1E938 } } } },
+	  { { { { 0x7ACE6FEC, 0xAF27AF4B, 0x2CE0A5CF, 0x6DE1B7A6 } },
+	      { { 0x633B4D64, 0xD0C6FCA2, 0x989F7B92, 0x2813A2EA } } } } },
+	// (2^64)*B * 7
+	{ { { { { 0x41DBB5A8, 0x0A58149A, 0x1073E8F8, 0x106DF92D } },
+	      { { 0x493E86B2, 0x197899FC, 0x2197B358, 0x2E0E05CE } } } },
+	  { { { { 0x709BC381, 0x2D603F9B, 0xA19EED77, 0x26507080 } },
+	      { { 0x1A0926FE, 0x5D86707B, 0x55F08B86, 0x2C55B877 } } } } },
+	// (2^64)*B * 8
+	{ { { { { 0xCD1523B9, 0x43086DD4, 0x4CF14DC9, 0x25B6941E } },
+	      { { 0x40028B29, 0x0C30580B, 0xA4F8EDDF, 0x6B6816FF } } } },
+	  { { { { 0x84749178, 0xB9FFB6EF, 0x8D83172B, 0x16BFA2F7 } },
+	      { { 0x577E2135, 0xCD9F9599, 0xC1FB34BF, 0x0B9E5031 } } } } },
+	// (2^68)*B * 1
+	{ { { { { 0x468B34B4, 0xCE33CBF4, 0x8088F6B4, 0x336B43EF } },
+	      { { 0x590BF9AC, 0xBF3D7155, 0x7B1FB471, 0x467EE5EE } } } },
+	  { { { { 0xDB653538, 0x155767E7, 0x0E198094, 0x6F3C3813 } },
+	      { { 0x0EAEC1D7, 0x36DF5040, 0xFF06C86A, 0x1249AC09 } } } } },
+	// (2^68)*B * 2
+	{ { { { { 0x18AF38F3, 0x78049882, 0x4707BDAE, 0x0663D742 } },
+	      { { 0x22E37BB0, 0x25B10DD3, 0x5F332894, 0x42F08064 } } } },
+	  { { { { 0xADAEAF9A, 0x8854245F, 0x1F0B3D0E, 0x5209FDAC } },
+	      { { 0xF6DAB37D, 0x1AB17A89, 0x9A2B83C1, 0x04417E92 } } } } },
+	// (2^68)*B * 3
+	{ { { { { 0x7A24BEA3, 0x5C2D8ABB, 0xC6322D55, 0x43B0D3A6 } },
+	      { { 0x50742CD1, 0x754620CE, 0x31329A3B, 0x4F910FFA } } } },
+	  { { { { 0x5E1AE83B, 0x15133094, 0x91DF20B3, 0x55817B16 } },
+	      { { 0x11E19CF7, 0xB44DE434, 0x3F40ADA6, 0x2A533351 } } } } },
+	// (2^68)*B * 4
+	{ { { { { 0xAB06F3ED, 0xAB810390, 0x03E75464, 0x4E0443F2 } },
+	      { { 0x782C8F1A, 0x57147E1C, 0x6D04D73A, 0x2B479D6E } } } },
+	  { { { { 0x606819C6, 0x774DD41E, 0x1FE37BFC, 0x791D1694 } },
+	      { { 0xAF57B8E9, 0x070F0C3F, 0xD1424B7E, 0x7057F0DA } } } } },
+	// (2^68)*B * 5
+	{ { { { { 0x28A0DECD, 0x1A87B52E, 0xA9FAE634, 0x4938D9F2 } },
+	      { { 0xADFF1FC3, 0x9607E61A, 0x79DEE753, 0x44FF5DDA } } } },
+	  { { { { 0x09EC89BC, 0xACF2C745, 0xDFF8518A, 0x1FDFC33D } },
+	      { { 0x43FD54FD, 0xB93E08DB, 0x2562312E, 0x1EEF6393 } } } } },
+	// (2^68)*B * 6
+	{ { { { { 0x520F50AB, 0xA50E018D, 0x6484F4DF, 0x41BEE736 } },
+	      { { 0xE213BAC1, 0x774C74EF, 0x6B0981E5, 0x11F91913 } } } },
+	  { { { { 0xC6245268, 0x070F1473, 0x970A907A, 0x3A9E349B } },
+	      { { 0xC7827931, 0xF96D0ADC, 0x525D7E50, 0x6FF0F1F6 } } } } },
+	// (2^68)*B * 7
+	{ { { { { 0xAF6E220F, 0xB7ABF4F1, 0xE7700974, 0x7C0D037A } },
+	      { { 0x49AE544E, 0x2B4414F5, 0x535F4937, 0x4BB4FBAF } } } },
+	  { { { { 0x337EE802, 0x50E18F4F, 0x36C92B27, 0x4D998D87 } },
+	      { { 0x80B2FC6D, 0x55499805, 0x107FDAA9, 0x0CAA4E10 } } } } },
+	// (2^68)*B * 8
+	{ { { { { 0xA2731473, 0xE6F03D2C, 0xBEAB3250, 0x5A174D19 } },
+	      { { 0xD9921260, 0x5E0742F5, 0x4B84A0CC, 0x7FD8A52B } } } },
+	  { { { { 0xBB7AAAC6, 0xF7BE869C, 0xD1C7FEBB, 0x22D796AF } },
+	      { { 0x5E9FC6FD, 0xEB46B707, 0x140B0526, 0x64766EDC } } } } },
+	// (2^72)*B * 1
+	{ { { { { 0x93B9F703, 0x39D19AB9, 0x457E3885, 0x34659A10 } },
+	      { { 0xCC0C73BF, 0xB725542C, 0xFB53A22D, 0x774B7E1E } } } },
+	  { { { { 0x071FDF9E, 0x1C84063C, 0x4F6D270B, 0x56D9D636 } },
+	      { { 0xCE46A73F, 0xA7C27BEE, 0x8386F845, 0x0D45B9ED } } } } },
+	// (2^72)*B * 2
+	{ { { { { 0x09292774, 0xFA0556E8, 0x27F64592, 0x2AB6A723 } },
+	      { { 0xF42560E0, 0xD53BB33B, 0x600C2365, 0x43CD42C7 } } } },
+	  { { { { 0x6BAAD915, 0xC1806749, 0xACD6FE83, 0x460A7C99 } },
+	      { { 0x76FB0017, 0xE5058EB6, 0x0D5F6EC2, 0x71C4E622 } } } } },
+	// (2^72)*B * 3
+	{ { { { { 0x61243D7E, 0xE1CC5CC7, 0xA0855179, 0x2C48C0B9 } },
+	      { { 0xEE076BE5, 0xDB192B8D, 0x6D184964, 0x23CBEE73 } } } },
+	  { { { { 0x6EADEA75, 0xC4D912D4, 0xF1D8708F, 0x341236DE } },
+	      { { 0x77DC7651, 0xBDF8837F, 0x8B111A29, 0x54DC2116 } } } } },
+	// (2^72)*B * 4
+	{ { { { { 0xCCE9AD73, 0x201C5DA8, 0x8B65A128, 0x3AE14D32 } },
+	      { { 0x0ACCFB85, 0x3A428CCA, 0x5BCE3747, 0x55DF11D0 } } } },
+	  { { { { 0xBBA00008, 0x7B1A9728, 0x012841C3, 0x44520599 } },
+	      { { 0xD8EDEF19, 0xECBD3829, 0xCC7BD63A, 0x591C7C5E } } } } },
+	// (2^72)*B * 5
+	{ { { { { 0xF0194095, 0x2CF74868, 0x7117705D, 0x32E032EA } },
+	      { { 0x58C8F4F7, 0x341B8EF4, 0xF0C77A51, 0x76220BBC } } } },
+	  { { { { 0x126424D3, 0xFA52C450, 0x23591191, 0x64BD5E8A } },
+	      { { 0xC3ADEDA4, 0x4FA01F9C, 0x2FBF0194, 0x764F2E2B } } } } },
+	// (2^72)*B * 6
+	{ { { { { 0xC65F1E7D, 0xE14FD9B6, 0xBDB947BD, 0x340A0A4B } },
+	      { { 0x8AD2D40E, 0x57935792, 0xA67B6BFE, 0x6371C902 } } } },
+	  { { { { 0xD0D59E9A, 0x96DA4E94, 0x86D1EEDA, 0x1E6D2CF7 } },
+	      { { 0x1242D369, 0xE4AA9B72, 0xAE644519, 0x02C79ECA } } } } },
+	// (2^72)*B * 7
+	{ { { { { 0x7A338F38, 0xF7751DD5, 0xAADFC94E, 0x1D6D5D4D } },
+	      { { 0x9622F915, 0x70A44A96, 0x917C482C, 0x7A124595 } } } },
+	  { { { { 0xFFE9E392, 0x1474FC33, 0x99A143FB, 0x07C90F30 } },
+	      { { 0xCD104905, 0x3CDEA154, 0xA4872CF7, 0x738E7EA8 } } } } },
+	// (2^72)*B * 8
+	{ { { { { 0x71332C8B, 0x52F96CBE, 0xC9D85840, 0x5F3DFED8 } },
+	      { { 0x09CB57AE, 0xA5E736D2, 0x664B6CC0, 0x67B1D202 } } } },
+	  { { { { 0xBCC916A8, 0x1016C6EC, 0x104DB052, 0x08D3FE7E } },
+	      { { 0x7D7ADE49, 0xF05C70C1, 0x4DBBCBA1, 0x597AC48D } } } } },
+	// (2^76)*B * 1
+	{ { { { { 0xDCD8271E, 0x1ABB7081, 0x7D161DEA, 0x4EA6F506 } },
+	      { { 0x017B00C9, 0x460E9C2E, 0x61B22422, 0x7087651B } } } },
+	  { { { { 0x30C4B679, 0x390F8D77, 0x7D75E2C7, 0x2D41913E } },
+	      { { 0x69B46F2E, 0xF2E906BF, 0x15CFEB7B, 0x0CA1F103 } } } } },
+	// (2^76)*B * 2
+	{ { { { { 0xADC4C0C7, 0x85357D51, 0x2ACDD749, 0x6A69D97F } },
+	      { { 0x0667495B, 0xB25760FA, 0x25D289C6, 0x50FA3A3D } } } },
+	  { { { { 0xC0319C17, 0xAED87430, 0x306A1F1A, 0x13F612B1 } },
+	      { { 0x74CA4586, 0x098B6CE2, 0x938824A6, 0x38B3FC48 } } } } },
+	// (2^76)*B * 3
+	{ { { { { 0x30363BCB, 0xC7C4D7A5, 0x0BADD1F1, 0x50704C43 } },
+	      { { 0xC2CC9F6E, 0xC3BF0153, 0xE6AB62AD, 0x19E70204 } } } },
+	  { { { { 0x75990617, 0xC1D7E5B2, 0xC9D50570, 0x6E5A0A4D } },
+	      { { 0x91BF423D, 0xB39CF7D1, 0x4DF0654F, 0x7BE0764E } } } } },
+	// (2^76)*B * 4
+	{ { { { { 0xBFAE45A4, 0x2CEE320B, 0x1F3D84C1, 0x79C81AF4 } },
+	      { { 0x10FEC612, 0x1959B1E0, 0x36A202E5, 0x25CF3B27 } } } },
+	  { { { { 0x6D9818FC, 0x113153EC, 0x5B53D819, 0x7032A1B8 } },
+	      { { 0x6623757E, 0x5E0B5DEF, 0x0091A733, 0x3294B99E } } } } },
+	// (2^76)*B * 5
+	{ { { { { 0xECF08470, 0x4C5CCDE0, 0x8178AC1A, 0x619E11D6 } },
+	      { { 0x4BFF068C, 0x6D0F9124, 0x231098DF, 0x6E340766 } } } },
+	  { { { { 0xE69E3FE8, 0x6B52AE57, 0xB355F884, 0x68391DE2 } },
+	      { { 0xB4D2D7E3, 0x050C251D, 0xCCFFE57A, 0x5D4D56E3 } } } } },
+	// (2^76)*B * 6
+	{ { { { { 0x2A7C5C74, 0xAEFCEA4F, 0xCB4BDA1B, 0x3E081CA1 } },
+	      { { 0x7BEF1112, 0xC91AD12D, 0x7D8A228C, 0x06BB8A29 } } } },
+	  { { { { 0x2A7330F6, 0x1219BAD4, 0x7CCA7B21, 0x1962246E } },
+	      { { 0x5E039D96, 0x6AEAA76D, 0x14D761BB, 0x74C53A94 } } } } },
+	// (2^76)*B * 7
+	{ { { { { 0x3A535E8F, 0x581B1A96, 0x8D65C537, 0x577474A6 } },
+	      { { 0x360D6027, 0x4DA4A45C, 0x4FD44DA0, 0x66D0401E } } } },
+	  { { { { 0xAF6D0749, 0xA0FDC032, 0x745DFBCD, 0x5993148B } },
+	      { { 0x2F86BF6B, 0xDC08523F, 0x19262EA2, 0x5BC49007 } } } } },
+	// (2^76)*B * 8
+	{ { { { { 0x7CB29716, 0x81884B0F, 0xB1C9D281, 0x2EE6A40F } },
+	      { { 0x1077BFCB, 0xA809C7BF, 0xF537AB4E, 0x62870A7F } } } },
+	  { { { { 0xA420F752, 0xD002A70B, 0x4B4A0F40, 0x33473757 } },
+	      { { 0xDB35961E, 0x0B92D6B6, 0x68CACED5, 0x0DCF9974 } } } } },
+	// (2^80)*B * 1
+	{ { { { { 0xB55870B7, 0x130A3549, 0x8EE758CD, 0x1A9D5042 } },
+	      { { 0x068F1BE6, 0xD34BB378, 0xC2FBEFAD, 0x0EDED54C } } } },
+	  { { { { 0x5A650012, 0xAD6C8154, 0xC5524209, 0x6322B057 } },
+	      { { 0x3223D5BE, 0x74F024CD, 0x61272535, 0x346E9D86 } } } } },
+	// (2^80)*B * 2
+	{ { { { { 0xAB845819, 0x77619D35, 0xEE212213, 0x6F41B94D } },
+	      { { 0x177BADCC, 0xB2D5E03A, 0x985647A4, 0x37B2D9CB } } } },
+	  { { { { 0xCDF50548, 0x0F9AE058, 0x6D415C28, 0x50943D82 } },
+	      { { 0x51B1B10E, 0x997CEB96, 0x8363D9F4, 0x103AD918 } } } } },
+	// (2^80)*B * 3
+	{ { { { { 0xE01ABBC4, 0xADDD51E3, 0xB2149F0A, 0x4906CBB8 } },
+	      { { 0xB9862DED, 0x3D7C9B8F, 0x0A4E56C0, 0x35B2A175 } } } },
+	  { { { { 0x8A34EF91, 0x2676116E, 0x5FA1CB29, 0x69BE66A5 } },
+	      { { 0x3D60EC50, 0xCAC77717, 0xFAB03C38, 0x4581C45D } } } } },
+	// (2^80)*B * 4
+	{ { { { { 0x731BC743, 0xD7BC7BFC, 0x257AAFC4, 0x4B3CA8E6 } },
+	      { { 0x4D46A027, 0xBE6D0DFA, 0x658DAB78, 0x74EE3DB4 } } } },
+	  { { { { 0xD3792799, 0x3EA84B83, 0x094DE2FE, 0x3EABF450 } },
+	      { { 0x283EFB4F, 0x31948694, 0x6150E80B, 0x300F339F } } } } },
+	// (2^80)*B * 5
+	{ { { { { 0x64E2F323, 0x6BFCD024, 0x600F5805, 0x3786CA40 } },
+	      { { 0xA39FC498, 0x85974B82, 0x2A2DC265, 0x52FC37E2 } } } },
+	  { { { { 0xDC12D51E, 0xA221DADD, 0xBEF98C2F, 0x626A671B } },
+	      { { 0xB84544B0, 0x873150F8, 0x12C75B0B, 0x589CAEAC } } } } },
+	// (2^80)*B * 6
+	{ { { { { 0x2DF1B6A6, 0xAD0555F4, 0x9FB2D766, 0x163F167C } },
+	      { { 0xA47BC35F, 0x28DA9452, 0x31FECB94, 0x67E0A6D6 } } } },
+	  { { { { 0x6FC9D146, 0xED083D74, 0x4A4E33BA, 0x152AA658 } },
+	      { { 0x070DBF74, 0x172D3E25, 0x31146EDF, 0x57F32D4B } } } } },
+	// (2^80)*B * 7
+	{ { { { { 0xE4A2AA0D, 0x73C0C052, 0x3DF89257, 0x2B18FB38 } },
+	      { { 0xDE04B477, 0x8313DDDA, 0x4CBA7147, 0x1FF574B3 } } } },
+	  { { { { 0xE3AFD217, 0xBBEEF1BB, 0x99D9AA71, 0x39C47560 } },
+	      { { 0x36E7A8F7, 0x4D430031, 0xA3983973, 0x343816CA } } } } },
+	// (2^80)*B * 8
+	{ { { { { 0x29D5041A, 0x93166588, 0x9848862A, 0x71A003CB } },
+	      { { 0x0C5CC629, 0xFCFC34E6, 0x1D5869E3, 0x72D844F8 } } } },
+	  { { { { 0xDD308A7D, 0xB51DB6B6, 0xFE07C8D4, 0x4EF9C7E4 } },
+	      { { 0xB82B490D, 0x36F62659, 0x0DC3F62B, 0x266D4317 } } } } },
+	// (2^84)*B * 1
+	{ { { { { 0xC5BFECEF, 0xFB1CCA98, 0x0050F31E, 0x5E43AACE } },
+	      { { 0x9CFF75FB, 0x9C1E4FB9, 0x2F163FC1, 0x29C99C99 } } } },
+	  { { { { 0x3FDA3001, 0x63EA3F3A, 0x9C8513F7, 0x6A1275A5 } },
+	      { { 0x9529FB8A, 0x3BD262D2, 0x24077C11, 0x23A62307 } } } } },
+	// (2^84)*B * 2
+	{ { { { { 0xEAABF9D9, 0x3A07D182, 0xA7662E46, 0x72926C25 } },
+	      { { 0xAE2E5177, 0x6007C74F, 0xD275649E, 0x64D2C8F0 } } } },
+	  { { { { 0x1713A234, 0x48132D8D, 0x0C971261, 0x1C488779 } },
+	      { { 0xACC98745, 0x936A7ED8, 0xC1A84808, 0x4FC0E525 } } } } },
+	// (2^84)*B * 3
+	{ { { { { 0x857B822E, 0x3D877DF6, 0x3620BB67, 0x192EE9F8 } },
+	      { { 0xE2816FF8, 0x276D0672, 0x023D1706, 0x31707260 } } } },
+	  { { { { 0xF6CD82D5, 0xFE5C8865, 0xC592E319, 0x24B133B6 } },
+	      { { 0x3D1F0782, 0xAFE13757, 0x6D12A7DC, 0x399B33C1 } } } } },
+	// (2^84)*B * 4
+	{ { { { { 0x8CAFEBB8, 0x7F58A2ED, 0x0A80F029, 0x13F4FA04 } },
+	      { { 0x12D7787F, 0x651B991B, 0x5C11E489, 0x480AFE76 } } } },
+	  { { { { 0x2986578D, 0xD0B5C781, 0x2587EA2B, 0x1FE406DE } },
+	      { { 0x73D3004B, 0xE72EC7C8, 0x11B7974C, 0x1E86E8DE } } } } },
+	// (2^84)*B * 5
+	{ { { { { 0x3EA5CEDD, 0x36C4E620, 0x1C923C84, 0x35087A12 } },
+	      { { 0x2B9D4CF0, 0x378DD707, 0x41F86D54, 0x437BE50C } } } },
+	  { { { { 0x07231997, 0x47C83E7A, 0x36ACDC58, 0x28AFC24B } },
+	      { { 0xC0BD54F2, 0x1517929A, 0x8A5631B2, 0x305D671D } } } } },
+	// (2^84)*B * 6
+	{ { { { { 0x9203CB28, 0xCF97632A, 0x4C5456C4, 0x37760598 } },
+	      { { 0xE7C7C44D, 0x41AE5959, 0x294C64FA, 0x117A9A16 } } } },
+	  { { { { 0x64936937, 0xDE74536E, 0x6BBBA7BF, 0x47DD62B5 } },
+	      { { 0x79641B86, 0x799F33EF, 0x761D18EE, 0x12A22A0A } } } } },
+	// (2^84)*B * 7
+	{ { { { { 0x373E945C, 0x1BBE8A7E, 0x7374CD3A, 0x6D1D9E8A } },
+	      { { 0xE1E52655, 0xA6F78EB6, 0x35F4FAB4, 0x046F8CB6 } } } },
+	  { { { { 0x2302FE9C, 0xD9F09E81, 0xDF69DCAE, 0x523C9DA9 } },
+	      { { 0x7EAC9190, 0xC9EDC820, 0x50018062, 0x0E421BD5 } } } } },
+	// (2^84)*B * 8
+	{ { { { { 0xFB8303FD, 0x2473F001, 0x90C81EFC, 0x3B360EAD } },
+	      { { 0xB2FF299B, 0x254F431F, 0xC545E9C5, 0x55FD4B18 } } } },
+	  { { { { 0x1EC57112, 0x50973B93, 0xA892FAFA, 0x3BFDFF0F } },
+	      { { 0x953A010C, 0x463BAEF8, 0x444BAB7A, 0x3CEC1D90 } } } } },
+	// (2^88)*B * 1
+	{ { { { { 0x182D744A, 0x0636D956, 0x6BA5BDD0, 0x123E1BA7 } },
+	      { { 0x98527D66, 0x512E6035, 0xC6833850, 0x14CE4EAA } } } },
+	  { { { { 0xA981B991, 0xF37E7066, 0xDCDB3C6F, 0x6DABCC10 } },
+	      { { 0x59ABB395, 0x0E221EA0, 0x1C727B22, 0x1BCD763F } } } } },
+	// (2^88)*B * 2
+	{ { { { { 0xDF6C7495, 0x39858939, 0x599EC1E5, 0x7A01DEEE } },
+	      { { 0x22E4B09E, 0x3791AB5B, 0x7A9413F3, 0x539BBC28 } } } },
+	  { { { { 0x4904F9F0, 0xB8917A73, 0x1F232BBD, 0x598BCEB5 } },
+	      { { 0xD6109DEC, 0xC3061712, 0xF3E8BF1D, 0x2D190B4D } } } } },
+	// (2^88)*B * 3
+	{ { { { { 0xC58939ED, 0x17B5BF62, 0x98FD3EE1, 0x62922E22 } },
+	      { { 0x221583D0, 0xDD7C3CFC, 0x5A39282A, 0x79A354A6 } } } },
+	  { { { { 0xAFAD52D4, 0xD76D96B2, 0x2F287B38, 0x5F0622F6 } },
+	      { { 0xD3BD8EE1, 0x8ECA9460, 0x9A9CFE21, 0x516955EA } } } } },
+	// (2^88)*B * 4
+	{ { { { { 0x80AB08DB, 0xA7026EB3, 0x13ACC28C, 0x646AF94C } },
+	      { { 0xEF6F2F38, 0x3BEFA729, 0xFA5BD3ED, 0x7489E22F } } } },
+	  { { { { 0xCF445AB5, 0xE5648E86, 0x6FEE7F78, 0x034F2AEE } },
+	      { { 0x2873C645, 0x2CCEDD0A, 0xD936C5C5, 0x21A37E45 } } } } },
+	// (2^88)*B * 5
+	{ { { { { 0xB82AC1F3, 0x360AE9B7, 0x9DA97A89, 0x405B4BB4 } },
+	      { { 0xB9A410B1, 0xE5B85453, 0x79C15B60, 0x0137511E } } } },
+	  { { { { 0x135A9865, 0x61634075, 0x26468491, 0x17D6EA1D } },
+	      { { 0x03B13C4E, 0x1AE8CD4B, 0xA56351FC, 0x13830D1F } } } } },
+	// (2^88)*B * 6
+	{ { { { { 0x058D06B7, 0x5C7574C8, 0x02F25829, 0x6EF16F53 } },
+	      { { 0x78E5F54B, 0x02492590, 0xA5A0B54B, 0x1D2596F7 } } } },
+	  { { { { 0x7E762985, 0x6B0A14D0, 0xD65FE159, 0x275084FA } },
+	      { { 0xA4131AB9, 0x15CE6F13, 0x05E10052, 0x738BEF6D } } } } },
+	// (2^88)*B * 7
+	{ { { { { 0x5915256D, 0x9A417540, 0xB0FFA8C9, 0x3232FED0 } },
+	      { { 0xC9558672, 0x9D454F8F, 0x990261E7, 0x16E9CA8A } } } },
+	  { { { { 0x8C00FF99, 0xC168554B, 0xD92D22C6, 0x79C3525E } },
+	      { { 0xEC38C700, 0xA6C85F50, 0xD3180A5F, 0x43FF7F8F } } } } },
+	// (2^88)*B * 8
+	{ { { { { 0x5827DA93, 0xA459A95B, 0x93C792F0, 0x7D18BF99 } },
+	      { { 0xC48390DF, 0xE7BD4F80, 0xFFD6DCE5, 0x4BF9F356 } } } },
+	  { { { { 0xA294BC42, 0xD63E808B, 0x68B5E5C3, 0x1C98CB64 } },
+	      { { 0xF4ECA6D9, 0x76CB4FDD, 0x68E0BB13, 0x7E313E8A } } } } },
+	// (2^92)*B * 1
+	{ { { { { 0xEB863C28, 0x57F0709C, 0xE33F777D, 0x483F991B } },
+	      { { 0x8F2A5E83, 0x594E03A7, 0x67A4C846, 0x11D3F630 } } } },
+	  { { { { 0x5E9E2AC3, 0x190630DE, 0x8E973724, 0x47773966 } },
+	      { { 0xD7E98125, 0x9E207511, 0x14DA751E, 0x401CB34E } } } } },
+	// (2^92)*B * 2
+	{ { { { { 0x3CFC61A1, 0x19077B39, 0x2B31C21D, 0x3DC64734 } },
+	      { { 0xFB0BDD15, 0xFABDBD10, 0x2C5F6AF6, 0x4928EAB6 } } } },
+	  { { { { 0xC7AECCAF, 0xEEFAC54A, 0xFE2840D1, 0x1348657D } },
+	      { { 0x3586E0CB, 0x5C997839, 0xEB29E301, 0x439BDC4C } } } } },
+	// (2^92)*B * 3
+	{ { { { { 0x01AE1E68, 0xD7B5E5CF, 0x563FD866, 0x748B42AA } },
+	      { { 0x6317350A, 0x534EE281, 0xAA7E7CDE, 0x12FA8025 } } } },
+	  { { { { 0x7AD2FE20, 0x3C751854, 0xF74CAEA4, 0x2F3BB3E8 } },
+	      { { 0x76C18F85, 0xB220AE6E, 0xE81D5625, 0x71915187 } } } } },
+	// (2^92)*B * 4
+	{ { { { { 0x3BC62CA4, 0xCF02C993, 0x5C4E2B80, 0x4D09BF11 } },
+	      { { 0xD4C30F5B, 0xC9623829, 0xA1AEE28E, 0x3AE96C7F } } } },
+	  { { { { 0x06CEED4C, 0x2D04F6D8, 0x9D6C3BBC, 0x79401C30 } },
+	      { { 0x73AC2872, 0xCB1B0FBB, 0x40E6768B, 0x3FA89838 } } } } },
+	// (2^92)*B * 5
+	{ { { { { 0x31E4D656, 0x3401C171, 0x9BBCF05E, 0x403796A6 } },
+	      { { 0x6D7E0AC8, 0xB3FEE195, 0x34DE0AAE, 0x70087C64 } } } },
+	  { { { { 0xC94B2BDE, 0x7526E56F, 0xC9DB312F, 0x5AF2553C } },
+	      { { 0x0FCA0D18, 0xED15BF8C, 0xFAD97113, 0x40962A93 } } } } },
+	// (2^92)*B * 6
+	{ { { { { 0x93A25DA4, 0x7BCBC98A, 0x6D335893, 0x65A06185 } },
+	      { { 0x448A7F10, 0x8F94CB17, 0x84F7C081, 0x4CE15320 } } } },
+	  { { { { 0xE3B45850, 0xB3660376, 0x3F42BFE5, 0x27001246 } },
+	      { { 0xD147665B, 0xE9DCAA44, 0xDE355175, 0x792B3A50 } } } } },
+	// (2^92)*B * 7
+	{ { { { { 0xADD59AF2, 0x4E36D19A, 0xA103F295, 0x082E5255 } },
+	      { { 0x5F626E8E, 0x8139B917, 0x5FD9916C, 0x72266282 } } } },
+	  { { { { 0x3C3DAC6E, 0xCC630457, 0xFD7EF3AE, 0x750A7850 } },
+	      { { 0xD5E441DF, 0x0EB01F37, 0xF12E8A3B, 0x36057CEC } } } } },
+	// (2^92)*B * 8
+	{ { { { { 0x8AE0ED7D, 0x8F59C9C2, 0x12F8114D, 0x2D95BCDA } },
+	      { { 0xD1FB0EC9, 0x8FF5D4DC, 0x44772C7B, 0x432888FD } } } },
+	  { { { { 0x5F2ABF58, 0x54BC518A, 0x92521BAB, 0x0953A617 } },
+	      { { 0xE9717890, 0x0AC8F1E9, 0x80AB185D, 0x34D3D70D } } } } },
+	// (2^96)*B * 1
+	{ { { { { 0xDA88E093, 0x653346E6, 0x9CD13872, 0x30002265 } },
+	      { { 0x5F29D20B, 0x65532D39, 0x7CB5DE42, 0x30FE4C5C } } } },
+	  { { { { 0x421D4A31, 0x0D181FE3, 0x94F4D3F7, 0x35F3E726 } },
+	      { { 0xDD3ED40C, 0x0AB661AD, 0x4F2CADE5, 0x542B83C0 } } } } },
+	// (2^96)*B * 2
+	{ { { { { 0xCF11A8C7, 0x5450A803, 0x1DB4620C, 0x1A3EFC52 } },
+	      { { 0xB4D6810F, 0x3FA30220, 0x1BC8AF08, 0x56C04218 } } } },
+	  { { { { 0xFCE09354, 0x97E3B24D, 0xE7E9C001, 0x7B0F3BAF } },
+	      { { 0xBD91FC40, 0x2DD1D729, 0xC21B1AD2, 0x05C74680 } } } } },
+	// (2^96)*B * 3
+	{ { { { { 0x431C5C00, 0x8F7A7F37, 0x22605514, 0x4487CC96 } },
+	      { { 0x955E5D1C, 0x754A0DB2, 0xB8D0072A, 0x6AA1BE4A } } } },
+	  { { { { 0x6B1BFC14, 0xA6D4611F, 0x6B2E8951, 0x00390364 } },
+	      { { 0x0D536882, 0x723A689D, 0x973B29AB, 0x3B33B3BD } } } } },
+	// (2^96)*B * 4
+	{ { { { { 0xF4444850, 0xE2D4EE8A, 0xD2D38B53, 0x7C4CCD23 } },
+	      { { 0xECC474E6, 0x66C8957A, 0x9CF325E5, 0x70291606 } } } },
+	  { { { { 0xE0752CC9, 0x6FEC1E66, 0x3FC42538, 0x3E40F3D7 } },
+	      { { 0x8A03A6D1, 0x5E66D9FE, 0x77C4AEDF, 0x73FDAD68 } } } } },
+	// (2^96)*B * 5
+	{ { { { { 0x4F97E0A6, 0x20505FA3, 0x16909F86, 0x79ACB745 } },
+	      { { 0x82094271, 0xA163A5DC, 0x2F63A6BC, 0x1B6E5456 } } } },
+	  { { { { 0x7E812C96, 0x9EFD3DD1, 0x136FD51D, 0x6901EB6C } },
+	      { { 0xC0488EEA, 0x13157F6F, 0x0270A4C0, 0x67729C40 } } } } },
+	// (2^96)*B * 6
+	{ { { { { 0xE30AA449, 0xDBEAF734, 0xB81EC506, 0x2E1D908E } },
+	      { { 0x61127B0E, 0xF2611727, 0xBA512D9F, 0x2DC2FA82 } } } },
+	  { { { { 0x68E311D9, 0x44172899, 0xD5748EBC, 0x57F6D770 } },
+	      { { 0x99E2D413, 0x97723CD4, 0xCC746EF0, 0x283638AE } } } } },
+	// (2^96)*B * 7
+	{ { { { { 0x8B0BCCC7, 0xE16BBA3D, 0x44C9E28F, 0x29BE1EE4 } },
+	      { { 0x751536A3, 0x6E4A728A, 0x00888F7C, 0x08FD01F0 } } } },
+	  { { { { 0x6105457B, 0x3346C207, 0x67B0008B, 0x290BC8D9 } },
+	      { { 0x8C9C3D6E, 0xCC0E64B7, 0x2E01B797, 0x14197A7C } } } } },
+	// (2^96)*B * 8
+	{ { { { { 0xF4B109E4, 0x891B5765, 0x03AA5B0A, 0x4C341F78 } },
+	      { { 0xB329C9A0, 0x7DF0A0F3, 0x55940920, 0x6E637EAE } } } },
+	  { { { { 0x7624B8A0, 0x81C1B2EF, 0x54F22B55, 0x528F805E } },
+	      { { 0x7A0FFB48, 0x43A540E6, 0x07BE133F, 0x7A79D0B6 } } } } },
+	// (2^100)*B * 1
+	{ { { { { 0xF52E1AC0, 0xFACA326E, 0x7AF95691, 0x16A7A13B } },
+	      { { 0x87A70E99, 0x0CB257E9, 0x1DE1B0FF, 0x2E051FDE } } } },
+	  { { { { 0xBA06BB66, 0xCC0096FB, 0x13C8C2AF, 0x2C52DDCF } },
+	      { { 0x175E8D44, 0xF8EDAF8E, 0xB15446E2, 0x4A988441 } } } } },
+	// (2^100)*B * 2
+	{ { { { { 0xABB2F0F5, 0xBD9B671F, 0x90663892, 0x2851D8BA } },
+	      { { 0x7E7309E3, 0x26805AAB, 0x91C39410, 0x5FB5A29B } } } },
+	  { { { { 0xA04DFD80, 0x0EDB76AC, 0x68BC89FF, 0x386DCABE } },
+	      { { 0x45F28751, 0x654E6199, 0x84631071, 0x4B019192 } } } } },
+	// (2^100)*B * 3
+	{ { { { { 0xB058D811, 0x1F79028C, 0x88711266, 0x6E89D797 } },
+	      { { 0xF1AB48A9, 0x57CDB8F0, 0x898FEF90, 0x64546BB0 } } } },
+	  { { { { 0xA7FEA1F7, 0x3018993B, 0x36E712F2, 0x5B579AAB } },
+	      { { 0x536A1768, 0x998EABB1, 0xCA7CE782, 0x69986D14 } } } } },
+	// (2^100)*B * 4
+	{ { { { { 0xA00772B1, 0x4B2EFA5E, 0x2E084F42, 0x1D472D82 } },
+	      { { 0xA35CA20C, 0x95A78E16, 0x8725C6EF, 0x5028A820 } } } },
+	  { { { { 0xCCBD7633, 0x215F9E4C, 0xFCDFC76C, 0x20D4E875 } },
+	      { { 0x30CACF5C, 0xFFAA9DFA, 0x54195512, 0x626FBAC2 } } } } },
+	// (2^100)*B * 5
+	{ { { { { 0xBF19001B, 0x1B6B2655, 0x61C6E934, 0x2D20A0D8 } },
+	      { { 0x7AD92DE5, 0xE8A11833, 0xEDB1044B, 0x40620B72 } } } },
+	  { { { { 0x432A4554, 0x5EB32EAA, 0xE0BE4764, 0x7744D706 } },
+	      { { 0xCDD1A440, 0x29926B7A, 0x6D036B6D, 0x585F4328 } } } } },
+	// (2^100)*B * 6
+	{ { { { { 0x8D4BF1A0, 0xB4A642B3, 0xD3F43489, 0x67851925 } },
+	      { { 0x5F85B47B, 0x9E8730E3, 0x6CFA7980, 0x7A88F733 } } } },
+	  { { { { 0x90B77613, 0x37D2C070, 0x6252C321, 0x6EB34801 } },
+	      { { 0xE4810412, 0xB11DB60D, 0x77DBCDF3, 0x53326707 } } } } },
+	// (2^100)*B * 7
+	{ { { { { 0xDAFA98FA, 0x5371EE2B, 0xC4218D94, 0x2271062A } },
+	      { { 0x73247AAF, 0xF47D689A, 0xFF526896, 0x39BC5378 } } } },
+	  { { { { 0xD0E34B23, 0x218AD0B7, 0x8D7B0A88, 0x24132545 } },
+	      { { 0x0E3214AA, 0xFB2417AE, 0xB34A0F9D, 0x3C13964E } } } } },
+	// (2^100)*B * 8
+	{ { { { { 0xF41F0295, 0xC2700906, 0x703EE8B6, 0x6F153E8E } },
+	      { { 0x54FF1628, 0xA3105D9C, 0xE5F5ABA0, 0x4D9939AE } } } },
+	  { { { { 0xF216D88C, 0x5E04832C, 0x3C6461BE, 0x30026807 } },
+	      { { 0x4580C415, 0x1C42E81F, 0xCF93BC0E, 0x19E29933 } } } } },
+	// (2^104)*B * 1
+	{ { { { { 0x5751128D, 0xF256B0FB, 0x36E58C5F, 0x0D270A57 } },
+	      { { 0x0EF38F50, 0x403767C6, 0xD9A75D1E, 0x657E1565 } } } },
+	  { { { { 0x4E1B4B26, 0x17481570, 0x79B2582A, 0x30D58050 } },
+	      { { 0x938EB3D9, 0x89B9F17B, 0xF63B2A36, 0x78293A94 } } } } },
+	// (2^104)*B * 2
+	{ { { { { 0xB6098C3E, 0x1209D71A, 0x3FA206A9, 0x7221FAFD } },
+	      { { 0xC3FADC4C, 0x7DAD2F83, 0x1C4E0568, 0x77B85260 } } } },
+	  { { { { 0x90F92C65, 0xBC4ACAB0, 0xE22CD01E, 0x5085D1EC } },
+	      { { 0x5C6A2DA7, 0xC36F72A3, 0xCB9FFDBD, 0x2EC76262 } } } } },
+	// (2^104)*B * 3
+	{ { { { { 0xDEA9FE0F, 0xEE06A1A9, 0xCF950823, 0x658ADD27 } },
+	      { { 0xD63FE0BA, 0x3E059205, 0xAD9066E3, 0x27BC5D60 } } } },
+	  { { { { 0x39AB432B, 0x7682CDC2, 0x0848545F, 0x55EC2537 } },
+	      { { 0xE87E488D, 0xF1BF936E, 0xEFE71C73, 0x09F3CB36 } } } } },
+	// (2^104)*B * 4
+	{ { { { { 0x59872354, 0xC76BD640, 0x3B654C40, 0x7A20EE15 } },
+	      { { 0x4FCD2763, 0x1E9FF6DA, 0xB7E124CA, 0x42D214BD } } } },
+	  { { { { 0xAB408E59, 0x67C87788, 0xAAC2F3FB, 0x1E793F23 } },
+	      { { 0xF8E2FEFD, 0x1093116D, 0xB9BBC5F0, 0x76A26EB4 } } } } },
+	// (2^104)*B * 5
+	{ { { { { 0x6A716D02, 0xF17339A1, 0x74AC1A81, 0x6C6DFB6D } },
+	      { { 0x4FA08317, 0xCFC4F7E9, 0xCE20D4A7, 0x7C9589BD } } } },
+	  { { { { 0x16EA55F4, 0x44A69FAC, 0xBE49FB25, 0x6160A833 } },
+	      { { 0x69C04152, 0xE78B185D, 0x0F7D292E, 0x2E255A78 } } } } },
+	// (2^104)*B * 6
+	{ { { { { 0x8C39EC9D, 0x8D5C9D2E, 0xF7293971, 0x7BDA7EB0 } },
+	      { { 0x347C0A95, 0xFF6367B1, 0x6C154CE4, 0x1362C33C } } } },
+	  { { { { 0x31A0AA87, 0x95DA3499, 0x01A29AF9, 0x35373839 } },
+	      { { 0x99545056, 0x9C939B49, 0xBF1953CF, 0x5B9E374A } } } } },
+	// (2^104)*B * 7
+	{ { { { { 0x40C0E471, 0x97A9BBC0, 0x5D0E8CB9, 0x42AA0EE6 } },
+	      { { 0x756EC260, 0x4B882606, 0x3D3A7B40, 0x04A789E1 } } } },
+	  { { { { 0x08CF50B9, 0xE8C4DF92, 0x0A042709, 0x2C180284 } },
+	      { { 0x239699A8, 0x78B3B6C3, 0xEF3A5CCA, 0x591094A9 } } } } },
+	// (2^104)*B * 8
+	{ { { { { 0x5D14248D, 0x2DC37A61, 0xDA1306E0, 0x0EE30CBB } },
+	      { { 0xF4A2B807, 0x260FD09A, 0x3330AE6A, 0x4C619B79 } } } },
+	  { { { { 0x1BBFE847, 0x39597A90, 0x9844AC39, 0x59D2C588 } },
+	      { { 0x80EF4955, 0x133024D3, 0x313656BD, 0x76EA18BF } } } } },
+	// (2^108)*B * 1
+	{ { { { { 0x97D6B129, 0x5F47DE39, 0x90934026, 0x20984668 } },
+	      { { 0xD7109BC9, 0x2EC83DB0, 0xA9799E8F, 0x7E794454 } } } },
+	  { { { { 0x736EFE29, 0xBFB809A2, 0xB4A470EC, 0x17DA18DF } },
+	      { { 0x86AA6309, 0xC1E4F721, 0xFE52B83C, 0x59814AF5 } } } } },
+	// (2^108)*B * 2
+	{ { { { { 0x9A8E65B5, 0xD90747D5, 0x7210EC6C, 0x7E1BBD7C } },
+	      { { 0x81F907AC, 0x7176D73D, 0x53A341F3, 0x4A833709 } } } },
+	  { { { { 0x126D7B19, 0x25F7C63E, 0xD695AB21, 0x2E776918 } },
+	      { { 0xD3F1128C, 0xFF65667C, 0xFFBD3868, 0x102CD2D3 } } } } },
+	// (2^108)*B * 3
+	{ { { { { 0x3BE6CD7E, 0x4846A1FD, 0x9832042A, 0x77077E6D } },
+	      { { 0xCCFD9EA4, 0xE5B24076, 0x18C7170F, 0x39C93DE6 } } } },
+	  { { { { 0x99268EA4, 0xFA468FFC, 0x128ADC7E, 0x5B4D7BAC } },
+	      { { 0x82459477, 0x1D66F840, 0xE8AD0B3C, 0x081AC22E } } } } },
+	// (2^108)*B * 4
+	{ { { { { 0x199A73DD, 0x53F96F46, 0x51CFD4B8, 0x2B48DFB5 } },
+	      { { 0xECBDD085, 0x84A37948, 0x9CD97B7C, 0x0DC8C2D2 } } } },
+	  { { { { 0xA6B5C5A3, 0x07DA8089, 0x89D075AC, 0x37DC2846 } },
+	      { { 0xA5552C65, 0x72C29D2B, 0x8805CEEA, 0x5557BA7F } } } } },
+	// (2^108)*B * 5
+	{ { { { { 0x0A924A89, 0xE22CF10F, 0x572873BF, 0x0453853E } },
+	      { { 0xB19B72C8, 0x8E04E953, 0xC85E73D8, 0x4BF2920D } } } },
+	  { { { { 0x510DED78, 0x32EAF689, 0xDC6AC5A9, 0x2F1376AA } },
+	      { { 0x9171238F, 0xA5588381, 0x157BEA79, 0x518F209A } } } } },
+	// (2^108)*B * 6
+	{ { { { { 0xB0395FA8, 0x965F3342, 0x3F6217DF, 0x66FCF933 } },
+	      { { 0xF2F78446, 0x21EB9167, 0x41FDEEBD, 0x7DD7644E } } } },
+	  { { { { 0xBEFF4767, 0xC18F1975, 0x3269E0C8, 0x6651E6CB } },
+	      { { 0xCF4D7736, 0xC44289C0, 0x04B5106C, 0x0C6E9C3D } } } } },
+	// (2^108)*B * 7
+	{ { { { { 0xD4236129, 0x37CCACDA, 0xA31B2516, 0x6B6186FF } },
+	      { { 0x4B51A411, 0x07C63EC9, 0x5FACC0BB, 0x0881743B } } } },
+	  { { { { 0xA9A52A54, 0x8BC33BC3, 0x9289C21E, 0x2858972D } },
+	      { { 0x7D4F5307, 0x19CCA89B, 0x5C4BF7B2, 0x626FBFD0 } } } } },
+	// (2^108)*B * 8
+	{ { { { { 0x1DA550FE, 0x5AD961A5, 0xBE4517AB, 0x2A8184DB } },
+	      { { 0xCF9D8B50, 0x09BDD38D, 0xA3F54461, 0x7B743C4E } } } },
+	  { { { { 0x40BD445F, 0xF4CB603F, 0x3A321FFF, 0x23764F12 } },
+	      { { 0x8AA878C1, 0x14067EAA, 0xD0103BD9, 0x595F42AE } } } } },
+	// (2^112)*B * 1
+	{ { { { { 0xD66BA56A, 0xC1F4C633, 0x32533CB0, 0x7D9B1E41 } },
+	      { { 0x7A815900, 0xA8F063FC, 0x90C430AB, 0x2AE42303 } } } },
+	  { { { { 0x418C5E31, 0x9C88AFA1, 0x61408152, 0x7C5EAC42 } },
+	      { { 0x9A33D05D, 0xB59EEFF3, 0x36288A15, 0x2A922A97 } } } } },
+	// (2^112)*B * 2
+	{ { { { { 0xB8DB9C6D, 0x931C8419, 0xD2EF0F7E, 0x4A5AC93A } },
+	      { { 0xD9AEF481, 0xB9E9521C, 0xA16E3943, 0x09666931 } } } },
+	  { { { { 0xBC4DABF3, 0x278865AF, 0x6999A78A, 0x60C0EF4C } },
+	      { { 0x67A2D56F, 0x4C0D0DAC, 0xD04AF633, 0x0A00AB0C } } } } },
+	// (2^112)*B * 3
+	{ { { { { 0xB8EEFD6F, 0xDDDFC57C, 0xABC65840, 0x49A078F7 } },
+	      { { 0x9A0F9FB0, 0xA1F8ED39, 0x1F17E1B4, 0x02AC378C } } } },
+	  { { { { 0x24069D94, 0x18AFB5E3, 0x8D7C904F, 0x419ABF98 } },
+	      { { 0x56779F66, 0x8918CAA7, 0xFF58D5FC, 0x3082A874 } } } } },
+	// (2^112)*B * 4
+	{ { { { { 0x8983088E, 0x66788093, 0x81DEDA98, 0x120E42C2 } },
+	      { { 0xC3F75791, 0x89B9BDB3, 0x7CF831FE, 0x4FD7CC58 } } } },
+	  { { { { 0xEB6DFEF1, 0x14E7BF07, 0x8837D49E, 0x51654F7E } },
+	      { { 0x160EF58E, 0xFE34DDFA, 0x4B6E4E9E, 0x0FA0A648 } } } } },
+	// (2^112)*B * 5
+	{ { { { { 0xE56B95E0, 0x9F07368D, 0x5692A8FD, 0x5F3BF106 } },
+	      { { 0x7E35A689, 0x8B98E41E, 0x49CB6756, 0x221B29D9 } } } },
+	  { { { { 0x49E44F7D, 0x22E6C2AD, 0xF9256E10, 0x48E6BCAC } },
+	      { { 0xA7AE3CB9, 0x167749EE, 0xA8452C87, 0x20307DAC } } } } },
+	// (2^112)*B * 6
+	{ { { { { 0x314930A8, 0xA729913B, 0x2D9351C1, 0x09818428 } },
+	      { { 0xB38B95A1, 0x8E4EE183, 0x89DD53C4, 0x09325D13 } } } },
+	  { { { { 0x45BC16A0, 0x0921260C, 0xCC6F38C8, 0x2FAC10BC } },
+	      { { 0xE27A51BE, 0xE0021878, 0xEC80E8A2, 0x2329C0C1 } } } } },
+	// (2^112)*B * 7
+	{ { { { { 0x2C64FE7D, 0x8CB11D82, 0x437DB362, 0x5C7396E2 } },
+	      { { 0x4C582F34, 0x901EA0EF, 0x53FD55DB, 0x30FFA58F } } } },
+	  { { { { 0x55536293, 0x7814C638, 0x378CBC90, 0x46F5D442 } },
+	      { { 0x3917C055, 0xF06C8D81, 0x6ACE7778, 0x78369F1A } } } } },
+	// (2^112)*B * 8
+	{ { { { { 0xD241D1DA, 0xC1A67FDC, 0x1EBB2337, 0x4922C3E5 } },
+	      { { 0xBC8F3100, 0x586723B1, 0xE06B02BD, 0x338E8FEE } } } },
+	  { { { { 0x8E962BC6, 0x7CEB5378, 0xE5BC30BA, 0x5A84135F } },
+	      { { 0x5DB09F90, 0x0DDC2083, 0x366F4DB8, 0x21324171 } } } } },
+	// (2^116)*B * 1
+	{ { { { { 0xE1CF6C26, 0x4BF70FD1, 0xD5E3EF49, 0x30ED0513 } },
+	      { { 0xE57B8EEF, 0xCB680964, 0xA59D271A, 0x1F5DA4DC } } } },
+	  { { { { 0x23D67017, 0x2A89F068, 0x24DC5776, 0x21050E30 } },
+	      { { 0x0AEA9601, 0xD12B42F5, 0x85C8652D, 0x7CFDDFAE } } } } },
+	// (2^116)*B * 2
+	{ { { { { 0x8311A7A4, 0x8F66AD71, 0x1A3A2216, 0x76A28BFB } },
+	      { { 0x72DDB630, 0xA01DFCDE, 0xDF86E12B, 0x46B820C8 } } } },
+	  { { { { 0x87EC6A46, 0x2DE22347, 0x598EF74D, 0x3CC20439 } },
+	      { { 0x764255F6, 0xD8A2ECB2, 0x91D535EE, 0x1D9395D6 } } } } },
+	// (2^116)*B * 3
+	{ { { { { 0xD3158AAE, 0x38876BA5, 0xBD90CB59, 0x533BADDD } },
+	      { { 0xFC5CB426, 0xCEB73E9F, 0xB95449A0, 0x1D4841C2 } } } },
+	  { { { { 0x2DDFF099, 0xA041606A, 0x16B6B9FF, 0x55D7C65D } },
+	      { { 0x4C36C1AC, 0x908F0838, 0x76B923AD, 0x2233C935 } } } } },
+	// (2^116)*B * 4
+	{ { { { { 0xDBC91012, 0xD970F7C9, 0x855DF444, 0x157A0293 } },
+	      { { 0xFBC087A6, 0xC1A56ACC, 0xEC6C2160, 0x1169B2CB } } } },
+	  { { { { 0x466ED936, 0xD26A8704, 0x613670C3, 0x0F5020FB } },
+	      { { 0xFD2072FC, 0x5B5732B4, 0x01881F46, 0x10559499 } } } } },
+	// (2^116)*B * 5
+	{ { { { { 0xC1CFFFAE, 0x9CAAE33B, 0xB7200D8E, 0x641F9C01 } },
+	      { { 0x17EE4339, 0x3A314A8D, 0x264259A9, 0x77017CF0 } } } },
+	  { { { { 0x9C4A7120, 0xA15347DC, 0x65268110, 0x5A158F96 } },
+	      { { 0x0442E8F1, 0x520E72D8, 0xC1185347, 0x71C55192 } } } } },
+	// (2^116)*B * 6
+	{ { { { { 0xAD57A8BE, 0xA46A1EA5, 0x4A4CBED5, 0x7B3C5797 } },
+	      { { 0xEB53C232, 0x0DD272FE, 0x23B289E0, 0x6E6C3EA4 } } } },
+	  { { { { 0x06255C4A, 0x808EED9E, 0xCC515923, 0x333ECD5C } },
+	      { { 0xB3AD2CCD, 0xC17430FE, 0xAE50AB2D, 0x16FC8ADD } } } } },
+	// (2^116)*B * 7
+	{ { { { { 0xB4E4E396, 0xA4501BCD, 0x6512932A, 0x20DAEA87 } },
+	      { { 0xE27C1BC6, 0x6CCEC504, 0x091241E6, 0x711F126C } } } },
+	  { { { { 0x717F45B3, 0x4EAD92DA, 0x14ACA499, 0x36F94058 } },
+	      { { 0x9D3D146E, 0x6AA8EBB1, 0x57CC398A, 0x56BE2A71 } } } } },
+	// (2^116)*B * 8
+	{ { { { { 0x99066AFE, 0x0A9851F8, 0x030908FB, 0x71A2D885 } },
+	      { { 0x5795F671, 0xE84CF846, 0x89BEDE01, 0x4D8BE6DB } } } },
+	  { { { { 0xC9653171, 0x4B90A6E7, 0xD75F0386, 0x6746E23B } },
+	      { { 0xFD68DDB6, 0x2E4A559A, 0x203C9300, 0x47E40FC2 } } } } },
+	// (2^120)*B * 1
+	{ { { { { 0x98C17BB5, 0x499F2633, 0xD3E18598, 0x7C7C0298 } },
+	      { { 0x0674C6A6, 0x8BB70B90, 0x428D6117, 0x6D1F2DE1 } } } },
+	  { { { { 0xA527F66C, 0x07A87FCC, 0x78BFC8C7, 0x2135E07B } },
+	      { { 0x8E9F71D7, 0x0D8847A9, 0xD8DC2D79, 0x660940FA } } } } },
+	// (2^120)*B * 2
+	{ { { { { 0x09F68D29, 0x343524BD, 0x47B87035, 0x1FE841B5 } },
+	      { { 0xFC8B22BE, 0x45C225BE, 0x4F067580, 0x5731E267 } } } },
+	  { { { { 0x33433E77, 0x28937212, 0xC87E04EC, 0x7AA2C439 } },
+	      { { 0xDC97A8A1, 0x4DE0C4FB, 0x4F507708, 0x60E6B9D7 } } } } },
+	// (2^120)*B * 3
+	{ { { { { 0xD9BF2909, 0x6DB1F987, 0x813E8F50, 0x59016D48 } },
+	      { { 0xD9BB8DDD, 0x2254199E, 0xCAE363C2, 0x52F0FD1F } } } },
+	  { { { { 0xE1B80A37, 0xC156EE45, 0x905B399A, 0x7275341F } },
+	      { { 0x95E2773E, 0x90E19F15, 0x02910DFC, 0x32206996 } } } } },
+	// (2^120)*B * 4
+	{ { { { { 0x9D76EB27, 0x11E48E65, 0x956D925A, 0x111216D5 } },
+	      { { 0x8E219A9B, 0x99D18C7F, 0x1B66783A, 0x211436FD } } } },
+	  { { { { 0x48549B22, 0x37D6463F, 0xDF439ECB, 0x13B3E846 } },
+	      { { 0x044408BA, 0x23643B5D, 0x073A151C, 0x396803F2 } } } } },
+	// (2^120)*B * 5
+	{ { { { { 0xC96C07F3, 0x8D713102, 0x5C6AD7DA, 0x4A2E7AE1 } },
+	      { { 0x197E0351, 0x33AE40B1, 0xD38EB5FE, 0x1AC5AC1E } } } },
+	  { { { { 0xEC633DDA, 0xF73AECB0, 0x22634783, 0x64731652 } },
+	      { { 0x133EDE87, 0x03AF74B5, 0x1D0126DA, 0x5E9FBC7C } } } } },
+	// (2^120)*B * 6
+	{ { { { { 0xEC1E2702, 0x97365172, 0x4F90CD81, 0x5C930B87 } },
+	      { { 0x9E6DBBE0, 0xD9ED2161, 0x550A1A1C, 0x7CE20FE2 } } } },
+	  { { { { 0x5C874B8D, 0xBFF5A7C4, 0xA212C253, 0x1FC0A246 } },
+	      { { 0x3266561E, 0x4BA07D8C, 0xD5308C86, 0x49F93F91 } } } } },
+	// (2^120)*B * 7
+	{ { { { { 0x7F4F2F86, 0x48D0112A, 0xFF2B7ABC, 0x044AE796 } },
+	      { { 0x6556D3C7, 0x05CEA3D7, 0xE3304289, 0x462CB99D } } } },
+	  { { { { 0x753357EE, 0xFAC0A869, 0x3F7CB20F, 0x1C71750E } },
+	      { { 0x18253489, 0xC3D01D8C, 0x636AF2B6, 0x731E9E2F } } } } },
+	// (2^120)*B * 8
+	{ { { { { 0x9868658F, 0x2911FD68, 0xC3138C98, 0x336CCB57 } },
+	      { { 0xC5E26776, 0xB5AD27AD, 0x17255669, 0x68D2B76B } } } },
+	  { { { { 0xAFF81F68, 0xAFB5F906, 0xD78EC7B2, 0x4595701E } },
+	      { { 0xB0C34528, 0xD4E54EA8, 0x8996527A, 0x7105AADC } } } } },
+	// (2^124)*B * 1
+	{ { { { { 0xBE5324D7, 0x03DAF833, 0x27B77600, 0x3E77C178 } },
+	      { { 0xBC2EE009, 0x66BFAE29, 0xFD7AD67B, 0x15B3E19F } } } },
+	  { { { { 0x0C092A82, 0xD8590AA4, 0x57823803, 0x7061820F } },
+	      { { 0xAA3EBE95, 0x65919968, 0xECB68CE4, 0x03646858 } } } } },
+	// (2^124)*B * 2
+	{ { { { { 0x8A3C41FF, 0x95E2C349, 0xB7969697, 0x5AAE301B } },
+	      { { 0x50E22804, 0x31AA7367, 0x68947B0C, 0x6239DE01 } } } },
+	  { { { { 0x5D66B613, 0x720C38C0, 0x6188D5D2, 0x7AD436F1 } },
+	      { { 0xCC0FF6B4, 0x7EA3FBC7, 0x4F57D6E8, 0x556F2957 } } } } },
+	// (2^124)*B * 3
+	{ { { { { 0xD46A57FC, 0x961BB834, 0x168E8BB7, 0x16E62DB4 } },
+	      { { 0xC48D759A, 0xB81DB489, 0x4E2BEAC8, 0x421908EF } } } },
+	  { { { { 0x34DD7DA5, 0x75D94CF1, 0x9A4C1F4C, 0x5A0CE150 } },
+	      { { 0x6E794027, 0x5A2131B9, 0xE34E5C1F, 0x7BFED88C } } } } },
+	// (2^124)*B * 4
+	{ { { { { 0x7F94CE84, 0x1083A33B, 0x2A0D78AB, 0x6147BAF6 } },
+	      { { 0x52EC6A5A, 0x6F8010D1, 0x700EB0B7, 0x092DD525 } } } },
+	  { { { { 0x9BF59925, 0x7280D4E0, 0xA2BB500D, 0x2944933C } },
+	      { { 0x3F5938B4, 0x0408B9FD, 0x4658E5AF, 0x2F75980B } } } } },
+	// (2^124)*B * 5
+	{ { { { { 0xB96008DD, 0x4DA66A6A, 0xDC67654C, 0x7EBB7B2B } },
+	      { { 0xD4D2FB4A, 0x1206F730, 0x7F69146F, 0x3BE80DC8 } } } },
+	  { { { { 0x81A74710, 0xF701CA8D, 0xA90613A5, 0x01B1C201 } },
+	      { { 0x45183A92, 0xACA33748, 0x5143EBE5, 0x044F17A5 } } } } },
+	// (2^124)*B * 6
+	{ { { { { 0x00C68E23, 0xB1889DEB, 0x9237EC8F, 0x5F9B74C1 } },
+	      { { 0xA14E89DA, 0x1511C078, 0xFBEC8F3C, 0x209FAC85 } } } },
+	  { { { { 0xDC19E945, 0x524E33CC, 0xB08F4B0F, 0x1829F4E9 } },
+	      { { 0xDB8B197C, 0x398BC06F, 0xBF635844, 0x52F089FF } } } } },
+	// (2^124)*B * 7
+	{ { { { { 0xED3F21BA, 0xA9EFB15B, 0xFE86486C, 0x22A2FBF6 } },
+	      { { 0xF677C45B, 0x7C67E2BE, 0xD58F8FD5, 0x75BE0BF7 } } } },
+	  { { { { 0x0156BC0B, 0x7CDAFD83, 0xE2F3A79C, 0x6BED4D3B } },
+	      { { 0xF71158F6, 0xAEB76067, 0xB2CC009C, 0x1CFDF0F2 } } } } },
+	// (2^124)*B * 8
+	{ { { { { 0xC5BB956E, 0xCB86D2E5, 0x6FD06281, 0x4C370DB4 } },
+	      { { 0x8BDC5400, 0xE6573E3E, 0x36CD163F, 0x1B6AE82B } } } },
+	  { { { { 0x24604119, 0x9A29A2FD, 0xD4B9E36A, 0x756CCCED } },
+	      { { 0xABFD6F25, 0xCFB7ECEE, 0x6FD5A14F, 0x78EF885F } } } } },
+#endif
+};
+
+/* Odd multiples (2*i+1)*B for i = 0 to 2^(GLS254_VERIFY_GEN_WIN-2)-1
+   (used by signature verification) */
+static const gls254_point_affine PRECOMP_B_ODD[] = {
+	// B * 1
+	{ { { { { 0x326B8675, 0xB6412F20, 0x9AE29894, 0x657CB9F7 } },
+	      { { 0xF66DD010, 0x3932450F, 0xB2E3915E, 0x14C6F62C } } } },
+	  { { { { 0x023DC896, 0x5FADCA04, 0xA04300F1, 0x763522AD } },
+	      { { 0x9E07345A, 0x206E4C1E, 0x2381CA6D, 0x4F69A66A } } } } },
+	// B * 3
+	{ { { { { 0x1889FE19, 0x0BC57355, 0x1393238B, 0x665C451B } },
+	      { { 0x27CA6F4D, 0xE053B1D0, 0x34043EA7, 0x5C27A07D } } } },
+	  { { { { 0xA1F56BB6, 0xFE1E7723, 0x7D15931D, 0x7B780510 } },
+	      { { 0xE184E5DF, 0xAE7D87EF, 0xF11925D5, 0x0F6F5F4E } } } } },
+	// B * 5
+	{ { { { { 0xCF1FAB5F, 0xC715B038, 0x610AD947, 0x0DA235C1 } },
+	      { { 0x7E52B936, 0xD3AC0FF5, 0x42EA1434, 0x7094DAC3 } } } },
+	  { { { { 0x32462848, 0x06A589BB, 0x1566BBAF, 0x0F876725 } },
+	      { { 0x17C2DAAB, 0x9F808AC9, 0x55FE4D2C, 0x32B14A68 } } } } },
+	// B * 7
+	{ { { { { 0xA16EAC69, 0x1F6121CE, 0xBC02778C, 0x19EB28FD } },
+	      { { 0xB2803207, 0x0E86728B, 0xD9893789, 0x03E9B9FC } } } },
+	  { { { { 0x7604ABE1, 0x13DE2DAE, 0xA6611933, 0x5121D6B7 } },
+	      { { 0x9644C754, 0xAFC835F3, 0xE19E6CB3, 0x0A1F6E2D } } } } },
+#if GLS254_VERIFY_GEN_WIN >= 5
+	// B * 9
+	{ { { { { 0x2B7B07D2, 0x444147D3, 0x3AE73AC5, 0x455A5885 } },
+	      { { 0xC3143DC0, 0xA35643E9, 0x03E13B83, 0x2B58E485 } } } },
+	  { { { { 0x6F9404C9, 0x88ED4A7D, 0x4DB7771D, 0x3B0D7C2C } },
+	      { { 0x857B56BE, 0xE61555B4, 0xF2B0ACC8, 0x49E00A9C } } } } },
+	// B * 11
+	{ { { { { 0x8BA89C69, 0x9B9E9704, 0x930A36DC, 0x1F684809 } },
+	      { { 0xFFCD063C, 0x4C41318C, 0x7FD6BD8B, 0x64EB2866 } } } },
+	  { { { { 0x48513CCE, 0x90D3FD07, 0xF6DE8087, 0x58C79A98 } },
+	      { { 0x754630EC, 0x654CADE0, 0x9A86E32D, 0x79883304 } } } } },
+	// B * 13
+	{ { { { { 0x420A1C76, 0x2E5F37C9, 0xB2357F2F, 0x3A7D7C7B } },
+	      { { 0xA907F216, 0xAFB34113, 0x823230DD, 0x3C8E95CB } } } },
+	  { { { { 0x746279A6, 0xCC4F7898, 0xC0119FEC, 0x1AB1756E } },
+	      { { 0xB203CE10, 0xB7793E62, 0x7D57B92B, 0x05E599E3 } } } } },
+	// B * 15
+	{ { { { { 0x5A95E9FB, 0xC964F07A, 0x0F169909, 0x220BD962 } },
+	      { { 0xBB2D3A20, 0xCC1E67CA, 0x9787A5EC, 0x35E2D10E } } } },
+	  { { { { 0x452AB7DE, 0x0C91CE6A, 0x29F38FB7, 0x515E70DA } },
+	      { { 0x5C31A581, 0x57357CA2, 0xFFC32009, 0x790F54EF } } } } },
+#endif
+#if GLS254_VERIFY_GEN_WIN >= 6
+	// B * 17
+	{ { { { { 0xBDF5E996, 0x8ECD1EBC, 0xF3D8C104, 0x1EF0EDE1 } },
+	      { { 0x3EA3ED47, 0x0F08E68B, 0x391C6D8F, 0x56444F11 } } } },
+	  { { { { 0x88CF4D00, 0x6E597155, 0x7ADA6141, 0x06D59250 } },
+	      { { 0x3C569DE3, 0xC2389804, 0x85E66289, 0x2C06EDA5 } } } } },
+	// B * 19
+	{ { { { { 0x48F1055D, 0x815E09E1, 0xCD8EFCC6, 0x1BD2777E } },
+	      { { 0xF17B47BE, 0x739E688B, 0x6AB00788, 0x507BBB0F } } } },
+	  { { { { 0xB7F23854, 0x1FEDD690, 0x7C0E4D21, 0x043A6858 } },
+	      { { 0xC8685447, 0xFADCC1E1, 0x335A64E5, 0x6DE0D655 } } } } },
+	// B * 21
+	{ { { { { 0x023CEF68, 0xB4A9AFFA, 0x39793633, 0x561CE389 } },
+	      { { 0x6300A671, 0x2F95D65D, 0xBB3A3AC3, 0x6FF5B298 } } } },
+	  { { { { 0x6A20C2D4, 0x45BF8E0E, 0xD8A1B574, 0x75E243B3 } },
+	      { { 0x7A419E7B, 0x42299DCD, 0xF34B6433, 0x31669BB4 } } } } },
+	// B * 23
+	{ { { { { 0x6A7BCE67, 0xABA4178C, 0xE69591BC, 0x616D3967 } },
+	      { { 0xFB00BC7F, 0xA01D1158, 0x2D9D4972, 0x5F69BF57 } } } },
+	  { { { { 0xA408E4FF, 0x8D6796E6, 0x4627C9EE, 0x2FAB17E6 } },
+	      { { 0x1E615DA6, 0xF9F7AFB9, 0xFA4A8391, 0x1AF4F37C } } } } },
+	// B * 25
+	{ { { { { 0xF55F5EA7, 0xF09AD6C1, 0x5F27828B, 0x513433D6 } },
+	      { { 0x0B667E0E, 0x43ACBF18, 0x11C98B91, 0x1F4B9268 } } } },
+	  { { { { 0x6F6A21FF, 0xA660B448, 0xC875B21D, 0x3E43AC21 } },
+	      { { 0xD17A867B, 0xEC3972F1, 0x896D2020, 0x77D62B4B } } } } },
+	// B * 27
+	{ { { { { 0xE629E499, 0xFFD4581F, 0x02C372E5, 0x1C58062C } },
+	      { { 0x46DC3B7B, 0xB4039FE5, 0x617AA6C0, 0x635A3992 } } } },
+	  { { { { 0x2A09D214, 0xA8F0EFC8, 0x13CB7A59, 0x58C870CD } },
+	      { { 0x42F0CCBA, 0x12C222C7, 0x2A918811, 0x5960DE8D } } } } },
+	// B * 29
+	{ { { { { 0xCBCCC1BB, 0x5288D324, 0xDF9DC2C5, 0x26755935 } },
+	      { { 0xABF9B08C, 0x280EF6F5, 0x6BEC179F, 0x08929DE8 } } } },
+	  { { { { 0x9C910E6C, 0xF79D80E1, 0x4D8E51D1, 0x10C39530 } },
+	      { { 0x049B7FC9, 0x264998F5, 0xD5CC3A4B, 0x5CECC094 } } } } },
+	// B * 31
+	{ { { { { 0x761DC813, 0xCA94B510, 0xBB2C62D6, 0x106CA94E } },
+	      { { 0x377423AC, 0x282E19EB, 0x3B43EE0F, 0x4DA9316B } } } },
+	  { { { { 0x12A6A5AD, 0xB31C8887, 0x2C7C635F, 0x169F46EB } },
+	      { { 0x63D7F976, 0x5AEF90CC, 0x16CCBAD8, 0x3007DD12 } } } } },
+#endif
+#if GLS254_VERIFY_GEN_WIN >= 7
+	// B * 33
+	{ { { { { 0xB664EF89, 0x245F8B7D, 0x35C8B083, 0x4A24CA94 } },
+	      { { 0xA750A47D, 0x94CFD27E, 0x0EC7C6D0, 0x3C63259B } } } },
+	  { { { { 0x3E8CAFE9, 0xA8B90296, 0xE3A21C0E, 0x0AF0D71F } },
+	      { { 0x18FCF9A7, 0x054D82FB, 0xD247FAB9, 0x7929412F } } } } },
+	// B * 35
+	{ { { { { 0xCE5AF1A8, 0x4C02A731, 0xA20361F2, 0x3B8708A3 } },
+	      { { 0x98FD2703, 0xD38039B4, 0xC1FDD3BB, 0x0E745077 } } } },
+	  { { { { 0x5E309C9A, 0x7C845D12, 0xA6D7718A, 0x0C540A8E } },
+	      { { 0xF733C832, 0xA7E2E5F5, 0xE94A3E49, 0x27798837 } } } } },
+	// B * 37
+	{ { { { { 0xC3757DA0, 0x3E7B90C8, 0x445E46DC, 0x0C9924E5 } },
+	      { { 0xDC015BD1, 0xDAEE7F48, 0xC50B275D, 0x751AF5F1 } } } },
+	  { { { { 0x2AD73612, 0x7FE77FCA, 0xB8164000, 0x4D13BEEE } },
+	      { { 0xE43AA1F6, 0x006D00E0, 0x96B3A7DB, 0x48B22E9E } } } } },
+	// B * 39
+	{ { { { { 0x85658334, 0xF8A0A4B1, 0x8D36587D, 0x3CCA7C0C } },
+	      { { 0x6450D9FC, 0x62F02259, 0x80BCD52F, 0x3EBC9787 } } } },
+	  { { { { 0x61504D54, 0x2E5953AD, 0x9F93D6CA, 0x00DAF27D } },
+	      { { 0xF5C5C1E0, 0x166D6B9C, 0x0083935E, 0x479B1407 } } } } },
+	// B * 41
+	{ { { { { 0xA75FB2D2, 0x3396085C, 0xE7B63B6B, 0x332BB5D2 } },
+	      { { 0x305D0233, 0xC04956E8, 0x5A19608F, 0x7976593C } } } },
+	  { { { { 0x8E58927F, 0x29BBA3B3, 0x36027F1A, 0x030A1741 } },
+	      { { 0xDEF0422B, 0x9CE3C97B, 0x2440AA1E, 0x1D4E297A } } } } },
+	// B * 43
+	{ { { { { 0xBE7C8EF2, 0x07F4A898, 0x2817849F, 0x64C871B1 } },
+	      { { 0xB08995E5, 0xB4632C58, 0x65299495, 0x3B5F7DF5 } } } },
+	  { { { { 0x61154225, 0xF7A4291E, 0x32FDADC8, 0x6D61C484 } },
+	      { { 0xFD3AB1EC, 0x7B5580D8, 0x4EDC1FE8, 0x18AD87F0 } } } } },
+	// B * 45
+	{ { { { { 0x94FF9016, 0xE3A2A2D2, 0x4CC6A929, 0x28BF776A } },
+	      { { 0x7DEF6A24, 0x7220BEB7, 0x3A51211E, 0x763906EB } } } },
+	  { { { { 0x18A5DC71, 0x141BB221, 0x66C02AB8, 0x06BB7961 } },
+	      { { 0xC120E0BC, 0x080A9477, 0x59FA9307, 0x75C0D802 } } } } },
+	// B * 47
+	{ { { { { 0x0FCA134D, 0x9559E3CA, 0xDEBCD7A1, 0x38A6746C } },
+	      { { 0x76CCFA0E, 0x36DB472E, 0x84BB002E, 0x3711B668 } } } },
+	  { { { { 0x81F5AB76, 0x46C084A9, 0xD6351879, 0x4D73045C } },
+	      { { 0x3A19FC1C, 0x262DCAEB, 0xDD0D776C, 0x7831369F } } } } },
+	// B * 49
+	{ { { { { 0x92602E83, 0xCD2A7867, 0xFD28DFC4, 0x0061F6F7 } },
+	      { { 0x8DD5D358, 0x8640E681, 0xF508A3E8, 0x23F0E8AB } } } },
+	  { { { { 0x287CCFB1, 0x16ECEC56, 0xCBB369A9, 0x148A6A66 } },
+	      { { 0xB20543D0, 0x319E3E03, 0xC67494B8, 0x4EAB4107 } } } } },
+	// B * 51
+	{ { { { { 0xE4D1E1EC, 0xD313B59C, 0x44DE4519, 0x635C92CF } },
+	      { { 0x5AD4FE99, 0x0EDE9F0F, 0xACDFC20E, 0x6E97193A } } } },
+	  { { { { 0x7EF4B8D4, 0xCBDB4726, 0x546339AF, 0x137E73A4 } },
+	      { { 0x3CBA5505, 0x8C3C635D, 0xBF580623, 0x0ECCF84E } } } } },
+	// B * 53
+	{ { { { { 0xCE4D0C54, 0x1A468C61, 0xF9DA5D3B, 0x38678EF1 } },
+	      { { 0x98649730, 0x8DB8C5E5, 0x898DB75F, 0x29ADAF88 } } } },
+	  { { { { 0x8A034D00, 0xEC9C697C, 0x68B39AC6, 0x1351ABFB } },
+	      { { 0xC07AF3D2, 0xE4F9AA79, 0xB6E4C473, 0x645EA90D } } } } },
+	// B * 55
+	{ { { { { 0xB8B2739A, 0xA307F03A, 0xEBC29EFB, 0x31F39D71 } },
+	      { { 0x1A253250, 0x36391A87, 0x6E227547, 0x40CA0F49 } } } },
+	  { { { { 0x8DF46E83, 0x8AC2125A, 0x06F4662A, 0x0C492A00 } },
+	      { { 0x1410AC35, 0xBE4121C5, 0xC54DA133, 0x461E7CE9 } } } } },
+	// B * 57
+	{ { { { { 0x801F941B, 0x883975CE, 0x6CF0239A, 0x0751E8C4 } },
+	      { { 0xEA4A8112, 0x6C8BA62C, 0x16DA76C2, 0x1A2752CB } } } },
+	  { { { { 0x03DA19E4, 0x82D92A90, 0x3850312D, 0x7CAD0AE2 } },
+	      { { 0xCD11F2D4, 0xEF0667A7, 0x658A0EA2, 0x5452398E } } } } },
+	// B * 59
+	{ { { { { 0x82F5A819, 0x6054A44C, 0x88A6CC8A, 0x51B4D099 } },
+	      { { 0x920C0B92, 0x38AFD00D, 0x0C76CDEE, 0x75834745 } } } },
+	  { { { { 0xC9667C96, 0x91FD1A4B, 0x609F0036, 0x152829D7 } },
+	      { { 0x68753D99, 0xAACA5DA8, 0x931D35B0, 0x7A4A22FB } } } } },
+	// B * 61
+	{ { { { { 0xB154ECC3, 0x1D40DD46, 0x2EB00986, 0x0788DBFB } },
+	      { { 0x689D39BF, 0x9F9705D3, 0xEDA7843D, 0x600F4AB7 } } } },
+	  { { { { 0x88527885, 0x6402BE4C, 0x703D2381, 0x780DB61B } },
+	      { { 0xF5EAD82B, 0xE4ECDCF6, 0xA59F0B7B, 0x562B092C } } } } },
+	// B * 63
+	{ { { { { 0xC177CE0B, 0xB33232CB, 0xB0ACDE7C, 0x578182AF } },
+	      { { 0xB1050654, 0x9051A8C5, 0x27D46EC4, 0x65168C65 } } } },
+	  { { { { 0x68BD9035, 0x975E0C6B, 0xB4318DE1, 0x1C240722 } },
+	      { { 0xB6EABB33, 0xF11F4E3C, 0x443EDA23, 0x52B92695 } } } } },
+#endif
+#if GLS254_VERIFY_GEN_WIN >= 8
+	// B * 65
+	{ { { { { 0x61603222, 0x447F01B0, 0x96446D70, 0x30F2F489 } },
+	      { { 0x94B2360E, 0x09BDE5E6, 0x8AC214C2, 0x3765A14D } } } },
+	  { { { { 0x5DAA62BF, 0x1154649C, 0x4A816643, 0x1F42BD82 } },
+	      { { 0x5004BE29, 0xC8FAD7E0, 0xC5D84A51, 0x4E4E97F3 } } } } },
+	// B * 67
+	{ { { { { 0x35332FC6, 0x3148E2CA, 0xC677738D, 0x2A90F222 } },
+	      { { 0x1FD718CD, 0xACC65177, 0xA51D1AAD, 0x6A106F9A } } } },
+	  { { { { 0xB5137423, 0xE3FC2C53, 0xF5B7A406, 0x6C56DA6C } },
+	      { { 0x1EE9945D, 0xDA57B267, 0x80C834C9, 0x637D21B1 } } } } },
+	// B * 69
+	{ { { { { 0x75E7C4E4, 0x128BFC91, 0x07321EBE, 0x5C7BB618 } },
+	      { { 0x7F07ABFC, 0xD84727AA, 0x7362FE51, 0x63EC1349 } } } },
+	  { { { { 0x35D76EDB, 0x6EEC0044, 0x8252131C, 0x010AD460 } },
+	      { { 0x56113895, 0x930B9D95, 0x33BA21C0, 0x76767FBF } } } } },
+	// B * 71
+	{ { { { { 0xAF11C715, 0x287829A0, 0xA2341E0C, 0x04AE4BBA } },
+	      { { 0x446BA96F, 0x7B1DD08A, 0x45F63192, 0x6117C2F7 } } } },
+	  { { { { 0x2526BAD8, 0x338A01AC, 0x4B95B4A0, 0x62173E48 } },
+	      { { 0x524283A4, 0xFAFD360C, 0x52F39D4E, 0x579FA8EE } } } } },
+	// B * 73
+	{ { { { { 0xFDC2CC9B, 0x5EF0AD93, 0x19EA2624, 0x50361935 } },
+	      { { 0x25EC36EF, 0x23A4CEB8, 0x28CA73C1, 0x72431B9D } } } },
+	  { { { { 0x4FC2621A, 0xB4D7499E, 0x6F783678, 0x2C95DA3C } },
+	      { { 0x4C6822FC, 0x021E0701, 0x7EE1FFD9, 0x495D4687 } } } } },
+	// B * 75
+	{ { { { { 0xA8AC0779, 0xBAF50BD0, 0xABE0D97B, 0x0B4C8C9A } },
+	      { { 0x2708F24E, 0xD8968A4F, 0x0E4B7937, 0x044CD78E } } } },
+	  { { { { 0xE2E03E2E, 0x9D06C4C9, 0x0BAA858F, 0x6D5BAB5B } },
+	      { { 0xB5FD1483, 0x5186681E, 0x7060E8D3, 0x088C0B10 } } } } },
+	// B * 77
+	{ { { { { 0xFCBDF5C0, 0xCB5D4522, 0xF323C79E, 0x7BA1758F } },
+	      { { 0x5A9FCBCD, 0x4C063A64, 0x9E7C27C2, 0x0054B394 } } } },
+	  { { { { 0xF8545AB2, 0x822C709D, 0x646FDA25, 0x46C89E99 } },
+	      { { 0x3887536A, 0xF61009BC, 0x0D86F42A, 0x712FCE5D } } } } },
+	// B * 79
+	{ { { { { 0xD3714370, 0x5C8446B8, 0x91098051, 0x3E0F8581 } },
+	      { { 0xF81A22AA, 0x2BDAEC1A, 0x47F7216D, 0x76FFF70B } } } },
+	  { { { { 0x4BDEB346, 0x2B9E24C6, 0x8EB00591, 0x48D43918 } },
+	      { { 0xF182307E, 0xCA1AA20C, 0x27E7D142, 0x55C0EC97 } } } } },
+	// B * 81
+	{ { { { { 0x3BFCD0EB, 0x76D40A23, 0xAA3216B9, 0x567C6ED0 } },
+	      { { 0x82507FA3, 0x37EA174B, 0x2D0B225C, 0x768A5FFA } } } },
+	  { { { { 0xB026D2D5, 0x93D09779, 0xE6FA8C04, 0x223EE0EF } },
+	      { { 0xDB67AAA3, 0x55D1A96D, 0x455EDAFE, 0x61340C45 } } } } },
+	// B * 83
+	{ { { { { 0x2EB570FE, 0xDF42F601, 0x799731F2, 0x43795C9D } },
+	      { { 0x80BD3320, 0x62C3AFD8, 0x8428A1C5, 0x54DA5947 } } } },
+	  { { { { 0x4FEBDBB1, 0x93DEDA8F, 0x500456B5, 0x62AEFB48 } },
+	      { { 0x283357CC, 0x8066EE66, 0x3265D10F, 0x43F89998 } } } } },
+	// B * 85
+	{ { { { { 0xB7F311E4, 0x358EF767, 0x36EB13F0, 0x2598C78C } },
+	      { { 0x7A8AB369, 0xEB2DDC9F, 0xD682874E, 0x319093B0 } } } },
+	  { { { { 0xC982306A, 0x12AB2032, 0x293C99BD, 0x32C2DE8E } },
+	      { { 0x1B330BF6, 0x431831F7, 0x6B094CF2, 0x2D91DF44 } } } } },
+	// B * 87
+	{ { { { { 0x255486D5, 0x9C929778, 0xC129BD93, 0x76CC55D8 } },
+	      { { 0x501DB50D, 0xF09956B0, 0x66E1BAED, 0x5552A894 } } } },
+	  { { { { 0x0AE20492, 0x2F00E671, 0xD3D8BAE2, 0x2D9DA662 } },
+	      { { 0x7EEA4E10, 0xC9AF4CD4, 0x90897E3C, 0x1EEB6BB1 } } } } },
+	// B * 89
+	{ { { { { 0xF7A59F55, 0x331330DD, 0x0DECE7A4, 0x20B73F15 } },
+	      { { 0x5E87A347, 0x280E0D3E, 0x599CF144, 0x6D3986DB } } } },
+	  { { { { 0xD0435CC2, 0x5B319E5B, 0x2EB81AE2, 0x61CCAC89 } },
+	      { { 0xAE383766, 0xE3257628, 0xC333E75D, 0x3D512FCB } } } } },
+	// B * 91
+	{ { { { { 0xE141815E, 0x7670F33B, 0xB3AD60B6, 0x6AB53269 } },
+	      { { 0xCD8B5303, 0x4583CD8F, 0x9AAF1A99, 0x6A80AEF1 } } } },
+	  { { { { 0xAF884821, 0x6C77C075, 0xAB842E0A, 0x0026F4B9 } },
+	      { { 0x27568CA9, 0x598BBDCB, 0xFD92E852, 0x1CFB88A2 } } } } },
+	// B * 93
+	{ { { { { 0x127C6726, 0xFA6BD19C, 0xE1C2F6F7, 0x3BED2550 } },
+	      { { 0x275A67A0, 0xC5D08291, 0x46DAE884, 0x0261BC43 } } } },
+	  { { { { 0x78F5BE72, 0x39072947, 0xBCC81203, 0x4AC879AC } },
+	      { { 0xC44106F3, 0x272C3540, 0x11E8F6DC, 0x7E0D765E } } } } },
+	// B * 95
+	{ { { { { 0x7103F623, 0x14CABE4D, 0xAFD74EB8, 0x1FC16F2A } },
+	      { { 0x486EEB66, 0x9227496D, 0xBAE0BFCA, 0x729EE720 } } } },
+	  { { { { 0xA44B034E, 0xB4CC5C98, 0x1E8B99F0, 0x523DBFE5 } },
+	      { { 0x68BFC12D, 0xD7C421AB, 0xE64BC68D, 0x19BC2C52 } } } } },
+	// B * 97
+	{ { { { { 0x95F68876, 0xB80A0729, 0x92DFC4B2, 0x412CFBEA } },
+	      { { 0x5C94B0EF, 0x6E7A8A9B, 0xCF3EF3D3, 0x4041EB7D } } } },
+	  { { { { 0x7E8DCB26, 0x36BE2907, 0xD73021F1, 0x309140DB } },
+	      { { 0xD047813A, 0xE0475FFE, 0x351E76F5, 0x69E870C4 } } } } },
+	// B * 99
+	{ { { { { 0xC5BD50B3, 0x0158CF6F, 0x532AC887, 0x4B9A6D04 } },
+	      { { 0xAD6F4654, 0x8D402538, 0xF163E0E8, 0x76E0D247 } } } },
+	  { { { { 0x5F96C9F3, 0xD458FFA2, 0xF7847F7B, 0x2C4748A3 } },
+	      { { 0x81EA3E5C, 0x66D804AD, 0xF22E93FB, 0x7CB5896F } } } } },
+	// B * 101
+	{ { { { { 0x6ABCB5C2, 0xFEF06CC5, 0xC1CBAD22, 0x30412AF6 } },
+	      { { 0x928A42EA, 0xB9482F20, 0xFE923D46, 0x44611CA4 } } } },
+	  { { { { 0x682EB9E5, 0x5FDBCB91, 0x0FE0DF0F, 0x6AFEAB21 } },
+	      { { 0x58F5210C, 0x5C70F293, 0x14172720, 0x5D6D6B44 } } } } },
+	// B * 103
+	{ { { { { 0x5D9ACF1B, 0x7ADD02B5, 0x190B3AFF, 0x12886560 } },
+	      { { 0x292BB14B, 0x88D346E7, 0x0E509AD4, 0x2D03A873 } } } },
+	  { { { { 0xF5438C69, 0x84F731ED, 0x3B45E5F9, 0x783F2C4D } },
+	      { { 0xADD1DC13, 0x2AFF1FA1, 0x971997AD, 0x319CA15F } } } } },
+	// B * 105
+	{ { { { { 0xF83171E2, 0x248BCB8D, 0xF833303A, 0x47442CCB } },
+	      { { 0xC52C4C64, 0x50CFA482, 0x707BDCEA, 0x30578261 } } } },
+	  { { { { 0xB52B9C7A, 0x2E6F1538, 0x8A149B1B, 0x0FC59A07 } },
+	      { { 0xFCF19ACF, 0xE15713AE, 0x990A3448, 0x40A3B618 } } } } },
+	// B * 107
+	{ { { { { 0xFBE9EEB3, 0x4CC527AC, 0x26B983F8, 0x34C779D1 } },
+	      { { 0x58D2AC3C, 0xBEED465B, 0x48B1AD93, 0x18B8894B } } } },
+	  { { { { 0x3B18FD98, 0xB911FD03, 0x5A6E0B5B, 0x5C506648 } },
+	      { { 0x477FDAFE, 0x42AD39DC, 0xE93A5DB1, 0x6379D769 } } } } },
+	// B * 109
+	{ { { { { 0xE6A91AD0, 0x5D15C7EE, 0x21D01893, 0x4FFF11DC } },
+	      { { 0xCFAC2653, 0xB48C1600, 0xB0A8228A, 0x4BABD0FD } } } },
+	  { { { { 0xCE49A499, 0x74292361, 0xC371E9EF, 0x6DF0680A } },
+	      { { 0xE63F7BF3, 0xA6E8C056, 0x12A741D8, 0x33712EAE } } } } },
+	// B * 111
+	{ { { { { 0x0FC988F2, 0xF6D1E83B, 0xE9FA8121, 0x43F7F855 } },
+	      { { 0x899C3837, 0xE06797F2, 0x7D204A1D, 0x2722A7DA } } } },
+	  { { { { 0xD9D3A7BB, 0x0B09972A, 0xC4475FFE, 0x66CD4C1E } },
+	      { { 0x9F7A9BA2, 0xDEE97C01, 0x08C1155B, 0x6A30D44C } } } } },
+	// B * 113
+	{ { { { { 0x37A51414, 0x3DF7BAEB, 0x2C75C77D, 0x333A3743 } },
+	      { { 0x30CC1161, 0xE78A321B, 0x09DCFE04, 0x2C8F0079 } } } },
+	  { { { { 0xB857C428, 0xF18C8477, 0x54073CA3, 0x4FE08B5E } },
+	      { { 0x0FB59789, 0x95640AB0, 0x0CA71EBF, 0x6DC182AA } } } } },
+	// B * 115
+	{ { { { { 0x0F33D327, 0xAC85707D, 0x454C6F24, 0x5FF5BBB6 } },
+	      { { 0x57EF1281, 0x3D487944, 0x6D3D79A7, 0x131C5BFC } } } },
+	  { { { { 0x364F12BE, 0xDDF70938, 0x4C34653E, 0x367ADE89 } },
+	      { { 0xA20F7AE5, 0x6DBB6359, 0xE0E398B3, 0x69D00AA9 } } } } },
+	// B * 117
+	{ { { { { 0xA5DE6A57, 0xF8C454F6, 0x5AB53EE7, 0x147243A9 } },
+	      { { 0xA20A716D, 0x29D3698A, 0x15977E74, 0x6D587FBE } } } },
+	  { { { { 0x2C7C1ACA, 0x346EC2E3, 0x871C0736, 0x0CC31803 } },
+	      { { 0x08CD91F2, 0xD6113B48, 0xAD046E69, 0x0426B684 } } } } },
+	// B * 119
+	{ { { { { 0x353E7CD9, 0x8A672E0C, 0x00BFB146, 0x50DFD1EE } },
+	      { { 0x3C9490EF, 0x867D87E3, 0x7E8EA3C3, 0x7ADB969B } } } },
+	  { { { { 0x2B24389F, 0x765DA20A, 0x6424F316, 0x43DEC73A } },
+	      { { 0xA0ED949A, 0xDFB57682, 0x223C10CA, 0x38C012E9 } } } } },
+	// B * 121
+	{ { { { { 0x778370BA, 0x27404C52, 0x1B422FE0, 0x3100811E } },
+	      { { 0x85787A9D, 0xEB9A5BD7, 0xFB75F820, 0x4A755094 } } } },
+	  { { { { 0xFC9FC111, 0xA9727594, 0x402D0764, 0x36171195 } },
+	      { { 0x1052AC01, 0x38E993DC, 0x634D25E3, 0x64CB054B } } } } },
+	// B * 123
+	{ { { { { 0x92216DE1, 0x39ED5FF4, 0x2F768505, 0x37A84BB2 } },
+	      { { 0x00728BF3, 0x5F922AC6, 0x5D9D5EF0, 0x57B776F0 } } } },
+	  { { { { 0xD0ECC5F8, 0x7427A77B, 0x06BF46DC, 0x04B08894 } },
+	      { { 0xDF21AB40, 0x61905C54, 0x90B4D590, 0x2E4C98D7 } } } } },
+	// B * 125
+	{ { { { { 0xBA129CBA, 0x4702CEA0, 0xF3F449F6, 0x2278EAE0 } },
+	      { { 0x397C7631, 0x6516B58B, 0x4E4A1857, 0x050F0AB2 } } } },
+	  { { { { 0xF50C565B, 0x2B3E9380, 0xDC4BAA93, 0x6911E88E } },
+	      { { 0xF7DB0ACB, 0x32CB41F8, 0xF6885F8F, 0x337A0DDE } } } } },
+	// B * 127
+	{ { { { { 0x5AC3295C, 0xA81712F9, 0x82E01D04, 0x490C97D4 } },
+	      { { 0x908A93E4, 0xCF4C4268, 0x9D171142, 0x7D91020B } } } },
+	  { { { { 0xF749F76B, 0x0F84CE2D, 0x9A851139, 0x7FFC46A1 } },
+	      { { 0x230C78EF, 0x716CC9FD, 0x6D30B62D, 0x62A6E4E1 } } } } },
+#endif
+};
+
+/* Odd multiples (2*i+1)*(2^64)*B for i = 0 to 2^(GLS254_VERIFY_GEN_WIN-2)-1
+   (used by signature verification) */
+static const gls254_point_affine PRECOMP_B64_ODD[] = {
+	// (2^64)*B * 1
+	{ { { { { 0x4D3AE7AC, 0x26123159, 0x28CEB8AD, 0x082A5BBF } },
+	      { { 0x83030F30, 0xD959B911, 0x5AF1898E, 0x4447B9E0 } } } },
+	  { { { { 0x4D3DE629, 0x2C7A5450, 0xA6F9484C, 0x431796A3 } },
+	      { { 0xE5D3C8CD, 0x357D7D22, 0xE5323C2E, 0x147CCFFB } } } } },
+	// (2^64)*B * 3
+	{ { { { { 0xF0350244, 0x27C990FF, 0x857F7525, 0x18A5BC91 } },
+	      { { 0x79997083, 0x6004C035, 0xE0E1B992, 0x1744491A } } } },
+	  { { { { 0x17682DD3, 0x9C8593D7, 0x84AE8661, 0x402364E0 } },
+	      { { 0xB2E2B9F3, 0x20F86314, 0x4D9B1FB5, 0x545AF79A } } } } },
+	// (2^64)*B * 5
+	{ { { { { 0x448B153F, 0x5FBA8828, 0x9A0F0423, 0x01E91ADB } },
+	      { { 0x4BFABFFD, 0x1441B534, 0xA4E2D56F, 0x6D0A611A } } } },
+	  { { { { 0xC6ED13FE, 0x67C71E1C, 0xA6321549, 0x4DEFBBD5 } },
+	      { { 0x5515923F, 0xA187801F, 0xB7921BE3, 0x5FAD2693 } } } } },
+	// (2^64)*B * 7
+	{ { { { { 0x41DBB5A8, 0x0A58149A, 0x1073E8F8, 0x106DF92D } },
+	      { { 0x493E86B2, 0x197899FC, 0x2197B358, 0x2E0E05CE } } } },
+	  { { { { 0x709BC381, 0x2D603F9B, 0xA19EED77, 0x26507080 } },
+	      { { 0x1A0926FE, 0x5D86707B, 0x55F08B86, 0x2C55B877 } } } } },
+#if GLS254_VERIFY_GEN_WIN >= 5
+	// (2^64)*B * 9
+	{ { { { { 0x5372BF4B, 0x9D4267FD, 0x81A2230D, 0x7ADBD09A } },
+	      { { 0xF26B0B53, 0x409F65E3, 0xE2B81969, 0x621FDF7B } } } },
+	  { { { { 0x197BCD33, 0x381F48DA, 0x49766FBA, 0x3CB356E2 } },
+	      { { 0x85375DBE, 0x22B3E63A, 0x13028B2B, 0x0E8C9865 } } } } },
+	// (2^64)*B * 11
+	{ { { { { 0xE70D821B, 0x447D2605, 0xB9991A0A, 0x5D13DF4B } },
+	      { { 0xB3E24B02, 0x5D876521, 0xFA6D19EC, 0x42EBE4C9 } } } },
+	  { { { { 0x09631F5C, 0x7AE8E2EC, 0x28D76AE8, 0x36541F0C } },
+	      { { 0x79137BCD, 0x36D2AA93, 0x4ABD7BA9, 0x70271702 } } } } },
+	// (2^64)*B * 13
+	{ { { { { 0x305111C0, 0x61E4DEAA, 0x56DC5AB8, 0x0E0124F0 } },
+	      { { 0x9E0F6F09, 0xA6214BC0, 0xC1441C53, 0x36FCE576 } } } },
+	  { { { { 0x94841F30, 0x614E7C91, 0x71DA3F8A, 0x03CA8341 } },
+	      { { 0xE5429209, 0x4950ACCC, 0x6B1588C7, 0x72851A34 } } } } },
+	// (2^64)*B * 15
+	{ { { { { 0x3CE2F58B, 0xFAD18940, 0xAE009098, 0x1A18CDAF } },
+	      { { 0xA287AFDD, 0x9B6F3F02, 0x1F6ED85D, 0x7EA950BF } } } },
+	  { { { { 0x220DBF4D, 0xF595EBA7, 0x4CC9ECFF, 0x59515650 } },
+	      { { 0xAE390285, 0xAFDA55B4, 0x529DCCE7, 0x77D053B4 } } } } },
+#endif
+#if GLS254_VERIFY_GEN_WIN >= 6
+	// (2^64)*B * 17
+	{ { { { { 0xF44515D7, 0x1C72734D, 0x3D3A0763, 0x64E18062 } },
+	      { { 0x40E809B5, 0x6ABCB639, 0xAF7B6B4F, 0x12AA371F } } } },
+	  { { { { 0x63629FE3, 0xC1706DD5, 0x47D3083C, 0x4D59A92A } },
+	      { { 0x322915BF, 0x7FC71ADD, 0x2CF90575, 0x64F4BF15 } } } } },
+	// (2^64)*B * 19
+	{ { { { { 0xB5A248C7, 0x02D3B799, 0xD79155D1, 0x61400390 } },
+	      { { 0x7CC83F38, 0x71ABA9B4, 0x1DBA35CB, 0x46AD4AC2 } } } },
+	  { { { { 0x9821AC31, 0x26CFBE8A, 0xB757944D, 0x52DA9F83 } },
+	      { { 0x0DB74B34, 0x9F43752F, 0x25533249, 0x2772C467 } } } } },
+	// (2^64)*B * 21
+	{ { { { { 0xAF121ABE, 0xCECEC2DE, 0x1A8EC8B8, 0x4CB94C54 } },
+	      { { 0x55489EFE, 0xDC1505C6, 0xCD636A4C, 0x3FECD00C } } } },
+	  { { { { 0xB21A1FFC, 0xE12FF616, 0x5844400D, 0x7EDDB8B0 } },
+	      { { 0x7A5CADDE, 0x8D83F7C2, 0x97EC98B6, 0x788BE309 } } } } },
+	// (2^64)*B * 23
+	{ { { { { 0xDECFB14D, 0x7AC095C3, 0x23BF3A6E, 0x49EC63A2 } },
+	      { { 0x945CDBAB, 0xAE70F4C3, 0xBA20886E, 0x709BA853 } } } },
+	  { { { { 0xD9F407B6, 0x1A7337F2, 0xA733F7EA, 0x0EE7104A } },
+	      { { 0x20F26941, 0x17A2374A, 0x9B6DE257, 0x30B48F08 } } } } },
+	// (2^64)*B * 25
+	{ { { { { 0x8A702CCA, 0x9F0E017D, 0x3AAF869F, 0x0F4228D7 } },
+	      { { 0x200EAD06, 0xFBA5A438, 0x130C0DEE, 0x024F68C4 } } } },
+	  { { { { 0x4E58B874, 0x14C9A178, 0x13A93A82, 0x57459822 } },
+	      { { 0xFAEF960D, 0x01110460, 0xAB8E45B7, 0x0E75408E } } } } },
+	// (2^64)*B * 27
+	{ { { { { 0x0474F0B8, 0xCBB59774, 0x18D4BBC2, 0x4EC31813 } },
+	      { { 0x5235839E, 0x7936E681, 0x6F9055C9, 0x0BEB5CCF } } } },
+	  { { { { 0x1ACB0B5F, 0xAB3DEC6B, 0xF0625EDA, 0x65A20A0D } },
+	      { { 0x86586C63, 0xE5B74AB4, 0xC918ED8B, 0x57DDA78F } } } } },
+	// (2^64)*B * 29
+	{ { { { { 0x934C1314, 0x4758C394, 0x69352C30, 0x0068B277 } },
+	      { { 0xD3177388, 0xF9528538, 0x36FF0C9A, 0x71234822 } } } },
+	  { { { { 0xE812C357, 0xEDA8CAAB, 0x3EC858A2, 0x08DBADB3 } },
+	      { { 0x35A8FBE8, 0x6A3E33A0, 0x0BEDA6C4, 0x20F9B55B } } } } },
+	// (2^64)*B * 31
+	{ { { { { 0xAC73A52C, 0xF7B7F9EC, 0x7718AF8D, 0x57BEF2BD } },
+	      { { 0xB4B7A105, 0x8BEBD779, 0x25C4ACA2, 0x05347EB7 } } } },
+	  { { { { 0xB4491BD9, 0x0C7E37D2, 0xC1358BC0, 0x7B543C90 } },
+	      { { 0x7F605107, 0x6EC4B455, 0x464C14B9, 0x19AABF45 } } } } },
+#endif
+#if GLS254_VERIFY_GEN_WIN >= 7
+	// (2^64)*B * 33
+	{ { { { { 0x27F74752, 0x453D4F6C, 0xDA974770, 0x584E4903 } },
+	      { { 0x106B7AE5, 0x26A9AD84, 0xD102C89E, 0x41826E9D } } } },
+	  { { { { 0xC2324178, 0xCA024FEC, 0xB0A75E36, 0x6597641E } },
+	      { { 0x049CD55B, 0xAD016985, 0xB88DA5B6, 0x69B1EFAF } } } } },
+	// (2^64)*B * 35
+	{ { { { { 0x960A2114, 0xC23A541F, 0x7D291D43, 0x109DEF72 } },
+	      { { 0x12DD3F53, 0x3DC73C87, 0x15E4F331, 0x50EF54F9 } } } },
+	  { { { { 0x3860DF91, 0xCE6F48D7, 0xB6206298, 0x33046B5E } },
+	      { { 0x52E5146C, 0x375C92FF, 0x882D49B0, 0x3830B541 } } } } },
+	// (2^64)*B * 37
+	{ { { { { 0x4F1D5B2A, 0x1F7387AB, 0x79A271BC, 0x427267C9 } },
+	      { { 0x98CFF854, 0xFCF4CBA0, 0xB331D343, 0x3F3DC2A4 } } } },
+	  { { { { 0xF5995FAB, 0x4029B73B, 0x53AB170F, 0x7CBBAA32 } },
+	      { { 0xCC3BABE1, 0x19256B89, 0xFFD2570D, 0x45181A4C } } } } },
+	// (2^64)*B * 39
+	{ { { { { 0xE9AD1AF6, 0xF076B3EF, 0x77F412E9, 0x24705A26 } },
+	      { { 0x2FA55028, 0x2C1493DD, 0xE7067E8F, 0x1D0351C8 } } } },
+	  { { { { 0x2CD6EEE6, 0x52B777ED, 0x78077B5F, 0x20607329 } },
+	      { { 0x29A8E563, 0x6CACE3E9, 0x304C269C, 0x1EAB0030 } } } } },
+	// (2^64)*B * 41
+	{ { { { { 0xE3FF6EA4, 0xD351CD97, 0x4B64FE17, 0x4AB497F2 } },
+	      { { 0x319F7E4B, 0x5C71A131, 0xE1BF3480, 0x3A708B93 } } } },
+	  { { { { 0x5E327CE5, 0x5A35102E, 0x3B352FAF, 0x2618E37F } },
+	      { { 0x994EECBC, 0x8F5A0802, 0xE7131B12, 0x7056EEC9 } } } } },
+	// (2^64)*B * 43
+	{ { { { { 0x1F9386CE, 0x74E1DAA9, 0x1F8304BE, 0x21262211 } },
+	      { { 0xBF72BA1D, 0xAD127E48, 0xC0ED7CB5, 0x6C479F30 } } } },
+	  { { { { 0xA203E3D0, 0x8F97244E, 0x07961FF3, 0x7EC4722F } },
+	      { { 0x8101770D, 0x5C53A3AA, 0x5B843686, 0x0C402632 } } } } },
+	// (2^64)*B * 45
+	{ { { { { 0xBE48602C, 0x20EB183D, 0x575ADDB1, 0x621A1533 } },
+	      { { 0xC771FCD3, 0x2F98F68A, 0x9AA360E3, 0x679D757E } } } },
+	  { { { { 0x1C9D2F13, 0x2A195617, 0xEE75F959, 0x556D83A8 } },
+	      { { 0x78F5BB28, 0x02D8545D, 0x57D6061B, 0x33D8730C } } } } },
+	// (2^64)*B * 47
+	{ { { { { 0x4CA2828A, 0x20C8C3AB, 0xD0768F0A, 0x73EF144F } },
+	      { { 0x2F21F3BC, 0xE1016357, 0x7ECF64EA, 0x1184BC0A } } } },
+	  { { { { 0x9F577760, 0x7B1DABFE, 0x2BDC191D, 0x2F68D1E9 } },
+	      { { 0x2BE197DA, 0x1CE89FD6, 0x91BCA426, 0x38CEC836 } } } } },
+	// (2^64)*B * 49
+	{ { { { { 0x0A6C95BE, 0x67272DD6, 0xCFFE058F, 0x5406080A } },
+	      { { 0x941A1D0A, 0xE646F32A, 0xFDF16667, 0x65E271E8 } } } },
+	  { { { { 0xA82C33B9, 0xD95DEB3B, 0x93277CEE, 0x419DD9DC } },
+	      { { 0xEAE18407, 0xE758D05B, 0xEA6FE8C6, 0x6F309B44 } } } } },
+	// (2^64)*B * 51
+	{ { { { { 0xF70643A0, 0x743BA415, 0x285D8CC9, 0x2ADAE130 } },
+	      { { 0xA0694A10, 0xEF20974C, 0x56A82032, 0x2ECEF04E } } } },
+	  { { { { 0xA49380C8, 0x8B9746EE, 0x0213B369, 0x22C32298 } },
+	      { { 0xA03D7271, 0x2E2A0041, 0x32CE5ADB, 0x70CF8A2A } } } } },
+	// (2^64)*B * 53
+	{ { { { { 0x65652729, 0x994F5CF6, 0x797E9D1A, 0x18AFFB90 } },
+	      { { 0xCA42B7EA, 0x718BF109, 0x52305C1D, 0x27896368 } } } },
+	  { { { { 0x279AA7C7, 0x35D55ED8, 0x3AB6E0BA, 0x5C265EC3 } },
+	      { { 0x805A4A96, 0x31EFF083, 0x4D2228A0, 0x5E3E0BCA } } } } },
+	// (2^64)*B * 55
+	{ { { { { 0x8B37FA89, 0x2DB510B3, 0x340B958B, 0x2523D73D } },
+	      { { 0x8081C132, 0xD182DBF7, 0xD5E3E2FB, 0x2A05950F } } } },
+	  { { { { 0xDA8F9C0C, 0xCFBE03DC, 0x074D1F57, 0x7F833D9A } },
+	      { { 0x22C508FC, 0x2E913966, 0x5E78E2F4, 0x3D46CB17 } } } } },
+	// (2^64)*B * 57
+	{ { { { { 0x1677C4F8, 0x1BAACD93, 0x87D4B60E, 0x2FBDB480 } },
+	      { { 0xBDCC5461, 0x4A7B44DC, 0xE2637DCC, 0x26467816 } } } },
+	  { { { { 0xCBF12B72, 0x9C11D92A, 0xECBBFB8E, 0x5E51775D } },
+	      { { 0x52A32152, 0x2D2D0CC0, 0xFBE32230, 0x3DB0CF92 } } } } },
+	// (2^64)*B * 59
+	{ { { { { 0x1F355EFD, 0xD9500535, 0x5B4F5A52, 0x52A39B50 } },
+	      { { 0x3E8E5A3D, 0xDB6B7CE4, 0x4979140C, 0x18DF0F36 } } } },
+	  { { { { 0x8AD085D4, 0xFF4F7CD4, 0x0D8A71CD, 0x0270D763 } },
+	      { { 0x57B7E98E, 0x9BA6100C, 0x7637C7BB, 0x1CC73321 } } } } },
+	// (2^64)*B * 61
+	{ { { { { 0xDC8F6D2A, 0x4DBDC118, 0x564B5FE5, 0x31490EE9 } },
+	      { { 0xF8CBF309, 0x4C62DDBA, 0xBA39F47E, 0x19D6C734 } } } },
+	  { { { { 0x34DE0BD2, 0xC475D34D, 0x6540703C, 0x084D51C1 } },
+	      { { 0x78E08262, 0xDA0C900D, 0xF12FFA13, 0x46515917 } } } } },
+	// (2^64)*B * 63
+	{ { { { { 0x36A65FD1, 0xDB49601C, 0x95C0ACE7, 0x475B6314 } },
+	      { { 0x3D595AAB, 0xDBC45995, 0x1C6394FB, 0x6AD87655 } } } },
+	  { { { { 0x3CDFD89D, 0xF4D8CB4B, 0x2499D478, 0x3F875628 } },
+	      { { 0xF8BF0C8D, 0x53955994, 0xA1893216, 0x0A2773D5 } } } } },
+#endif
+#if GLS254_VERIFY_GEN_WIN >= 8
+	// (2^64)*B * 65
+	{ { { { { 0x7F4CAD58, 0xB291235D, 0xCE3D25ED, 0x3EC41C87 } },
+	      { { 0x4E357C77, 0xBE021D1D, 0xE144328A, 0x7EBF5138 } } } },
+	  { { { { 0x8205D3EB, 0x151C1E45, 0x16233F79, 0x282ED9CF } },
+	      { { 0xDAFB0782, 0x3B69F632, 0xDDA4F11C, 0x37EBC0AE } } } } },
+	// (2^64)*B * 67
+	{ { { { { 0xFD4C905E, 0x04DE91B3, 0xA98EB8E1, 0x4615F7BB } },
+	      { { 0xBC0EEE1F, 0xEAE41546, 0x6B79B463, 0x3AB98279 } } } },
+	  { { { { 0xE6C041A7, 0xDE4FBB7F, 0x1B9F30F8, 0x0EC83B17 } },
+	      { { 0x1F472785, 0x22D7CB55, 0x99B809C3, 0x4FE20429 } } } } },
+	// (2^64)*B * 69
+	{ { { { { 0x2B2474A6, 0xFA12CD70, 0x39D4D842, 0x15C61D3A } },
+	      { { 0x538E03AD, 0x9668E3B3, 0x77CB66B7, 0x6FE3835E } } } },
+	  { { { { 0xEFE74D7B, 0x7A3F8DAF, 0x40DA57AF, 0x2CD6DF5F } },
+	      { { 0x0984200D, 0xC2718C9A, 0x08E7BE0C, 0x78D46ABC } } } } },
+	// (2^64)*B * 71
+	{ { { { { 0x2F51020C, 0x13ACB33F, 0x1191D360, 0x716059E7 } },
+	      { { 0x2B3286D8, 0x9FCB373A, 0x439D28EA, 0x7BFF5E85 } } } },
+	  { { { { 0xF817404A, 0x21DB92C3, 0xF7F250DF, 0x4B2B1704 } },
+	      { { 0x56924C52, 0xB3ED3486, 0x50CF8344, 0x1A39BE0D } } } } },
+	// (2^64)*B * 73
+	{ { { { { 0x359ABEC9, 0x772B06E4, 0x291D686B, 0x31793D90 } },
+	      { { 0x6B5727D3, 0xA885F784, 0xB08C16E2, 0x2BECD3D9 } } } },
+	  { { { { 0x863D5978, 0x5E8023A6, 0x62F3194A, 0x3C85C5F8 } },
+	      { { 0x9A8ADE54, 0xF1EBEDC9, 0x43210078, 0x0618C1F8 } } } } },
+	// (2^64)*B * 75
+	{ { { { { 0x4BB04338, 0x8B01458C, 0x5C9B1D5E, 0x168C1542 } },
+	      { { 0x51EA1729, 0xCA9AEB95, 0x19427E88, 0x1F01EC7D } } } },
+	  { { { { 0x9FE1DE20, 0x2E536573, 0xEE4CB04D, 0x331E81BB } },
+	      { { 0x66437B30, 0xD9E04974, 0x8E54468B, 0x412F25F6 } } } } },
+	// (2^64)*B * 77
+	{ { { { { 0x708CD46A, 0xB20ECE76, 0x0CD1FEA0, 0x43851460 } },
+	      { { 0x781BBCA2, 0x565B0639, 0xC08F5C19, 0x2B626DC1 } } } },
+	  { { { { 0xF75B8D21, 0xE132FD64, 0x4CEF499B, 0x51E4F5C6 } },
+	      { { 0xD699482B, 0x9F6FBD4A, 0x61DD590F, 0x00D4FD13 } } } } },
+	// (2^64)*B * 79
+	{ { { { { 0x0A410131, 0x821EBE94, 0xA44EF2A9, 0x5C662F64 } },
+	      { { 0x9DF48568, 0xA57505B0, 0xF4E6A9C4, 0x037F9B05 } } } },
+	  { { { { 0x800BC945, 0xB452A538, 0x8B5D8B03, 0x29503B23 } },
+	      { { 0xC7E1B97E, 0x79717B3A, 0x49303583, 0x4494B264 } } } } },
+	// (2^64)*B * 81
+	{ { { { { 0x7FFFAD87, 0x9607A387, 0x2F181A1C, 0x3AC7FFA4 } },
+	      { { 0x74BD30FE, 0x170E31E7, 0x866EFE72, 0x1BC2512A } } } },
+	  { { { { 0x1CA69360, 0x56096CF0, 0x3ACB8E69, 0x31A306A0 } },
+	      { { 0xFAADF187, 0x23803A5A, 0xBC5D58BC, 0x0269278A } } } } },
+	// (2^64)*B * 83
+	{ { { { { 0xA0C2C4A3, 0x22583F0D, 0x63F62380, 0x254D8065 } },
+	      { { 0x89B60D77, 0x85F3038C, 0x6762A70D, 0x520CD8BB } } } },
+	  { { { { 0xDE7BF8E9, 0x02F42CC2, 0xCD5EE4C0, 0x68D6D8FA } },
+	      { { 0x7ACDD6EE, 0xC0BB9F4C, 0xF288DC7B, 0x5D60E64F } } } } },
+	// (2^64)*B * 85
+	{ { { { { 0x37241351, 0xF6F5BC26, 0x263670D3, 0x05CD1207 } },
+	      { { 0x8B554529, 0x702295A1, 0x2109673D, 0x6A69AB7C } } } },
+	  { { { { 0xB56C20D3, 0xD8EAC831, 0xCF4C84CF, 0x340F2672 } },
+	      { { 0x4507684A, 0x9B26ADD2, 0x8D7F541B, 0x0CADF82E } } } } },
+	// (2^64)*B * 87
+	{ { { { { 0x71305C54, 0x14CA3C60, 0xF4984B01, 0x2952BAB9 } },
+	      { { 0x016A2B84, 0xF5F2786E, 0x45CE2C6C, 0x5D37844E } } } },
+	  { { { { 0x8730B7BF, 0xDB8AB41D, 0x95E0661A, 0x7E5997C0 } },
+	      { { 0x7ED14A17, 0xBF79B5E2, 0x57FE04D6, 0x152874FC } } } } },
+	// (2^64)*B * 89
+	{ { { { { 0xF295C3A5, 0x804409C7, 0x227CE1A1, 0x7C0960CA } },
+	      { { 0xDE11F736, 0x85EDD1AA, 0x899468F1, 0x399E6745 } } } },
+	  { { { { 0xE7914907, 0x75EDB1A9, 0xB73FC0C7, 0x25D473D5 } },
+	      { { 0xE6ADCE52, 0x55AD0544, 0x5156D38F, 0x68F8E5D4 } } } } },
+	// (2^64)*B * 91
+	{ { { { { 0x40B484F7, 0x6C5603ED, 0x6BE4DB8B, 0x26E60D36 } },
+	      { { 0x0366DB46, 0xDAF712BC, 0xC66C44DA, 0x12D57CAC } } } },
+	  { { { { 0x94310C28, 0xF2C309A9, 0x8FBF5074, 0x7B91B531 } },
+	      { { 0xEA2DE997, 0x844A0B02, 0x5740F2FC, 0x2CEA300E } } } } },
+	// (2^64)*B * 93
+	{ { { { { 0xCC3B2153, 0xD934551B, 0x4002B190, 0x1790EFDE } },
+	      { { 0xF0925E06, 0xE16FC674, 0xF5D7EC9C, 0x332ACFE4 } } } },
+	  { { { { 0x8A1CAA24, 0x992CCECE, 0x61B37FE7, 0x1045A080 } },
+	      { { 0x89FF2786, 0xE96E2703, 0x3270D67F, 0x3D29796D } } } } },
+	// (2^64)*B * 95
+	{ { { { { 0xB9C799E5, 0xD5D31090, 0x3C45A9D1, 0x17F6084E } },
+	      { { 0xEFEDADAD, 0x3832C33C, 0xCD3538AD, 0x5B0D3CB4 } } } },
+	  { { { { 0xE1E2483A, 0x96526BA1, 0x2EED250A, 0x6E61EF2A } },
+	      { { 0x7AA61594, 0x92882FA2, 0xD9DA3AB6, 0x2E219332 } } } } },
+	// (2^64)*B * 97
+	{ { { { { 0x92895701, 0x298B4CF0, 0x3F646481, 0x41FFA650 } },
+	      { { 0x51550C34, 0xC22B5C8A, 0x6434B99F, 0x5A062C6B } } } },
+	  { { { { 0x68C7145C, 0xEC6F4BD8, 0x5BE75456, 0x6DFA0890 } },
+	      { { 0x6674E8F1, 0x04105C3F, 0xA5ACDAD9, 0x6BE90E26 } } } } },
+	// (2^64)*B * 99
+	{ { { { { 0x84406FD0, 0x27B807F0, 0x907082DE, 0x6F3B506D } },
+	      { { 0xCADD3773, 0x16CEE86F, 0x5752E569, 0x7E4D6B74 } } } },
+	  { { { { 0xF91DEFD7, 0x2A4B04D3, 0x60A11CB6, 0x6737ED09 } },
+	      { { 0x87F2493E, 0xC0CA2B0D, 0x6FEEB348, 0x484451AF } } } } },
+	// (2^64)*B * 101
+	{ { { { { 0x0230B6C3, 0x98A7BFA2, 0x40A22FE9, 0x1A54D3A6 } },
+	      { { 0xD62E713B, 0x0DB27984, 0x33421AD2, 0x43BE33BC } } } },
+	  { { { { 0xC3FB99FF, 0xCC015C3F, 0xDF45605A, 0x770FE59C } },
+	      { { 0x85B6D7CE, 0x2EED575E, 0xE0743B0B, 0x45054AC9 } } } } },
+	// (2^64)*B * 103
+	{ { { { { 0x06BD1C5D, 0xA0BD7BE8, 0x96AAD21E, 0x15EC74DC } },
+	      { { 0x3221D11F, 0x3274C193, 0x78F46974, 0x687CBABB } } } },
+	  { { { { 0xBE71E8BB, 0x3C71B054, 0x01B16584, 0x7B2C50B6 } },
+	      { { 0x2D815E62, 0x240FD3CE, 0x92EECDB7, 0x167026B6 } } } } },
+	// (2^64)*B * 105
+	{ { { { { 0x0D0B2735, 0xCCB9EB05, 0x392B9132, 0x1D8FFA69 } },
+	      { { 0xF98017F4, 0xF014BE5E, 0x0CDB9F8F, 0x0A3CAA86 } } } },
+	  { { { { 0xB6FB06F6, 0x8C87FD35, 0xC61C6EDC, 0x785E4441 } },
+	      { { 0x70DF3283, 0x8FCDF862, 0xC6792D28, 0x307F5ADC } } } } },
+	// (2^64)*B * 107
+	{ { { { { 0x5798B5C6, 0x15DBC478, 0x5629FE9E, 0x2BA53DBF } },
+	      { { 0x432D41F0, 0x62AC80D1, 0xE1CEE964, 0x4D851BE9 } } } },
+	  { { { { 0xC8F76E6A, 0x13B27B21, 0xF1761A3F, 0x3A6DE966 } },
+	      { { 0x1DD81523, 0x1B6D5566, 0x7A209FC2, 0x3A6D80AB } } } } },
+	// (2^64)*B * 109
+	{ { { { { 0x4B2E69B1, 0x95B8518D, 0x5A469E5E, 0x64FEBDC5 } },
+	      { { 0x535DFC5A, 0x25AD60C0, 0x819F3727, 0x7B905D4A } } } },
+	  { { { { 0x668B8DF8, 0x73EBFE62, 0xEF0B6DF0, 0x2C767D55 } },
+	      { { 0xE66748AB, 0xCBBEA14C, 0x674DDF1A, 0x7547871E } } } } },
+	// (2^64)*B * 111
+	{ { { { { 0xA410E69C, 0x7B0FCE28, 0x7FB88693, 0x5423FA87 } },
+	      { { 0x1C4EC8AF, 0x0169542B, 0xE0B7D2D8, 0x1999A7D0 } } } },
+	  { { { { 0xC3149A2E, 0x07FD9316, 0xC8001A3D, 0x02B9B483 } },
+	      { { 0x958B3CA3, 0x6315B7A5, 0xBC74D450, 0x465B6F79 } } } } },
+	// (2^64)*B * 113
+	{ { { { { 0x8408E266, 0x9A99717F, 0x9D0B8E31, 0x01782A5C } },
+	      { { 0xBC67D7E8, 0x48CE2EA6, 0x1EE91BC6, 0x5962D341 } } } },
+	  { { { { 0x84754053, 0x44C5E187, 0x774A26A0, 0x0643C539 } },
+	      { { 0xFA396E34, 0xA1BB1CEB, 0x2898961F, 0x334D46D5 } } } } },
+	// (2^64)*B * 115
+	{ { { { { 0x3B7A8B9C, 0xADEBF222, 0x6BC167E4, 0x1D1734BB } },
+	      { { 0x444E7A94, 0x6A03FE14, 0x88E7660A, 0x33C87542 } } } },
+	  { { { { 0x1B0A1E9B, 0x66DAE0EC, 0x2941FAA1, 0x2C84272A } },
+	      { { 0x60E30561, 0xB89E761A, 0x9F9AFD64, 0x08AA0C04 } } } } },
+	// (2^64)*B * 117
+	{ { { { { 0x7775A115, 0x6269ABCA, 0xBBA123E9, 0x2E2566B5 } },
+	      { { 0xEA2AAA46, 0xDDCB52F7, 0xEBFCEE80, 0x19136AE4 } } } },
+	  { { { { 0x5B5B70C5, 0xFDA59A66, 0x087B9ED5, 0x716827A8 } },
+	      { { 0xB6EF080A, 0x43610352, 0x12B16304, 0x1CC823A9 } } } } },
+	// (2^64)*B * 119
+	{ { { { { 0xCA9E5B53, 0xEAD83FE4, 0xDD37B2FF, 0x436151B7 } },
+	      { { 0x9C28F956, 0xE7AFA630, 0xD709AA11, 0x73009ECB } } } },
+	  { { { { 0xE1945D14, 0x47874E10, 0x32CF562F, 0x6178A4FC } },
+	      { { 0x5F1DC6CC, 0x9428BB94, 0x63911D23, 0x67E7FB59 } } } } },
+	// (2^64)*B * 121
+	{ { { { { 0xE62C66F2, 0xD2DD1FF6, 0x0E1D01E2, 0x7A611D62 } },
+	      { { 0x543D917E, 0x63EB177F, 0x3AF58FA0, 0x685F22E9 } } } },
+	  { { { { 0xDB9792EB, 0x654B8850, 0x8D20F7CB, 0x12F81746 } },
+	      { { 0xD3601AC1, 0x32BE0B9C, 0x099F1739, 0x76678943 } } } } },
+	// (2^64)*B * 123
+	{ { { { { 0xEBDF4CC4, 0x232DA978, 0xFA5C7319, 0x66BD6E9E } },
+	      { { 0x7181D9CA, 0x8012150A, 0x9EEC5FFB, 0x564FAE4D } } } },
+	  { { { { 0xF9A7C049, 0x1311DDF7, 0x2B08038A, 0x4BB675D1 } },
+	      { { 0xD8F86385, 0xCDA40073, 0x2F93292D, 0x4A100376 } } } } },
+	// (2^64)*B * 125
+	{ { { { { 0x8EE6C2D7, 0xF6F2B654, 0x9CAC124A, 0x6877C3C5 } },
+	      { { 0xAB1B50DC, 0xE50C539A, 0xD25A1C86, 0x594214AF } } } },
+	  { { { { 0x41A93C8E, 0x622ECB5E, 0xAB8630C4, 0x52A8301B } },
+	      { { 0xF6275E56, 0xE9E28F35, 0xC7DEBEDC, 0x6AC68FAB } } } } },
+	// (2^64)*B * 127
+	{ { { { { 0x358191ED, 0x2211B7E1, 0xE7DA3ECA, 0x4D39E6FC } },
+	      { { 0xE4ED944C, 0x3DE2AFB7, 0xAB531BD9, 0x7F1A8643 } } } },
+	  { { { { 0x555BD636, 0x3C6F76DF, 0x5A6671A5, 0x5EC5A217 } },
+	      { { 0x0A513B5A, 0x80FEF4E3, 0xF539D8D1, 0x3760ADE8 } } } } },
+#endif
+};
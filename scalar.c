@@ -68,6 +68,21 @@ static void modr_reduce256_partial(i256 *d, const i256 *a, uint32_t ah);
 static void modr_reduce256_finish(i256 *d, const i256 *a);
 static void modr_reduce384_partial(i256 *d, const i384 *a);
 
+/*
+ * With the ARM Cortex M4 backend, the Makefile sets GLS254_SCALAR_ASM,
+ * and the integer multiplications and the 384-bit partial reduction
+ * use the UMAAL-based implementations in gls254-cm4.s (same results).
+ */
+#ifndef GLS254_SCALAR_ASM
+#define GLS254_SCALAR_ASM   0
+#endif
+
+#if GLS254_SCALAR_ASM
+void scalar_mul128x128(i256 *d, const i128 *a, const i128 *b);
+void scalar_mul256x256(i512 *d, const i256 *a, const i256 *b);
+void scalar_modr_reduce384_partial(i256 *d, const i384 *a);
+#endif
+
 /* unused
 static void
 i128_decode(i128 *d, const void *a)
@@ -153,43 +168,15 @@ sub128trunc(i128 *d, const i128 *a, const i128 *b)
 	}
 }
 
-/*
- * Multiply two 128-bit integers, result is truncated to 128 bits.
- */
-static void
-mul128x128trunc(i128 *d, const i128 *a, const i128 *b)
-{
-	int i, j;
-	uint32_t f, g;
-	uint64_t z;
-	i128 t;
-
-	f = b->v[0];
-	g = 0;
-	for (i = 0; i < 4; i ++) {
-		z = (uint64_t)f * (uint64_t)a->v[i] + (uint64_t)g;
-		t.v[i] = (uint32_t)z;
-		g = (uint32_t)(z >> 32);
-	}
-	for (j = 1; j < 4; j ++) {
-		f = b->v[j];
-		g = 0;
-		for (i = 0; i < (4 - j); i ++) {
-			z = (uint64_t)f * (uint64_t)a->v[i] + (uint64_t)g;
-			z += (uint64_t)t.v[i + j];
-			t.v[i + j] = (uint32_t)z;
-			g = (uint32_t)(z >> 32);
-		}
-	}
-	*d = t;
-}
-
 /*
  * Multiply two 128-bit integers, result is 256 bits.
  */
 static void
 mul128x128(i256 *d, const i128 *a, const i128 *b)
 {
+#if GLS254_SCALAR_ASM
+	scalar_mul128x128(d, a, b);
+#else
 	int i, j;
 	uint32_t f, g;
 	uint64_t z;
@@ -213,8 +200,10 @@ mul128x128(i256 *d, const i128 *a, const i128 *b)
 		}
 		d->v[j + 4] = g;
 	}
+#endif
 }
 
+#if !GLS254_SCALAR_ASM
 /*
  * Multiply a 256-bit integer by a 128-bit integer, result is 384 bits.
  */
@@ -239,6 +228,7 @@ mul256x128(i384 *d, const i256 *a, const i128 *b)
 		cc = addcarry_u32(cc, 0, dh.v[i], &d->v[4 + i]);
 	}
 }
+#endif
 
 /*
  * Multiply two 256-bit integers together, result is 512 bits.
@@ -246,6 +236,9 @@ mul256x128(i384 *d, const i256 *a, const i128 *b)
 static void
 mul256x256(i512 *d, const i256 *a, const i256 *b)
 {
+#if GLS254_SCALAR_ASM
+	scalar_mul256x256(d, a, b);
+#else
 	i128 al, ah;
 	i384 dl, dh;
 	unsigned char cc;
@@ -263,6 +256,7 @@ mul256x256(i512 *d, const i256 *a, const i256 *b)
 	for (i = 8; i < 12; i ++) {
 		cc = addcarry_u32(cc, 0, dh.v[i], &d->v[4 + i]);
 	}
+#endif
 }
 
 /* unused
@@ -279,25 +273,51 @@ modr_mul256x128(i256 *d, const i256 *a, const i128 *b)
 */
 
 /*
- * Multiplication modulo r, with two 256-bit operands.
- * Input operands can use their full range; output is reduced.
+ * Reduction modulo r of a 512-bit integer (two partial reductions of
+ * 384-bit values). Output is fully reduced.
  */
 static void
-modr_mul256x256(i256 *d, const i256 *a, const i256 *b)
+modr_reduce512(i256 *d, const i512 *x)
 {
 	i256 t;
 	i384 e;
-	i512 x;
 
-	mul256x256(&x, a, b);
-	memcpy(&e.v[0], &x.v[4], 12 * sizeof(uint32_t));
+	memcpy(&e.v[0], &x->v[4], 12 * sizeof(uint32_t));
 	modr_reduce384_partial(&t, &e);
-	memcpy(&e.v[0], &x.v[0], 4 * sizeof(uint32_t));
+	memcpy(&e.v[0], &x->v[0], 4 * sizeof(uint32_t));
 	memcpy(&e.v[4], &t.v[0], 8 * sizeof(uint32_t));
 	modr_reduce384_partial(&t, &e);
 	modr_reduce256_finish(d, &t);
 }
 
+/*
+ * Multiplication modulo r, with two 256-bit operands.
+ * Input operands can use their full range; output is reduced.
+ */
+static void
+modr_mul256x256(i256 *d, const i256 *a, const i256 *b)
+{
+	i512 x;
+
+	mul256x256(&x, a, b);
+	modr_reduce512(d, &x);
+}
+
+/* see gls254.h */
+void
+scalar_reduce64(void *d, const void *a)
+{
+	const uint8_t *buf = a;
+	i512 x;
+	i256 t;
+
+	for (int i = 0; i < 16; i ++) {
+		x.v[i] = dec32le(buf + (i << 2));
+	}
+	modr_reduce512(&t, &x);
+	i256_encode(d, &t);
+}
+
 /* see gls254.h */
 void
 scalar_reduce(void *d, const void *a, size_t a_len)
@@ -316,6 +336,14 @@ scalar_reduce(void *d, const void *a, size_t a_len)
 		return;
 	}
 
+	/*
+	 * 64-byte inputs (e.g. wide hash outputs) use the dedicated path.
+	 */
+	if (a_len == 64) {
+		scalar_reduce64(d, a);
+		return;
+	}
+
 	/*
 	 * Decode high bytes; we use as many bytes as possible, but no
 	 * more than 32, and such that the number of undecoded bytes is
@@ -433,6 +461,7 @@ static const i128 R0_x8m = { {
 } };
 #define R_x8_top   ((uint32_t)0x00000001)
 
+#if !GLS254_SCALAR_ASM
 /*
  * 16*r (mod 2^256)
  */
@@ -441,6 +470,7 @@ static const i256 R_x16m = { {
 	0x00000003, 0x00000000, 0x00000000, 0x00000000
 } };
 #define R_x16_top   ((uint32_t)0x00000002)
+#endif
 
 /*
  * Given input 'a' (up to 2^285-1), perform a partial reduction modulo r;
@@ -533,6 +563,9 @@ modr_reduce256_finish(i256 *d, const i256 *a)
 static void
 modr_reduce384_partial(i256 *d, const i384 *a)
 {
+#if GLS254_SCALAR_ASM
+	scalar_modr_reduce384_partial(d, a);
+#else
 	i128 a1;
 	i256 t;
 	uint32_t t8, m;
@@ -578,6 +611,7 @@ modr_reduce384_partial(i256 *d, const i384 *a)
 
 	/* Partial reduction. */
 	modr_reduce256_partial(d, &t, t8);
+#endif
 }
 
 /* see gls254.h */
@@ -697,22 +731,407 @@ scalar_half(void *d, const void *a)
 }
 
 /*
- * For integers k and e such that:
- *   k < r
- *   e < (2^127 - 2)
- * set d to round(k*e/r).
+ * Scalar inversion uses the safegcd algorithm (Bernstein-Yang), with
+ * the "half-delta" divstep variant; the structure follows the 32-bit
+ * implementation in libsecp256k1. Values are represented with nine
+ * signed 30-bit limbs (i270). Each outer iteration performs 30 divsteps
+ * on the low limbs only, producing a 2x2 transition matrix whose
+ * coefficients fit in 31 bits, then applies that matrix to the full
+ * values. For inputs up to 256 bits, 590 divsteps are enough; we do 600.
+ */
+typedef struct {
+	int32_t v[9];
+} i270;
+
+/*
+ * r in signed 30-bit limbs, and 1/r mod 2^30.
+ */
+static const i270 R_s30 = { {
+	0x343A8CF5, 0x32F78DF3, 0x01A1DAD3, 0x0691F7B7, 0x0000003F,
+	0x00000000, 0x00000000, 0x00000000, 0x00002000
+} };
+#define R_inv30   ((uint32_t)0x3F50BF5D)
+#define M30       ((int32_t)0x3FFFFFFF)
+
+/*
+ * Transition matrix [u v; q r] for 30 divsteps (scaled by 2^30).
  */
+typedef struct {
+	int32_t u, v, q, r;
+} tr2x2;
+
 static void
-mul_divr_rounded(i128 *d, const i256 *k, const i128 *e)
+i256_to_i270(i270 *d, const i256 *a)
 {
-	/* z <- k*e */
-	i384 z;
-	mul256x128(&z, k, e);
+	int i;
+
+	for (i = 0; i < 9; i ++) {
+		int j = (30 * i) >> 5, k = (30 * i) & 31;
+		uint32_t w;
 
+		w = a->v[j] >> k;
+		if (k > 2 && j < 7) {
+			w |= a->v[j + 1] << (32 - k);
+		}
+		d->v[i] = (int32_t)(w & (uint32_t)M30);
+	}
+}
+
+static void
+i270_to_i256(i256 *d, const i270 *a)
+{
+	int i;
+
+	/* Input limbs are all in the 0 to 2^30-1 range. */
+	memset(d, 0, sizeof *d);
+	for (i = 0; i < 9; i ++) {
+		int j = (30 * i) >> 5, k = (30 * i) & 31;
+		uint32_t w = (uint32_t)a->v[i];
+
+		d->v[j] |= w << k;
+		if (k > 2 && j < 7) {
+			d->v[j + 1] |= w >> (32 - k);
+		}
+	}
+}
+
+/*
+ * Perform 30 divsteps on the low bits of f and g (f is odd), starting
+ * with the provided zeta = -(delta + 1/2). The transition matrix is
+ * written in *t, and the new zeta is returned. This is constant-time.
+ */
+static int32_t
+divsteps_30(int32_t zeta, uint32_t f0, uint32_t g0, tr2x2 *t)
+{
+	/* Matrix coefficients are kept as unsigned values (mod 2^32),
+	   which allows left shifts of negative values. */
+	uint32_t u = 1, v = 0, q = 0, r = 1;
+	uint32_t f = f0, g = g0;
+	int i;
+
+	for (i = 0; i < 30; i ++) {
+		uint32_t m1, m2, x, y, z;
+
+		/* m1 = -1 if zeta < 0, m2 = -1 if g is odd */
+		m1 = (uint32_t)(zeta >> 31);
+		m2 = -(g & 1);
+
+		/* If g is odd, add (conditionally negated) f, u, v to
+		   g, q, r. */
+		x = (f ^ m1) - m1;
+		y = (u ^ m1) - m1;
+		z = (v ^ m1) - m1;
+		g += x & m2;
+		q += y & m2;
+		r += z & m2;
+
+		/* If zeta < 0 and g was odd, then swap roles: the
+		   new f is the old g (f + new g), and zeta becomes
+		   -zeta - 2; otherwise, zeta becomes zeta - 1. */
+		m1 &= m2;
+		zeta = (zeta ^ (int32_t)m1) - 1;
+		f += g & m1;
+		u += q & m1;
+		v += r & m1;
+
+		g >>= 1;
+		u <<= 1;
+		v <<= 1;
+	}
+	t->u = (int32_t)u;
+	t->v = (int32_t)v;
+	t->q = (int32_t)q;
+	t->r = (int32_t)r;
+	return zeta;
+}
+
+/*
+ * Set [d, e] <- t*[d, e]/2^30 mod r. Inputs d and e are in the -2*r to
+ * r range; outputs are in the same range.
+ */
+static void
+update_de_30(i270 *d, i270 *e, const tr2x2 *t)
+{
+	int32_t u = t->u, v = t->v, q = t->q, r = t->r;
+	int32_t di, ei, md, me, sd, se;
+	int64_t cd, ce;
+	int i;
+
+	/* Add r*[md, me] with [md, me] chosen to clear the low 30
+	   bits; start with corrections for negative d and e. */
+	sd = d->v[8] >> 31;
+	se = e->v[8] >> 31;
+	md = (u & sd) + (v & se);
+	me = (q & sd) + (r & se);
+	di = d->v[0];
+	ei = e->v[0];
+	cd = (int64_t)u * di + (int64_t)v * ei;
+	ce = (int64_t)q * di + (int64_t)r * ei;
+	md -= (int32_t)((R_inv30 * (uint32_t)cd + (uint32_t)md)
+		& (uint32_t)M30);
+	me -= (int32_t)((R_inv30 * (uint32_t)ce + (uint32_t)me)
+		& (uint32_t)M30);
+	cd += (int64_t)R_s30.v[0] * md;
+	ce += (int64_t)R_s30.v[0] * me;
+	cd >>= 30;
+	ce >>= 30;
+	for (i = 1; i < 9; i ++) {
+		di = d->v[i];
+		ei = e->v[i];
+		cd += (int64_t)u * di + (int64_t)v * ei;
+		ce += (int64_t)q * di + (int64_t)r * ei;
+		cd += (int64_t)R_s30.v[i] * md;
+		ce += (int64_t)R_s30.v[i] * me;
+		d->v[i - 1] = (int32_t)cd & M30;
+		e->v[i - 1] = (int32_t)ce & M30;
+		cd >>= 30;
+		ce >>= 30;
+	}
+	d->v[8] = (int32_t)cd;
+	e->v[8] = (int32_t)ce;
+}
+
+/*
+ * Set [f, g] <- t*[f, g]/2^30 (exact division).
+ */
+static void
+update_fg_30(i270 *f, i270 *g, const tr2x2 *t)
+{
+	int32_t u = t->u, v = t->v, q = t->q, r = t->r;
+	int32_t fi, gi;
+	int64_t cf, cg;
+	int i;
+
+	fi = f->v[0];
+	gi = g->v[0];
+	cf = (int64_t)u * fi + (int64_t)v * gi;
+	cg = (int64_t)q * fi + (int64_t)r * gi;
+	cf >>= 30;
+	cg >>= 30;
+	for (i = 1; i < 9; i ++) {
+		fi = f->v[i];
+		gi = g->v[i];
+		cf += (int64_t)u * fi + (int64_t)v * gi;
+		cg += (int64_t)q * fi + (int64_t)r * gi;
+		f->v[i - 1] = (int32_t)cf & M30;
+		g->v[i - 1] = (int32_t)cg & M30;
+		cf >>= 30;
+		cg >>= 30;
+	}
+	f->v[8] = (int32_t)cf;
+	g->v[8] = (int32_t)cg;
+}
+
+/*
+ * Given d in the -2*r to r range, set d to sign*d mod r, fully reduced
+ * (sign is -1 if its top bit is set, +1 otherwise). Output limbs are in
+ * the 0 to 2^30-1 range.
+ */
+static void
+normalize_30(i270 *d, int32_t sign)
+{
+	int32_t m;
+	int i;
+
+	/* Add r if d < 0, then negate if sign < 0: this yields a value
+	   in the -r to r range. */
+	m = d->v[8] >> 31;
+	for (i = 0; i < 9; i ++) {
+		d->v[i] += R_s30.v[i] & m;
+	}
+	m = sign >> 31;
+	for (i = 0; i < 9; i ++) {
+		d->v[i] = (d->v[i] ^ m) - m;
+	}
+	for (i = 0; i < 8; i ++) {
+		d->v[i + 1] += d->v[i] >> 30;
+		d->v[i] &= M30;
+	}
+
+	/* Add r again if still negative. */
+	m = d->v[8] >> 31;
+	for (i = 0; i < 9; i ++) {
+		d->v[i] += R_s30.v[i] & m;
+	}
+	for (i = 0; i < 8; i ++) {
+		d->v[i + 1] += d->v[i] >> 30;
+		d->v[i] &= M30;
+	}
+}
+
+/*
+ * Inversion modulo r (constant-time). Input must be fully reduced. If
+ * the input is zero, then the output is zero.
+ */
+static void
+modr_invert(i256 *d, const i256 *a)
+{
+	i270 vd, ve, vf, vg;
+	int32_t zeta;
+	int i;
+
+	memset(&vd, 0, sizeof vd);
+	memset(&ve, 0, sizeof ve);
+	ve.v[0] = 1;
+	vf = R_s30;
+	i256_to_i270(&vg, a);
+	zeta = -1;
+	for (i = 0; i < 20; i ++) {
+		tr2x2 t;
+
+		zeta = divsteps_30(zeta, (uint32_t)vf.v[0],
+			(uint32_t)vg.v[0], &t);
+		update_de_30(&vd, &ve, &t);
+		update_fg_30(&vf, &vg, &t);
+	}
+
+	/* Now g = 0 and f = +/-1 (or +/-r if the input was zero, in
+	   which case d = 0); d contains +/- the inverse. */
+	normalize_30(&vd, vf.v[8]);
+	i270_to_i256(d, &vd);
+}
+
+/* see gls254.h */
+void
+scalar_invert(void *d, const void *a)
+{
+	i256 t;
+
+	i256_decode(&t, a);
+	modr_reduce256_partial(&t, &t, 0);
+	modr_reduce256_finish(&t, &t);
+	modr_invert(&t, &t);
+	i256_encode(d, &t);
+}
+
+/*
+ * Reduce the scalar src into x; if the result is zero, x is set to 1
+ * instead. Returned value is 0x00 if the scalar was zero, 0xFF otherwise.
+ */
+static uint8_t
+reduce_nonzero(uint8_t *x, const uint8_t *src)
+{
+	uint32_t z;
+
+	scalar_reduce(x, src, 32);
+	z = (uint32_t)scalar_is_zero(x);
+	x[0] |= (uint8_t)z;
+	return (uint8_t)(z - 1);
+}
+
+/* see gls254.h */
+void
+scalar_batch_invert(void *d, const void *a, size_t num)
+{
+	uint8_t *bd = d;
+	const uint8_t *ba = a;
+	uint8_t acc[32], x[32];
+	size_t i;
+
+	if (num == 0) {
+		return;
+	}
+
+	/*
+	 * Montgomery's trick: store the prefix products in d, invert
+	 * the total product, then walk back. Zero inputs are replaced
+	 * with 1 (so that they do not spoil the other inverses), and
+	 * their outputs are cleared.
+	 */
+	reduce_nonzero(bd, ba);
+	for (i = 1; i < num; i ++) {
+		reduce_nonzero(x, ba + (i << 5));
+		scalar_mul(bd + (i << 5), bd + ((i - 1) << 5), x);
+	}
+	scalar_invert(acc, bd + ((num - 1) << 5));
+	for (i = num; i -- > 0;) {
+		uint8_t m;
+
+		m = reduce_nonzero(x, ba + (i << 5));
+		if (i > 0) {
+			scalar_mul(bd + (i << 5), bd + ((i - 1) << 5), acc);
+			scalar_mul(acc, acc, x);
+		} else {
+			memcpy(bd, acc, 32);
+		}
+		for (int j = 0; j < 32; j ++) {
+			bd[(i << 5) + j] &= m;
+		}
+	}
+}
+
+/*
+ * Compute the denominator of the Lagrange coefficient for index i:
+ *   x_i * prod_{j != i} (x_j - x_i)
+ */
+static void
+lagrange_denom(uint8_t *d, const uint8_t *ids, size_t num, size_t i)
+{
+	uint8_t t[32];
+	size_t j;
+
+	scalar_reduce(d, ids + (i << 5), 32);
+	for (j = 0; j < num; j ++) {
+		if (j == i) {
+			continue;
+		}
+		scalar_sub(t, ids + (j << 5), ids + (i << 5));
+		scalar_mul(d, d, t);
+	}
+}
+
+/* see gls254.h */
+int
+scalar_lagrange_coeffs(void *lambda, const void *ids, size_t num)
+{
+	uint8_t *bd = lambda;
+	const uint8_t *bx = ids;
+	uint8_t acc[32], t[32];
+	uint32_t ok;
+	size_t i;
+
+	if (num == 0) {
+		return 1;
+	}
+
+	/*
+	 * With N = prod x_j and D_i = x_i * prod_{j != i} (x_j - x_i),
+	 * we have lambda_i = N / D_i. The prefix products of the D_i are
+	 * stored in lambda; N is folded into the inverse of their total
+	 * product, and the backward pass recomputes each D_i (this avoids
+	 * a temporary array of size num).
+	 */
+	lagrange_denom(bd, bx, num, 0);
+	for (i = 1; i < num; i ++) {
+		lagrange_denom(t, bx, num, i);
+		scalar_mul(bd + (i << 5), bd + ((i - 1) << 5), t);
+	}
+	ok = 1 - (uint32_t)scalar_is_zero(bd + ((num - 1) << 5));
+	scalar_invert(acc, bd + ((num - 1) << 5));
+	for (i = 0; i < num; i ++) {
+		scalar_mul(acc, acc, bx + (i << 5));
+	}
+	for (i = num - 1; i > 0; i --) {
+		scalar_mul(bd + (i << 5), bd + ((i - 1) << 5), acc);
+		lagrange_denom(t, bx, num, i);
+		scalar_mul(acc, acc, t);
+	}
+	memcpy(bd, acc, 32);
+	return (int)ok;
+}
+
+/*
+ * For an integer z such that z < 2^384 - (r-1)/2, set d to round(z/r)
+ * (truncated to 128 bits).
+ */
+static void
+divr_rounded(i128 *d, const i384 *za)
+{
 	/* z <- z + (r-1)/2 */
+	i384 z;
 	unsigned char cc = 0;
 	for (int i = 0; i < 12; i ++) {
-		cc = addcarry_u32(cc, z.v[i], HR_pad.v[i], &z.v[i]);
+		cc = addcarry_u32(cc, za->v[i], HR_pad.v[i], &z.v[i]);
 	}
 
 	/* Split z = z0 + z1*2^253 */
@@ -742,40 +1161,132 @@ mul_divr_rounded(i128 *d, const i256 *k, const i128 *e)
 	}
 }
 
+/*
+ * Multiply a 128-bit integer by a 64-bit integer (two limbs), result is
+ * truncated to 128 bits.
+ */
+static void
+mul128x64trunc(i128 *d, const i128 *a, const uint32_t *b)
+{
+	uint32_t g;
+	uint64_t z;
+	i128 t;
+
+	g = 0;
+	for (int i = 0; i < 4; i ++) {
+		z = (uint64_t)b[0] * (uint64_t)a->v[i] + (uint64_t)g;
+		t.v[i] = (uint32_t)z;
+		g = (uint32_t)(z >> 32);
+	}
+	g = 0;
+	for (int i = 0; i < 3; i ++) {
+		z = (uint64_t)b[1] * (uint64_t)a->v[i] + (uint64_t)g;
+		z += (uint64_t)t.v[i + 1];
+		t.v[i + 1] = (uint32_t)z;
+		g = (uint32_t)(z >> 32);
+	}
+	*d = t;
+}
+
 /*
  * Split the scalar k into k0 and k1 such that k = k0 + k1*mu (with mu
  * being a specific square root of -1 modulo r).
  * k0 and k1 are signed.
  * IMPORTANT: k MUST be fully reduced for this call.
+ *
+ * With the lattice basis constants:
+ *   t = 2^126 + u
+ *   s = 2^126 - u - 1
+ * for a 64-bit u, we get c = round(k*t/r) and d = round(k*s/r), then:
+ *   k0 = k - d*s - c*t = k - (c+d)*2^126 - (c-d)*u + d
+ *   k1 = d*t - c*s     = (d-c)*2^126 + (c+d)*u + c
+ * Both products k*t and k*s are obtained from the single product k*u
+ * (since k*s = k*2^126 - k - k*u), and only two 128x64 products are
+ * needed for k0 and k1 (which are computed modulo 2^128).
  */
 static void
 split_mu(i128 *k0, i128 *k1, const i256 *k)
 {
-	static const i128 vES = { {
-		0x3FA56696, 0x639973CF, 0xFFFFFFFF, 0x3FFFFFFF
-	} };
-	static const i128 vET = { {
-		0xC05A9969, 0x9C668C30, 0x00000000, 0x40000000
-	} };
+	static const uint32_t vU[2] = { 0xC05A9969, 0x9C668C30 };
+
+	/* ku <- k*u (320 bits, in the low limbs of ku) */
+	i384 ku;
+	uint32_t g;
+	uint64_t z;
+	g = 0;
+	for (int i = 0; i < 8; i ++) {
+		z = (uint64_t)vU[0] * (uint64_t)k->v[i] + (uint64_t)g;
+		ku.v[i] = (uint32_t)z;
+		g = (uint32_t)(z >> 32);
+	}
+	ku.v[8] = g;
+	g = 0;
+	for (int i = 0; i < 8; i ++) {
+		z = (uint64_t)vU[1] * (uint64_t)k->v[i] + (uint64_t)g;
+		z += (uint64_t)ku.v[i + 1];
+		ku.v[i + 1] = (uint32_t)z;
+		g = (uint32_t)(z >> 32);
+	}
+	ku.v[9] = g;
+	ku.v[10] = 0;
+	ku.v[11] = 0;
+
+	/* kh <- k*2^126 */
+	i384 kh;
+	memset(&kh.v[0], 0, 3 * sizeof(uint32_t));
+	kh.v[3] = k->v[0] << 30;
+	for (int i = 1; i < 8; i ++) {
+		kh.v[3 + i] = (k->v[i] << 30) | (k->v[i - 1] >> 2);
+	}
+	kh.v[11] = k->v[7] >> 2;
+
+	/* zt <- k*t = kh + ku
+	   zs <- k*s = kh - k - ku */
+	i384 zt, zs;
+	unsigned char cc = 0, cs = 0;
+	for (int i = 0; i < 12; i ++) {
+		cc = addcarry_u32(cc, kh.v[i], ku.v[i], &zt.v[i]);
+		cs = subborrow_u32(cs, kh.v[i],
+			i < 8 ? k->v[i] : 0, &zs.v[i]);
+	}
+	cs = 0;
+	for (int i = 0; i < 12; i ++) {
+		cs = subborrow_u32(cs, zs.v[i], ku.v[i], &zs.v[i]);
+	}
 
 	/* c <- round(k*t/r)
 	   d <- round(k*s/r) */
 	i128 c, d;
-	mul_divr_rounded(&c, k, &vET);
-	mul_divr_rounded(&d, k, &vES);
+	divr_rounded(&c, &zt);
+	divr_rounded(&d, &zs);
+
+	/* e <- c + d
+	   f <- c - d */
+	i128 e, f, w;
+	cc = 0;
+	cs = 0;
+	for (int i = 0; i < 4; i ++) {
+		cc = addcarry_u32(cc, c.v[i], d.v[i], &e.v[i]);
+		cs = subborrow_u32(cs, c.v[i], d.v[i], &f.v[i]);
+	}
 
-	/* k0 <- k - d*s - c*t (truncated) */
+	/* k0 <- k - e*2^126 - f*u + d (truncated) */
 	memmove(k0->v, k->v, 4 * sizeof(uint32_t));
-	i128 w;
-	mul128x128trunc(&w, &d, &vES);
-	sub128trunc(k0, k0, &w);
-	mul128x128trunc(&w, &c, &vET);
+	k0->v[3] -= e.v[0] << 30;
+	mul128x64trunc(&w, &f, vU);
 	sub128trunc(k0, k0, &w);
+	cc = 0;
+	for (int i = 0; i < 4; i ++) {
+		cc = addcarry_u32(cc, k0->v[i], d.v[i], &k0->v[i]);
+	}
 
-	/* k1 <- d*t - c*s (truncated) */
-	mul128x128trunc(k1, &d, &vET);
-	mul128x128trunc(&w, &c, &vES);
-	sub128trunc(k1, k1, &w);
+	/* k1 <- e*u + c - f*2^126 (truncated) */
+	mul128x64trunc(k1, &e, vU);
+	cc = 0;
+	for (int i = 0; i < 4; i ++) {
+		cc = addcarry_u32(cc, k1->v[i], c.v[i], &k1->v[i]);
+	}
+	k1->v[3] -= f.v[0] << 30;
 }
 
 /* see gls254.h */
@@ -0,0 +1,354 @@
+/*
+ * Speed benchmark for host builds (e.g. with BACKEND=c). This measures
+ * the same operations as the Cortex M4 benchmarks listed in README.md,
+ * but reports wall-clock times (in nanoseconds) since cycle counters
+ * are not portable.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "gls254.h"
+#include "inner.h"
+
+static double
+now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/*
+ * Benchmark state: all operations work on these values, so that the
+ * compiler cannot optimize the calls away.
+ */
+typedef struct {
+	gfb254 a, b;
+	gls254_point pp[4], pb[16], pm[256];
+	uint8_t km[256 * 32];
+	uint8_t enc_pb[16 * 32];
+	gls254_private_key sk, sk2;
+	gls254_public_key pk, pk16[16];
+	uint8_t enc_pk[32], enc_pk16[16 * 32];
+	uint8_t sig[48];
+	gls254_private_key sk16[16];
+	uint8_t esig16[16][64], esig16k[16][64];
+	uint8_t msg16[32];
+	gls254_verify_item vi16[16], vi16k[16];
+	gls254_verify_context vc;
+	gls254_precomputed_point ppk;
+	gls254_scalar_recoded srk;
+	uint8_t key16[16 * 32];
+	uint8_t data[32];
+	uint8_t key[32];
+	int ok;
+} bench_state;
+
+static void
+op_gfb254_square(bench_state *bs)
+{
+	gfb254_square(&bs->a, &bs->a);
+}
+
+static void
+op_gfb254_mul(bench_state *bs)
+{
+	gfb254_mul(&bs->a, &bs->a, &bs->b);
+}
+
+static void
+op_gfb254_invert(bench_state *bs)
+{
+	gfb254_invert(&bs->a, &bs->a);
+}
+
+static void
+op_mul(bench_state *bs)
+{
+	gls254_mul(&bs->pp[0], &bs->pp[0], bs->data);
+}
+
+/* Batch of 4 multiplications; the reported time is divided by 4. */
+static void
+op_mul_batch4(bench_state *bs)
+{
+	uint8_t k[4 * 32];
+
+	for (int i = 0; i < 4; i ++) {
+		memcpy(k + (i << 5), bs->data, 32);
+	}
+	gls254_mul_batch(bs->pp, bs->pp, k, 4);
+}
+
+/* Multi-scalar multiplication with 256 terms; the reported time is
+   divided by 256. */
+static void
+op_msm256(bench_state *bs)
+{
+	gls254_msm_vartime(&bs->pm[0], bs->pm, bs->km, 256);
+}
+
+/* Multi-scalar multiplication with 4 terms (interleaved windows); the
+   reported time is divided by 4. */
+static void
+op_mul_multi4(bench_state *bs)
+{
+	gls254_mul_multi(&bs->pm[0], bs->pm, bs->km, 4);
+}
+
+static void
+op_mul_multi4_vartime(bench_state *bs)
+{
+	gls254_mul_multi_vartime(&bs->pm[0], bs->pm, bs->km, 4);
+}
+
+static void
+op_mul_add_gen_vartime(bench_state *bs)
+{
+	gls254_mul_add_gen_vartime(&bs->pp[0], &bs->pp[0],
+		bs->data, bs->km);
+}
+
+static void
+op_encode(bench_state *bs)
+{
+	gls254_encode(bs->enc_pb, &bs->pb[0]);
+	bs->pb[0].X.v[0].v[0] ^= bs->enc_pb[0];
+}
+
+/* Batch of 16 encodings; the reported time is divided by 16. */
+static void
+op_encode_batch16(bench_state *bs)
+{
+	gls254_encode_batch(bs->enc_pb, bs->pb, 16);
+	bs->pb[0].X.v[0].v[0] ^= bs->enc_pb[0];
+}
+
+static void
+op_keygen(bench_state *bs)
+{
+	gls254_keygen(&bs->sk2, bs->data, sizeof bs->data);
+	bs->data[0] ^= bs->sk2.sec[0];
+}
+
+static void
+op_decode_private(bench_state *bs)
+{
+	bs->ok &= gls254_decode_private(&bs->sk2, bs->sk.sec);
+}
+
+static void
+op_decode_public(bench_state *bs)
+{
+	bs->ok &= gls254_decode_public(&bs->pk, bs->enc_pk);
+}
+
+/* Batch of 16 public keys; the reported time is divided by 16. */
+static void
+op_decode_public_batch16(bench_state *bs)
+{
+	bs->ok &= gls254_decode_public_batch(bs->pk16, NULL, bs->enc_pk16, 16);
+}
+
+static void
+op_ECDH(bench_state *bs)
+{
+	bs->ok &= gls254_ECDH(bs->key, &bs->sk, &bs->pk);
+	bs->data[1] ^= bs->key[0];
+}
+
+/* ECDH with 16 peers; the reported time is divided by 16. */
+static void
+op_ECDH_batch16(bench_state *bs)
+{
+	bs->ok &= gls254_ECDH_batch(bs->key16, NULL, &bs->sk, bs->pk16, 16);
+	bs->data[1] ^= bs->key16[0];
+}
+
+static void
+op_ECDH_precomputed(bench_state *bs)
+{
+	bs->ok &= gls254_ECDH_precomputed(bs->key, &bs->sk, &bs->pk,
+		&bs->ppk);
+	bs->data[1] ^= bs->key[0];
+}
+
+static void
+op_ECDH_recoded(bench_state *bs)
+{
+	bs->ok &= gls254_ECDH_recoded(bs->key, &bs->sk, &bs->srk, &bs->pk);
+	bs->data[1] ^= bs->key[0];
+}
+
+static void
+op_sign(bench_state *bs)
+{
+	gls254_sign(bs->sig, &bs->sk, NULL, 0, NULL,
+		bs->data, sizeof bs->data);
+}
+
+static void
+op_verify(bench_state *bs)
+{
+	bs->ok &= gls254_verify_vartime(&bs->pk, bs->sig, NULL,
+		bs->data, sizeof bs->data);
+}
+
+static void
+op_verify_ctx(bench_state *bs)
+{
+	bs->ok &= gls254_verify_ctx_vartime(&bs->vc, bs->sig, NULL,
+		bs->data, sizeof bs->data);
+}
+
+/* Batch of 16 extended signatures from 16 distinct keys, or from a
+   single key; the reported time is divided by 16. */
+static void
+op_verify_batch16(bench_state *bs)
+{
+	bs->ok &= gls254_verify_batch_vartime(NULL, bs->vi16, 16, NULL, 0);
+}
+
+static void
+op_verify_batch16_onekey(bench_state *bs)
+{
+	bs->ok &= gls254_verify_batch_vartime(NULL, bs->vi16k, 16, NULL, 0);
+}
+
+/*
+ * Run an operation repeatedly and return the average time per call
+ * (in nanoseconds). The number of iterations is doubled until the
+ * total measured time is at least 0.5 second.
+ */
+static double
+bench(void (*op)(bench_state *), bench_state *bs)
+{
+	long num;
+
+	/* Warm-up. */
+	for (int i = 0; i < 10; i ++) {
+		op(bs);
+	}
+	num = 10;
+	for (;;) {
+		double t0, t1;
+
+		t0 = now_ns();
+		for (long i = 0; i < num; i ++) {
+			op(bs);
+		}
+		t1 = now_ns();
+		if ((t1 - t0) >= 5e8) {
+			return (t1 - t0) / (double)num;
+		}
+		num <<= 1;
+	}
+}
+
+int
+main(void)
+{
+	static const struct {
+		const char *name;
+		void (*op)(bench_state *);
+		int div;
+	} ops[] = {
+		{ "GF(2^254) squaring", &op_gfb254_square, 1 },
+		{ "GF(2^254) multiplication", &op_gfb254_mul, 1 },
+		{ "GF(2^254) inversion", &op_gfb254_invert, 1 },
+		{ "GLS254 point multiplication", &op_mul, 1 },
+		{ "GLS254 point multiplication (x4)", &op_mul_batch4, 4 },
+		{ "GLS254 multi-scalar mult. (x4)", &op_mul_multi4, 4 },
+		{ "GLS254 multi-scalar mult. (x4, vartime)",
+			&op_mul_multi4_vartime, 4 },
+		{ "GLS254 multi-scalar mult. (x256)", &op_msm256, 256 },
+		{ "GLS254 point encoding", &op_encode, 1 },
+		{ "GLS254 point encoding (x16)", &op_encode_batch16, 16 },
+		{ "GLS254 key pair generation", &op_keygen, 1 },
+		{ "GLS254 load private key", &op_decode_private, 1 },
+		{ "GLS254 load public key", &op_decode_public, 1 },
+		{ "GLS254 load public key (x16)",
+			&op_decode_public_batch16, 16 },
+		{ "GLS254 ECDH", &op_ECDH, 1 },
+		{ "GLS254 ECDH (precomputed peer)", &op_ECDH_precomputed, 1 },
+		{ "GLS254 ECDH (recoded key)", &op_ECDH_recoded, 1 },
+		{ "GLS254 ECDH (x16)", &op_ECDH_batch16, 16 },
+		{ "GLS254 signature generation", &op_sign, 1 },
+		{ "GLS254 signature verification", &op_verify, 1 },
+		{ "GLS254 u*P + v*B (vartime)", &op_mul_add_gen_vartime, 1 },
+		{ "GLS254 signature verification (context)",
+			&op_verify_ctx, 1 },
+		{ "GLS254 signature verification (x16)",
+			&op_verify_batch16, 16 },
+		{ "GLS254 signature verification (x16, 1 key)",
+			&op_verify_batch16_onekey, 16 },
+		{ NULL, NULL, 0 }
+	};
+	bench_state bs;
+
+	memset(&bs, 0, sizeof bs);
+	for (int i = 0; i < 4; i ++) {
+		bs.a.v[0].v[i] = 0x01234567 * (uint32_t)(i + 1);
+		bs.a.v[1].v[i] = 0x89ABCDEF * (uint32_t)(i + 1);
+		bs.b.v[0].v[i] = 0x76543210 * (uint32_t)(i + 1);
+		bs.b.v[1].v[i] = 0xFEDCBA98 * (uint32_t)(i + 1);
+	}
+	bs.a.v[0].v[3] &= 0x7FFFFFFF;
+	bs.a.v[1].v[3] &= 0x7FFFFFFF;
+	bs.b.v[0].v[3] &= 0x7FFFFFFF;
+	bs.b.v[1].v[3] &= 0x7FFFFFFF;
+	gls254_keygen(&bs.sk, "speed", 5);
+	gls254_encode_public(bs.enc_pk, &bs.sk.pub);
+	bs.pk = bs.sk.pub;
+	gls254_verify_context_init(&bs.vc, &bs.pk);
+	gls254_precompute_point(&bs.ppk, &bs.pk.pp);
+	gls254_scalar_recode(&bs.srk, bs.sk.sec);
+	gls254_sign(bs.sig, &bs.sk, NULL, 0, NULL, bs.data, sizeof bs.data);
+	for (int i = 0; i < 4; i ++) {
+		bs.pp[i] = GLS254_BASE;
+	}
+	for (int i = 0; i < 16; i ++) {
+		gls254_xdouble(&bs.pb[i], &GLS254_BASE, i);
+	}
+	gls254_encode_batch(bs.enc_pk16, bs.pb, 16);
+	gls254_decode_public_batch(bs.pk16, NULL, bs.enc_pk16, 16);
+	for (int i = 0; i < 256; i ++) {
+		bs.pm[i] = bs.pb[i & 15];
+		memcpy(bs.km + (i << 5), bs.sk.pub.enc, 32);
+		bs.km[i << 5] ^= (uint8_t)i;
+	}
+	for (int i = 0; i < 16; i ++) {
+		uint8_t seed = (uint8_t)i;
+
+		gls254_keygen(&bs.sk16[i], &seed, 1);
+		gls254_sign_ext(bs.esig16[i], &bs.sk16[i], NULL, 0, NULL,
+			bs.msg16, sizeof bs.msg16);
+		gls254_sign_ext(bs.esig16k[i], &bs.sk, &seed, 1, NULL,
+			bs.msg16, sizeof bs.msg16);
+		bs.vi16[i].pk = &bs.sk16[i].pub;
+		bs.vi16[i].sig = bs.esig16[i];
+		bs.vi16[i].hash_name = NULL;
+		bs.vi16[i].data = bs.msg16;
+		bs.vi16[i].data_len = sizeof bs.msg16;
+		bs.vi16k[i] = bs.vi16[i];
+		bs.vi16k[i].pk = &bs.sk.pub;
+		bs.vi16k[i].sig = bs.esig16k[i];
+	}
+	bs.ok = 1;
+
+	for (int i = 0; ops[i].name != NULL; i ++) {
+		double t = bench(ops[i].op, &bs) / ops[i].div;
+		printf("%-44s %12.1f ns\n", ops[i].name, t);
+		fflush(stdout);
+	}
+
+	if (!bs.ok) {
+		printf("WARNING: some operation reported a failure\n");
+	}
+	printf("(%u)\n", (unsigned)bs.a.v[0].v[0] ^ bs.data[0] ^ bs.sig[0]);
+	return 0;
+}
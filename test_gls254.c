@@ -707,6 +707,46 @@ test_gfb254(void)
 	printf(" done.\n");
 }
 
+static void
+test_gfb254_batch_invert(void)
+{
+	printf("Test gfb254_batch_invert: ");
+	fflush(stdout);
+
+	for (size_t n = 0; n <= 20; n ++) {
+		gfb254 a[20], d[20];
+
+		for (size_t j = 0; j < n; j ++) {
+			uint8_t tmp[32];
+			tmp[0] = (uint8_t)n;
+			tmp[1] = (uint8_t)j;
+			blake2s(tmp, 32, NULL, 0, tmp, 2);
+			gfb254_decode32_reduce(&a[j], tmp);
+		}
+		/* Some zero inputs, including in first and last position. */
+		if (n >= 3) {
+			memset(&a[0], 0, sizeof(gfb254));
+			memset(&a[n / 2], 0, sizeof(gfb254));
+		}
+		if (n >= 7) {
+			memset(&a[n - 1], 0, sizeof(gfb254));
+		}
+		gfb254_batch_invert(d, a, n);
+		for (size_t j = 0; j < n; j ++) {
+			gfb254 c;
+			gfb254_invert(&c, &a[j]);
+			r254_check_equals("batch_invert", &d[j], &c);
+			if (gfb254_iszero(&a[j])) {
+				r254_check_zero("batch_invert zero", &d[j]);
+			}
+		}
+		printf(".");
+		fflush(stdout);
+	}
+
+	printf(" done.\n");
+}
+
 static const char *KAT_DECODE_OK[] = {
 	// These values can be decoded into points. First one is the neutral.
 	"0000000000000000000000000000000000000000000000000000000000000000",
@@ -1604,6 +1644,9 @@ test_scalar(void)
 			scal_reduce(b, bb, j, GLS254_R);
 			check_eq_buf("scalar_reduce", a, b, 32);
 		}
+		scalar_reduce64(a, bb + (i & 31));
+		scal_reduce(b, bb + (i & 31), 64, GLS254_R);
+		check_eq_buf("scalar_reduce64", a, b, 32);
 		memcpy(a, bb, sizeof a);
 		memcpy(b, bb + 32, sizeof b);
 
@@ -1674,6 +1717,169 @@ test_scalar(void)
 	printf(" done.\n");
 }
 
+static void
+test_scalar_invert(void)
+{
+	printf("Test scalar_invert: ");
+	fflush(stdout);
+
+	static const uint8_t zero[32] = { 0 };
+	uint8_t one[32];
+	memset(one, 0, sizeof one);
+	one[0] = 1;
+
+	uint8_t a[20 * 32], c[20 * 32], d[32];
+	for (int i = 0; i < 20; i ++) {
+		uint8_t *x = a + 32 * i;
+
+		x[0] = (uint8_t)i;
+		x[1] = 0x51;
+		blake2s(x, 32, NULL, 0, x, 2);
+		if (i == 1) {
+			memset(x, 0, 32);
+		} else if (i == 2) {
+			memset(x, 0xFF, 32);
+		} else if (i == 3) {
+			memcpy(x, GLS254_R, 32);
+		} else if (i == 4) {
+			memcpy(x, GLS254_R, 32);
+			x[0] --;
+		} else if (i == 5) {
+			memcpy(x, one, 32);
+		}
+
+		scalar_invert(c, x);
+		if (i == 1 || i == 3) {
+			check_eq_buf("scalar_invert (zero)", c, zero, 32);
+		} else {
+			scal_mul(d, c, x, GLS254_R);
+			check_eq_buf("scalar_invert", d, one, 32);
+		}
+
+		printf(".");
+		fflush(stdout);
+	}
+
+	static const size_t batch_num[] = { 0, 1, 3, 4, 5, 8, 12, 16, 20 };
+	for (size_t k = 0; k < sizeof batch_num / sizeof batch_num[0]; k ++) {
+		size_t num = batch_num[k];
+
+		scalar_batch_invert(c, a, num);
+		for (size_t i = 0; i < num; i ++) {
+			scalar_invert(d, a + 32 * i);
+			check_eq_buf("scalar_batch_invert", c + 32 * i, d, 32);
+		}
+
+		/* Same batch sizes with only non-zero scalars. */
+		if (num <= 14) {
+			scalar_batch_invert(c, a + 32 * 6, num);
+			for (size_t i = 0; i < num; i ++) {
+				scal_mul(d, c + 32 * i, a + 32 * (6 + i),
+					GLS254_R);
+				check_eq_buf("scalar_batch_invert (nz)",
+					d, one, 32);
+			}
+		}
+		printf(".");
+		fflush(stdout);
+	}
+
+	/* A single zero input yields zero (as in scalar_invert()) and
+	   does not affect the other outputs. */
+	for (size_t z = 0; z < 5; z ++) {
+		uint8_t b[5 * 32];
+
+		memcpy(b, a + 32 * 6, sizeof b);
+		memset(b + 32 * z, 0, 32);
+		scalar_batch_invert(c, b, 5);
+		for (size_t i = 0; i < 5; i ++) {
+			if (i == z) {
+				check_eq_buf("scalar_batch_invert (zero)",
+					c + 32 * i, zero, 32);
+				continue;
+			}
+			scalar_invert(d, b + 32 * i);
+			check_eq_buf("scalar_batch_invert (zero)",
+				c + 32 * i, d, 32);
+			scal_mul(d, c + 32 * i, b + 32 * i, GLS254_R);
+			check_eq_buf("scalar_batch_invert (zero)",
+				d, one, 32);
+		}
+		printf(".");
+		fflush(stdout);
+	}
+
+	printf(" done.\n");
+}
+
+static void
+test_scalar_lagrange(void)
+{
+	printf("Test scalar_lagrange_coeffs: ");
+	fflush(stdout);
+
+	for (int num = 1; num <= 12; num ++) {
+		uint8_t ids[12 * 32], coef[12 * 32], lambda[12 * 32];
+		uint8_t acc[32], t[32], share[32];
+
+		for (int i = 0; i < num; i ++) {
+			uint8_t *x = ids + 32 * i;
+			uint8_t *c = coef + 32 * i;
+
+			x[0] = (uint8_t)num;
+			x[1] = (uint8_t)i;
+			x[2] = 0x4C;
+			blake2s(x, 32, NULL, 0, x, 3);
+			if (num >= 6 && i < 4) {
+				/* small identifiers 1, 2, 3,... */
+				memset(x, 0, 32);
+				x[0] = (uint8_t)(i + 1);
+			}
+			c[0] = (uint8_t)num;
+			c[1] = (uint8_t)i;
+			c[2] = 0x50;
+			blake2s(c, 32, NULL, 0, c, 3);
+		}
+		if (!scalar_lagrange_coeffs(lambda, ids, num)) {
+			printf("ERR lagrange (%d)\n", num);
+			exit(EXIT_FAILURE);
+		}
+
+		/* f(X) = sum coef[k]*X^k; sum lambda_i*f(x_i) = f(0) */
+		memset(acc, 0, sizeof acc);
+		for (int i = 0; i < num; i ++) {
+			memset(share, 0, sizeof share);
+			for (int k = num - 1; k >= 0; k --) {
+				scal_mul(share, share, ids + 32 * i, GLS254_R);
+				scal_add(share, share, coef + 32 * k, GLS254_R);
+			}
+			scal_mul(t, share, lambda + 32 * i, GLS254_R);
+			scal_add(acc, acc, t, GLS254_R);
+		}
+		scal_reduce(t, coef, 32, GLS254_R);
+		check_eq_buf("scalar_lagrange_coeffs", acc, t, 32);
+
+		/* Duplicate or zero identifiers are rejected. */
+		if (num >= 2) {
+			memcpy(ids + 32 * (num - 1), ids, 32);
+			if (scalar_lagrange_coeffs(lambda, ids, num)) {
+				printf("ERR lagrange duplicate (%d)\n", num);
+				exit(EXIT_FAILURE);
+			}
+		}
+		memset(ids, 0, 32);
+		if (scalar_lagrange_coeffs(lambda, ids, num)) {
+			printf("ERR lagrange zero (%d)\n", num);
+			exit(EXIT_FAILURE);
+		}
+
+		printf(".");
+		fflush(stdout);
+	}
+
+	printf(" done.\n");
+}
+
 static void
 test_gls254_window(void)
 {
@@ -1839,10 +2045,15 @@ test_mul(void)
 	}
 
 	HEXTOBIN(buf1, "d2d85b649ca1cb28cf6a710ea180864b48be872c7a9585fafc01ff8259ee4e09");
+	gls254_scalar_recoded sr;
+	gls254_scalar_recode(&sr, buf1);
 	gls254_mul(&q, &p, buf1);
 	gls254_encode(buf1, &q);
 	HEXTOBIN(buf2, "6832ca87b11a5efd7718bc3cff30dc7e2fe8dd0309aa4744208c43157cc1eb46");
 	check_eq_buf("KAT mul 1", buf1, buf2, 32);
+	gls254_mul_recoded(&q, &p, &sr);
+	gls254_encode(buf1, &q);
+	check_eq_buf("KAT mul_recoded 1", buf1, buf2, 32);
 
 	printf(".");
 	fflush(stdout);
@@ -1894,6 +2105,269 @@ test_mulgen(void)
 	printf(" done.\n");
 }
 
+static void
+test_mul_batch(void)
+{
+	printf("Test mul_batch: ");
+	fflush(stdout);
+
+	/* Lane-parallel add and xdouble against the single-lane functions. */
+	gls254_point p1[4], p2[4], p3[4];
+	for (int j = 0; j < 4; j ++) {
+		uint8_t v[32];
+		v[0] = (uint8_t)j;
+		blake2s(v, 32, NULL, 0, &v[0], 1);
+		gls254_mul(&p1[j], &GLS254_BASE, v);
+		gls254_xdouble(&p2[j], &p1[j], j);
+	}
+	p2[3] = GLS254_NEUTRAL;
+	gls254_add_x4(p3, p1, p2);
+	for (int j = 0; j < 4; j ++) {
+		gls254_point q;
+		gls254_add(&q, &p1[j], &p2[j]);
+		if (!gls254_equals(&q, &p3[j])) {
+			printf("ERR add_x4 (%d)\n", j);
+			exit(EXIT_FAILURE);
+		}
+	}
+	for (unsigned n = 0; n < 6; n ++) {
+		gls254_xdouble_x4(p3, p1, n);
+		for (int j = 0; j < 4; j ++) {
+			gls254_point q;
+			gls254_xdouble(&q, &p1[j], n);
+			if (!gls254_equals(&q, &p3[j])) {
+				printf("ERR xdouble_x4 (%u, %d)\n", n, j);
+				exit(EXIT_FAILURE);
+			}
+		}
+	}
+	printf(".");
+	fflush(stdout);
+
+	for (size_t num = 0; num <= 10; num ++) {
+		gls254_point pp[10], qq[10];
+		uint8_t kk[10 * 32];
+
+		for (size_t j = 0; j < num; j ++) {
+			uint8_t v[2];
+			v[0] = (uint8_t)num;
+			v[1] = (uint8_t)j;
+			blake2s(&kk[j << 5], 32, NULL, 0, v, 2);
+			gls254_mulgen(&pp[j], &kk[j << 5]);
+			kk[j << 5] ^= 0x55;
+		}
+		gls254_mul_batch(qq, pp, kk, num);
+		for (size_t j = 0; j < num; j ++) {
+			gls254_point q;
+			gls254_mul(&q, &pp[j], &kk[j << 5]);
+			if (!gls254_equals(&q, &qq[j])) {
+				printf("ERR mul_batch (%u, %u)\n",
+					(unsigned)num, (unsigned)j);
+				exit(EXIT_FAILURE);
+			}
+		}
+
+		/* In-place operation. */
+		gls254_mul_batch(pp, pp, kk, num);
+		for (size_t j = 0; j < num; j ++) {
+			if (!gls254_equals(&pp[j], &qq[j])) {
+				printf("ERR mul_batch in-place (%u, %u)\n",
+					(unsigned)num, (unsigned)j);
+				exit(EXIT_FAILURE);
+			}
+		}
+
+		printf(".");
+		fflush(stdout);
+	}
+
+	printf(" done.\n");
+}
+
+static void
+test_msm(void)
+{
+	printf("Test msm/mul_multi: ");
+	fflush(stdout);
+
+	/* 300 points: the last call spans two blocks. */
+	static gls254_point pp[300];
+	static uint8_t kk[300 * 32];
+	for (size_t j = 0; j < 300; j ++) {
+		uint8_t v[32];
+		v[0] = (uint8_t)j;
+		v[1] = (uint8_t)(j >> 8);
+		v[2] = 0x4D;
+		blake2s(v, 32, NULL, 0, v, 3);
+		gls254_mul(&pp[j], &GLS254_BASE, v);
+		v[0] ^= 0xFF;
+		blake2s(&kk[j << 5], 32, NULL, 0, v, 32);
+	}
+	pp[5] = GLS254_NEUTRAL;
+	memset(&kk[7 << 5], 0, 32);
+	memset(&kk[8 << 5], 0xFF, 32);
+	memcpy(&kk[9 << 5], GLS254_R, 32);
+	kk[9 << 5] --;
+
+	static const size_t nums[] = {
+		0, 1, 2, 3, 4, 10, 16, 17, 33, 64, 300
+	};
+	for (size_t u = 0; u < sizeof nums / sizeof nums[0]; u ++) {
+		size_t num = nums[u];
+		gls254_point q, r;
+
+		gls254_msm_vartime(&q, pp, kk, num);
+		r = GLS254_NEUTRAL;
+		for (size_t j = 0; j < num; j ++) {
+			gls254_point t;
+			gls254_mul(&t, &pp[j], &kk[j << 5]);
+			gls254_add(&r, &r, &t);
+		}
+		check_eq_point("msm", &q, &r);
+		if (num <= 40) {
+			gls254_mul_multi(&q, pp, kk, num);
+			check_eq_point("mul_multi", &q, &r);
+			gls254_mul_multi_vartime(&q, pp, kk, num);
+			check_eq_point("mul_multi_vartime", &q, &r);
+		}
+
+		printf(".");
+		fflush(stdout);
+	}
+
+	printf(" done.\n");
+}
+
+static void
+test_mul2(void)
+{
+	printf("Test mul2: ");
+	fflush(stdout);
+
+	for (int i = 0; i < 20; i ++) {
+		uint8_t u[32], v[32];
+		gls254_point P1, P2, q, r, t;
+
+		u[0] = (uint8_t)i;
+		u[1] = 0x32;
+		blake2s(u, 32, NULL, 0, u, 2);
+		v[0] = (uint8_t)i;
+		v[1] = 0x33;
+		blake2s(v, 32, NULL, 0, v, 2);
+		gls254_mul(&P1, &GLS254_BASE, u);
+		gls254_mul(&P2, &GLS254_BASE, v);
+		if (i == 1) {
+			memset(u, 0, 32);
+		} else if (i == 2) {
+			memset(v, 0, 32);
+		} else if (i == 3) {
+			memset(v, 0xFF, 32);
+		} else if (i == 4) {
+			P1 = GLS254_NEUTRAL;
+		}
+
+		gls254_mul(&r, &P1, u);
+		gls254_mul(&t, &P2, v);
+		gls254_add(&r, &r, &t);
+		gls254_mul2_vartime(&q, &P1, u, &P2, v);
+		check_eq_point("mul2_vartime", &q, &r);
+
+		gls254_mul(&r, &P1, u);
+		gls254_mulgen(&t, v);
+		gls254_add(&r, &r, &t);
+		gls254_mul_add_gen_vartime(&q, &P1, u, v);
+		check_eq_point("mul_add_gen_vartime", &q, &r);
+
+		printf(".");
+		fflush(stdout);
+	}
+
+	printf(" done.\n");
+}
+
+static void
+test_mul_precomputed(void)
+{
+	printf("Test mul_precomputed: ");
+	fflush(stdout);
+
+	for (int i = 0; i < 20; i ++) {
+		uint8_t k[32];
+		gls254_point P, q, r;
+		gls254_precomputed_point pp;
+
+		k[0] = (uint8_t)i;
+		k[1] = 0x34;
+		blake2s(k, 32, NULL, 0, k, 2);
+		gls254_mul(&P, &GLS254_BASE, k);
+		k[1] = 0x35;
+		blake2s(k, 32, NULL, 0, k, 2);
+		if (i == 1) {
+			memset(k, 0, 32);
+		} else if (i == 2) {
+			memset(k, 0xFF, 32);
+		} else if (i == 3) {
+			P = GLS254_NEUTRAL;
+		} else if (i == 4) {
+			P = GLS254_BASE;
+		}
+
+		gls254_precompute_point(&pp, &P);
+		for (int j = 0; j < 4; j ++) {
+			gls254_mul(&r, &P, k);
+			gls254_mul_precomputed(&q, &pp, k);
+			check_eq_point("mul_precomputed", &q, &r);
+			k[j] ^= 0x5A;
+		}
+
+		printf(".");
+		fflush(stdout);
+	}
+
+	printf(" done.\n");
+}
+
+static void
+test_normalize_batch(void)
+{
+	printf("Test normalize/encode batch: ");
+	fflush(stdout);
+
+	/* 40 points cover several chunks and a partial last chunk. */
+	gls254_point pp[40];
+	gls254_point_affine qq[40];
+	for (size_t j = 0; j < 40; j ++) {
+		uint8_t v[32];
+		v[0] = (uint8_t)j;
+		blake2s(v, 32, NULL, 0, v, 1);
+		gls254_mul(&pp[j], &GLS254_BASE, v);
+	}
+	pp[7] = GLS254_NEUTRAL;
+	for (size_t num = 0; num <= 40; num ++) {
+		gls254_normalize_batch(qq, pp, num);
+		for (size_t j = 0; j < num; j ++) {
+			gls254_point_affine qa;
+			gls254_normalize(&qa, &pp[j]);
+			r254_check_equals("normalize_batch (x)",
+				&qq[j].scaled_x, &qa.scaled_x);
+			r254_check_equals("normalize_batch (s)",
+				&qq[j].scaled_s, &qa.scaled_s);
+		}
+
+		uint8_t eb[40 * 32];
+		gls254_encode_batch(eb, pp, num);
+		for (size_t j = 0; j < num; j ++) {
+			uint8_t tmp[32];
+			gls254_encode(tmp, &pp[j]);
+			check_eq_buf("encode_batch", &eb[j << 5], tmp, 32);
+		}
+		printf(".");
+		fflush(stdout);
+	}
+
+	printf(" done.\n");
+}
+
 static void
 test_key(void)
 {
@@ -1928,6 +2402,74 @@ test_key(void)
 	printf(" done.\n");
 }
 
+static void
+test_decode_public_batch(void)
+{
+	printf("Test decode_public batch: ");
+	fflush(stdout);
+
+	/* 40 keys cover several chunks and a partial last chunk; a few
+	   of them are invalid (bad encodings, and the neutral). */
+	uint8_t enc[40 * 32];
+	for (size_t j = 0; j < 40; j ++) {
+		gls254_private_key sk;
+		uint8_t tmp[1];
+
+		tmp[0] = (uint8_t)j;
+		gls254_keygen(&sk, tmp, 1);
+		gls254_encode_public(&enc[j << 5], &sk.pub);
+	}
+	hextobin(&enc[3 << 5], 32, KAT_DECODE_BAD[0]);
+	hextobin(&enc[16 << 5], 32, KAT_DECODE_BAD[1]);
+	hextobin(&enc[21 << 5], 32, KAT_DECODE_OK[0]);
+	enc[(30 << 5) + 31] |= 0x80;
+
+	for (size_t num = 0; num <= 40; num ++) {
+		gls254_public_key pk[40];
+		uint8_t valid[5];
+		int all, rall;
+
+		memset(valid, 0xA5, sizeof valid);
+		all = gls254_decode_public_batch(pk, valid, enc, num);
+		rall = 1;
+		for (size_t j = 0; j < num; j ++) {
+			gls254_public_key rpk;
+			int r;
+
+			r = gls254_decode_public(&rpk, &enc[j << 5]);
+			rall &= r;
+			if (((valid[j >> 3] >> (j & 7)) & 1) != r) {
+				printf("ERR decode_public_batch (valid %u)\n",
+					(unsigned)j);
+				exit(EXIT_FAILURE);
+			}
+			check_eq_buf("decode_public_batch (enc)",
+				pk[j].enc, rpk.enc, 32);
+			check_eq_point("decode_public_batch (pp)",
+				&pk[j].pp, &rpk.pp);
+			if (gls254_isneutral(&pk[j].pp) != (uint32_t)(r - 1)) {
+				printf("ERR decode_public_batch (neutral)\n");
+				exit(EXIT_FAILURE);
+			}
+		}
+		for (size_t j = num; j < ((num + 7) & ~(size_t)7); j ++) {
+			if (((valid[j >> 3] >> (j & 7)) & 1) != 0) {
+				printf("ERR decode_public_batch (padding)\n");
+				exit(EXIT_FAILURE);
+			}
+		}
+		if (all != rall) {
+			printf("ERR decode_public_batch (all)\n");
+			exit(EXIT_FAILURE);
+		}
+
+		printf(".");
+		fflush(stdout);
+	}
+
+	printf(" done.\n");
+}
+
 static const char *KAT_SIGN[] = {
 	// Each group of five values is:
 	//   private key
@@ -2095,6 +2637,27 @@ test_sign(void)
 			printf("ERR verify 1\n");
 			exit(EXIT_FAILURE);
 		}
+		uint8_t esig[64];
+		gls254_sign_ext(esig, &sk, seed, seed_len,
+			"blake2s", data, sizeof data);
+		check_eq_buf("signature (ext)", esig + 32, rsig + 16, 32);
+		if (!gls254_verify_ext_vartime(&pk, esig,
+			"blake2s", data, sizeof data))
+		{
+			printf("ERR verify ext 1\n");
+			exit(EXIT_FAILURE);
+		}
+		gls254_verify_context vc;
+		gls254_verify_context_init(&vc, &pk);
+		if (!gls254_verify_ctx_vartime(&vc, sig,
+			"blake2s", data, sizeof data)
+			|| !gls254_verify_ext_ctx_vartime(&vc, esig,
+			"blake2s", data, sizeof data))
+		{
+			printf("ERR verify ctx 1\n");
+			exit(EXIT_FAILURE);
+		}
+
 		data[5] ^= 0x20;
 		if (gls254_verify_vartime(&pk, sig,
 			"blake2s", data, sizeof data))
@@ -2102,6 +2665,43 @@ test_sign(void)
 			printf("ERR verify 2\n");
 			exit(EXIT_FAILURE);
 		}
+		if (gls254_verify_ext_vartime(&pk, esig,
+			"blake2s", data, sizeof data))
+		{
+			printf("ERR verify ext 2\n");
+			exit(EXIT_FAILURE);
+		}
+		if (gls254_verify_ctx_vartime(&vc, sig,
+			"blake2s", data, sizeof data)
+			|| gls254_verify_ext_ctx_vartime(&vc, esig,
+			"blake2s", data, sizeof data))
+		{
+			printf("ERR verify ctx 2\n");
+			exit(EXIT_FAILURE);
+		}
+		data[5] ^= 0x20;
+		sig[20] ^= 0x01;
+		esig[40] ^= 0x01;
+		if (gls254_verify_ctx_vartime(&vc, sig,
+			"blake2s", data, sizeof data)
+			|| gls254_verify_ext_ctx_vartime(&vc, esig,
+			"blake2s", data, sizeof data))
+		{
+			printf("ERR verify ctx 3\n");
+			exit(EXIT_FAILURE);
+		}
+
+		/* A context on an invalid key rejects everything. */
+		HEXTOBIN(tmp, KAT_DECODE_BAD[0]);
+		gls254_decode_public(&pk, tmp);
+		gls254_verify_context_init(&vc, &pk);
+		sig[20] ^= 0x01;
+		if (gls254_verify_ctx_vartime(&vc, sig,
+			"blake2s", data, sizeof data))
+		{
+			printf("ERR verify ctx 4\n");
+			exit(EXIT_FAILURE);
+		}
 
 		printf(".");
 		fflush(stdout);
@@ -2110,6 +2710,112 @@ test_sign(void)
 	printf(" done.\n");
 }
 
+static void
+test_verify_batch(void)
+{
+	printf("Test verify batch: ");
+	fflush(stdout);
+
+	/* 40 signatures (several chunks and a partial last chunk), with
+	   5 distinct keys; some signatures are invalid. */
+	gls254_private_key sk[5];
+	gls254_public_key bad_pk;
+	uint8_t sigs[40][64], data[40][8], tmp[32];
+	gls254_verify_item items[40];
+	for (int i = 0; i < 5; i ++) {
+		tmp[0] = (uint8_t)i;
+		gls254_keygen(&sk[i], tmp, 1);
+	}
+	HEXTOBIN(tmp, KAT_DECODE_BAD[0]);
+	gls254_decode_public(&bad_pk, tmp);
+	for (size_t j = 0; j < 40; j ++) {
+		memset(data[j], 0, sizeof data[j]);
+		data[j][0] = (uint8_t)j;
+		gls254_sign_ext(sigs[j], &sk[(j * 3) % 5], NULL, 0,
+			NULL, data[j], sizeof data[j]);
+		items[j].pk = &sk[(j * 3) % 5].pub;
+		items[j].sig = sigs[j];
+		items[j].hash_name = NULL;
+		items[j].data = data[j];
+		items[j].data_len = sizeof data[j];
+	}
+
+	for (int v = 0; v < 6; v ++) {
+		uint8_t saved[40][64];
+		uint8_t valid[5];
+		size_t bad;
+		int all;
+
+		/* v = 0: all good; otherwise one altered signature. */
+		memcpy(saved, sigs, sizeof sigs);
+		bad = (size_t)(v * 7) % 40;
+		switch (v) {
+		case 1:
+			data[bad][1] ^= 1;
+			break;
+		case 2:
+			sigs[bad][40] ^= 1;
+			break;
+		case 3:
+			sigs[bad][3] ^= 1;
+			break;
+		case 4:
+			memset(sigs[bad] + 32, 0xFF, 32);
+			break;
+		case 5:
+			items[bad].pk = &bad_pk;
+			break;
+		}
+
+		all = gls254_verify_batch_vartime(valid, items, 40,
+			&v, sizeof v);
+		for (size_t j = 0; j < 40; j ++) {
+			int r = gls254_verify_ext_vartime(items[j].pk,
+				items[j].sig, NULL, items[j].data,
+				items[j].data_len);
+			if (r != (v == 0 || j != bad)) {
+				printf("ERR verify ext (%d, %u)\n",
+					v, (unsigned)j);
+				exit(EXIT_FAILURE);
+			}
+			if (((valid[j >> 3] >> (j & 7)) & 1) != r) {
+				printf("ERR verify batch (%d, %u)\n",
+					v, (unsigned)j);
+				exit(EXIT_FAILURE);
+			}
+		}
+		if (all != (v == 0)) {
+			printf("ERR verify batch (all, %d)\n", v);
+			exit(EXIT_FAILURE);
+		}
+
+		memcpy(sigs, saved, sizeof sigs);
+		if (v == 1) {
+			data[bad][1] ^= 1;
+		}
+		if (v == 5) {
+			items[bad].pk = &sk[(bad * 3) % 5].pub;
+		}
+
+		printf(".");
+		fflush(stdout);
+	}
+
+	/* Small batches, including the empty one. */
+	for (size_t num = 0; num <= 3; num ++) {
+		if (gls254_verify_batch_vartime(NULL, items, num,
+			NULL, 0) != 1)
+		{
+			printf("ERR verify batch (%u)\n", (unsigned)num);
+			exit(EXIT_FAILURE);
+		}
+		printf(".");
+		fflush(stdout);
+	}
+
+	printf(" done.\n");
+}
+
 static const char *KAT_ECDH[] = {
         // Each group of five values is:
         //   private key
@@ -2270,6 +2976,22 @@ test_ECDH(void)
 			exit(EXIT_FAILURE);
 		}
 		check_eq_buf("ECDH 1", tmp, bufr1, 32);
+		gls254_precomputed_point pp;
+		gls254_precompute_point(&pp, &pk.pp);
+		memset(tmp, 0, 32);
+		if (!gls254_ECDH_precomputed(tmp, &sk, &pk, &pp)) {
+			printf("ERR ECDH precomputed (1)\n");
+			exit(EXIT_FAILURE);
+		}
+		check_eq_buf("ECDH precomputed 1", tmp, bufr1, 32);
+		gls254_scalar_recoded sr;
+		gls254_scalar_recode(&sr, sk.sec);
+		memset(tmp, 0, 32);
+		if (!gls254_ECDH_recoded(tmp, &sk, &sr, &pk)) {
+			printf("ERR ECDH recoded (1)\n");
+			exit(EXIT_FAILURE);
+		}
+		check_eq_buf("ECDH recoded 1", tmp, bufr1, 32);
 
 		if (gls254_decode_public(&pk, bufpk2)) {
 			printf("ERR decode pub (2)\n");
@@ -2280,6 +3002,70 @@ test_ECDH(void)
 			exit(EXIT_FAILURE);
 		}
 		check_eq_buf("ECDH 2", tmp, bufr2, 32);
+		gls254_precompute_point(&pp, &pk.pp);
+		memset(tmp, 0, 32);
+		if (gls254_ECDH_precomputed(tmp, &sk, &pk, &pp)) {
+			printf("ERR ECDH precomputed (2)\n");
+			exit(EXIT_FAILURE);
+		}
+		check_eq_buf("ECDH precomputed 2", tmp, bufr2, 32);
+
+		printf(".");
+		fflush(stdout);
+	}
+
+	printf(" done.\n");
+}
+
+static void
+test_ECDH_batch(void)
+{
+	printf("Test ECDH batch: ");
+	fflush(stdout);
+
+	/* 40 peers (several chunks and a partial last chunk), with a
+	   few invalid keys. */
+	gls254_private_key sk, sk2;
+	gls254_public_key pk[40];
+	uint8_t keys[40][32], tmp[32];
+	gls254_keygen(&sk, "ECDH batch", 10);
+	for (size_t j = 0; j < 40; j ++) {
+		if (j % 13 == 5) {
+			HEXTOBIN(tmp, KAT_DECODE_BAD[0]);
+			gls254_decode_public(&pk[j], tmp);
+		} else {
+			tmp[0] = (uint8_t)j;
+			gls254_keygen(&sk2, tmp, 1);
+			pk[j] = sk2.pub;
+		}
+	}
+	static const size_t nums[] = { 0, 1, 3, 4, 5, 16, 17, 40 };
+	for (size_t v = 0; v < sizeof nums / sizeof nums[0]; v ++) {
+		size_t num = nums[v];
+		uint8_t valid[5];
+		int all, ok;
+
+		memset(valid, 0xAA, sizeof valid);
+		all = gls254_ECDH_batch(keys, valid, &sk, pk, num);
+		ok = 1;
+		for (size_t j = 0; j < num; j ++) {
+			int r = gls254_ECDH(tmp, &sk, &pk[j]);
+			check_eq_buf("ECDH batch", keys[j], tmp, 32);
+			if (((valid[j >> 3] >> (j & 7)) & 1) != r) {
+				printf("ERR ECDH batch valid bit (%u)\n",
+					(unsigned)j);
+				exit(EXIT_FAILURE);
+			}
+			ok &= r;
+		}
+		if (all != ok) {
+			printf("ERR ECDH batch result (%u)\n", (unsigned)num);
+			exit(EXIT_FAILURE);
+		}
+		if (gls254_ECDH_batch(keys, NULL, &sk, pk, num) != ok) {
+			printf("ERR ECDH batch (no bitmap)\n");
+			exit(EXIT_FAILURE);
+		}
 
 		printf(".");
 		fflush(stdout);
@@ -2331,16 +3117,27 @@ main(void)
 {
 	test_gfb127();
 	test_gfb254();
+	test_gfb254_batch_invert();
 	test_gls254_encode_decode();
 	test_gls254_ops();
 	test_gls254_window();
 	test_hash_to_point();
 	test_scalar();
+	test_scalar_invert();
+	test_scalar_lagrange();
 	test_mul();
 	test_mulgen();
+	test_mul_batch();
+	test_msm();
+	test_mul2();
+	test_mul_precomputed();
+	test_normalize_batch();
 	test_key();
+	test_decode_public_batch();
 	test_sign();
+	test_verify_batch();
 	test_ECDH();
+	test_ECDH_batch();
 	test_raw_ECDH();
 	return 0;
 }